@@ -28,6 +28,7 @@ option ( BT_CMAKE_DEBUG "Log-Output debug message about cmake-logic" ON )
 
 option ( BT_BUILD_SDK "Build enabled SDK modules." ON )
 option ( BT_TESTS "Unit testing" ON )
+option ( BT_BENCHMARKS "Build micro-benchmarks" OFF )
 option ( BT_BUILD_STATIC "Build modules as STATIC libraries." ON )
 option ( BT_BUILD_SHARED "Build modules as SHARED libraries." OFF )
 option ( BT_EXPORT_SOURCES "Append all sources & headers to output-vars" OFF )
@@ -96,6 +97,10 @@ if ( BT_CMAKE_DEBUG )
         message ( STATUS "${PROJECT_NAME} - tests enabled." )
     endif ( BT_TESTS )
 
+    if ( BT_BENCHMARKS )
+        message ( STATUS "${PROJECT_NAME} - benchmarks enabled." )
+    endif ( BT_BENCHMARKS )
+
     if ( BT_BUILD_STATIC )
         add_definitions ( -DBT_STATIC=1 )
         message ( STATUS "${PROJECT_NAME} - STATIC build enabled." )
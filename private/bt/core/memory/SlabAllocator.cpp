@@ -0,0 +1,183 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef BT_CORE_SLAB_ALLOCATOR_HPP
+#include "../../../../public/bt/core/memory/SlabAllocator.hpp"
+#endif // !BT_CORE_SLAB_ALLOCATOR_HPP
+
+// Include C++ new
+#include <new>
+
+// ===========================================================
+// bt::core::SlabAllocator
+// ===========================================================
+
+namespace bt
+{
+
+    namespace core
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        SlabAllocator::SlabAllocator( const bt_size_t pBlockSize, const bt_size_t pCapacity, const EPageTypes pPages )
+            : mPages( pPages ),
+              mBlockSize( VirtualMemory::RoundUp(pBlockSize < 1 ? 1 : pBlockSize, alignof(void*)) ),
+              mCapacity( VirtualMemory::RoundUp(pCapacity, pPages == EPageTypes::Default ? VirtualMemory::getPageSize() : VirtualMemory::HUGE_PAGE_SIZE) ),
+              mCommitStep( pPages == EPageTypes::Default ? VirtualMemory::RoundUp(mBlockSize, 64 * 1024) : VirtualMemory::RoundUp(mBlockSize, VirtualMemory::HUGE_PAGE_SIZE) ),
+              mPurgeBlocks( pPages == EPageTypes::Default && mBlockSize % VirtualMemory::getPageSize() == 0 ),
+              mAddress( static_cast<unsigned char*>(VirtualMemory::Reserve(mCapacity, pPages)) ),
+              mCommitted( 0 ),
+              mUsed( 0 ),
+              mAllocated( 0 ),
+              mFreeBlocks()
+        {
+            if ( mAddress == nullptr )
+                throw std::bad_alloc();
+        }
+
+        SlabAllocator::~SlabAllocator() BT_NOEXCEPT
+        {
+            VirtualMemory::Release( mAddress, mCapacity, mPages );
+        }
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        bt_size_t SlabAllocator::getBlockSize() const BT_NOEXCEPT
+        { return mBlockSize; }
+
+        bt_size_t SlabAllocator::getCommitStep() const BT_NOEXCEPT
+        { return mCommitStep; }
+
+        bt_size_t SlabAllocator::getCommitted() const BT_NOEXCEPT
+        { return mCommitted; }
+
+        bt_size_t SlabAllocator::Count() const BT_NOEXCEPT
+        { return mAllocated; }
+
+        bool SlabAllocator::Owns( const void* const pAddress ) const BT_NOEXCEPT
+        {
+            const unsigned char* const address = static_cast<const unsigned char*>( pAddress );
+            return address >= mAddress && address < mAddress + mUsed;
+        }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        void* SlabAllocator::Allocate()
+        {
+            if ( !mFreeBlocks.empty() )
+            {
+                void* const block = mFreeBlocks.back();
+
+                mFreeBlocks.pop_back();
+                mAllocated++;
+
+                return block;
+            }
+
+            if ( mUsed + mBlockSize > mCapacity )
+                return nullptr;
+
+            if ( mUsed + mBlockSize > mCommitted )
+            {
+                bt_size_t commitSize = mCommitStep;
+
+                if ( mCommitted + commitSize > mCapacity )
+                    commitSize = mCapacity - mCommitted;
+
+                if ( !VirtualMemory::Commit(mAddress + mCommitted, commitSize) )
+                    return nullptr;
+
+                mCommitted += commitSize;
+            }
+
+            void* const block = mAddress + mUsed;
+            mUsed += mBlockSize;
+            mAllocated++;
+
+            return block;
+        }
+
+        void SlabAllocator::Deallocate( void* const pBlock )
+        {
+            if ( pBlock == nullptr )
+                return;
+
+            mFreeBlocks.push_back( pBlock );
+            mAllocated--;
+        }
+
+        bool SlabAllocator::Trim() BT_NOEXCEPT
+        {
+            if ( mCommitted < 1 )
+                return false;
+
+            if ( mAllocated > 0 )
+            {
+                if ( !mPurgeBlocks || mFreeBlocks.empty() )
+                    return false;
+
+                for ( void* const block : mFreeBlocks )
+                    VirtualMemory::Purge( block, mBlockSize );
+
+                return true;
+            }
+
+            VirtualMemory::Decommit( mAddress, mCommitted );
+
+            mFreeBlocks.clear();
+            mCommitted = 0;
+            mUsed = 0;
+
+            return true;
+        }
+
+        // -----------------------------------------------------------
+
+    } /// bt::core
+
+} /// bt
@@ -0,0 +1,202 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef BT_CORE_VIRTUAL_MEMORY_HPP
+#include "../../../../public/bt/core/memory/VirtualMemory.hpp"
+#endif // !BT_CORE_VIRTUAL_MEMORY_HPP
+
+// PLATFORM
+#if defined( BT_WINDOWS ) // WINDOWS
+#include <windows.h>
+#else // POSIX
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+// PLATFORM
+
+// ===========================================================
+// bt::core::VirtualMemory
+// ===========================================================
+
+namespace bt
+{
+
+    namespace core
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        bt_size_t VirtualMemory::getPageSize() BT_NOEXCEPT
+        {
+#if defined( BT_WINDOWS ) // WINDOWS
+            SYSTEM_INFO sysInfo;
+            GetSystemInfo( &sysInfo );
+            return static_cast<bt_size_t>( sysInfo.dwPageSize );
+#else // POSIX
+            static const bt_size_t pageSize = static_cast<bt_size_t>( sysconf(_SC_PAGESIZE) );
+            return pageSize;
+#endif
+        }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        void* VirtualMemory::Reserve( const bt_size_t pSize, const EPageTypes pPages ) BT_NOEXCEPT
+        {
+            if ( pSize < 1 )
+                return nullptr;
+
+#if defined( BT_WINDOWS ) // WINDOWS
+            if ( pPages == EPageTypes::Huge )
+            {
+                const bt_size_t largePage = static_cast<bt_size_t>( GetLargePageMinimum() );
+
+                // Large pages can't be reserved without commit, and require SeLockMemoryPrivilege.
+                if ( largePage > 0 )
+                {
+                    void* const address = VirtualAlloc( nullptr, RoundUp(pSize, largePage), MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE );
+
+                    if ( address )
+                        return address;
+                }
+            }
+
+            return VirtualAlloc( nullptr, RoundUp(pSize, getPageSize()), MEM_RESERVE, PAGE_NOACCESS );
+#else // POSIX
+            const bt_size_t pageSize = getPageSize();
+
+            if ( pPages == EPageTypes::Default )
+            {
+                void* const address = mmap( nullptr, RoundUp(pSize, pageSize), PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+                return address == MAP_FAILED ? nullptr : address;
+            }
+
+            const bt_size_t size = RoundUp( pSize, HUGE_PAGE_SIZE );
+
+#if defined( MAP_HUGETLB )
+            if ( pPages == EPageTypes::Huge )
+            {
+                // Huge pages pool is reserved by OS, so range is committed immediately.
+                void* const address = mmap( nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0 );
+
+                if ( address != MAP_FAILED )
+                    return address;
+            }
+#endif // MAP_HUGETLB
+
+            // Over-reserve to align range start to huge page, then unmap head & tail.
+            void* const address = mmap( nullptr, size + HUGE_PAGE_SIZE, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0 );
+
+            if ( address == MAP_FAILED )
+                return nullptr;
+
+            const bt_size_t start = reinterpret_cast<bt_size_t>( address );
+            const bt_size_t alignedStart = RoundUp( start, HUGE_PAGE_SIZE );
+            const bt_size_t head = alignedStart - start;
+            const bt_size_t tail = HUGE_PAGE_SIZE - head;
+
+            if ( head > 0 )
+                munmap( address, head );
+
+            if ( tail > 0 )
+                munmap( reinterpret_cast<void*>(alignedStart + size), tail );
+
+            void* const alignedAddress = reinterpret_cast<void*>( alignedStart );
+
+#if defined( MADV_HUGEPAGE )
+            madvise( alignedAddress, size, MADV_HUGEPAGE );
+#endif // MADV_HUGEPAGE
+
+            return alignedAddress;
+#endif
+        }
+
+        bool VirtualMemory::Commit( void* const pAddress, const bt_size_t pSize ) BT_NOEXCEPT
+        {
+#if defined( BT_WINDOWS ) // WINDOWS
+            return VirtualAlloc( pAddress, pSize, MEM_COMMIT, PAGE_READWRITE ) != nullptr;
+#else // POSIX
+            return mprotect( pAddress, pSize, PROT_READ | PROT_WRITE ) == 0;
+#endif
+        }
+
+        void VirtualMemory::Decommit( void* const pAddress, const bt_size_t pSize ) BT_NOEXCEPT
+        {
+#if defined( BT_WINDOWS ) // WINDOWS
+            VirtualFree( pAddress, pSize, MEM_DECOMMIT );
+#else // POSIX
+            madvise( pAddress, pSize, MADV_DONTNEED );
+            mprotect( pAddress, pSize, PROT_NONE );
+#endif
+        }
+
+        void VirtualMemory::Purge( void* const pAddress, const bt_size_t pSize ) BT_NOEXCEPT
+        {
+#if defined( BT_WINDOWS ) // WINDOWS
+            VirtualAlloc( pAddress, pSize, MEM_RESET, PAGE_READWRITE );
+#else // POSIX
+            madvise( pAddress, pSize, MADV_DONTNEED );
+#endif
+        }
+
+        void VirtualMemory::Release( void* const pAddress, const bt_size_t pSize, const EPageTypes pPages ) BT_NOEXCEPT
+        {
+            if ( pAddress == nullptr )
+                return;
+
+#if defined( BT_WINDOWS ) // WINDOWS
+            (void)pSize;
+            (void)pPages;
+            VirtualFree( pAddress, 0, MEM_RELEASE );
+#else // POSIX
+            const bt_size_t size = pPages == EPageTypes::Default ? RoundUp( pSize, getPageSize() ) : RoundUp( pSize, HUGE_PAGE_SIZE );
+            munmap( pAddress, size );
+#endif
+        }
+
+        // -----------------------------------------------------------
+
+    } /// bt::core
+
+} /// bt
@@ -0,0 +1,632 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_ARCHETYPE_HPP
+#include "../../../../public/bt/ecs/archetype/Archetype.hpp"
+#endif // !ECS_ARCHETYPE_HPP
+
+// Include C++ cstring
+#include <cstring>
+
+// Include C++ algorithm
+#include <algorithm>
+
+// DEBUG
+#if defined( DEBUG ) || defined( BT_DEBUG )
+
+// Include ecs::assert
+#ifndef ECS_ASSERT_HPP
+#include "../../../../public/bt/ecs/types/ecs_assert.hpp"
+#endif // !ECS_ASSERT_HPP
+
+#endif
+// DEBUG
+
+// ===========================================================
+// ecs::Archetype
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTANTS
+    // ===========================================================
+
+    constexpr const ecs_int16_t Archetype::NO_COLUMN;
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    /**
+     * @brief
+     * Moves Component value, memcpy used for trivially copyable types.
+     *
+     * @param pType - type info.
+     * @param pDst - destination (not initialized).
+     * @param pSrc - source, destroyed after move.
+     * @throws - no exceptions.
+    **/
+    static inline void MoveComponent( const ecs_ComponentTypeInfo& pType, void* const pDst, void* const pSrc ) noexcept
+    {
+        if ( pType.mTrivial )
+            std::memcpy( pDst, pSrc, pType.mSize );
+        else
+            pType.mMove( pDst, pSrc );
+    }
+
+    /**
+     * @brief
+     * Fills column range with copies of value.
+     * Trivial types are copied once & doubled, so range is filled in log2(count) memcpy calls.
+     *
+     * @param pType - type info.
+     * @param pDst - first element of range (not initialized).
+     * @param pCount - elements count.
+     * @param pValue - value, or null to fill with zeros.
+     * @throws - can throw exception from copy-constructor.
+    **/
+    static inline void FillComponents( const ecs_ComponentTypeInfo& pType, unsigned char* const pDst, const ecs_size_t pCount, const void* const pValue )
+    {
+        if ( pValue == nullptr )
+        {
+            std::memset( pDst, 0, pType.mSize * pCount );
+            return;
+        }
+
+        if ( !pType.mTrivial )
+        {
+            ecs_size_t i = 0;
+
+            try
+            {
+                for ( ; i < pCount; i++ )
+                    pType.mCopy( pDst + pType.mSize * i, pValue );
+            }
+            catch( ... )
+            {
+                while ( i > 0 )
+                    pType.mDestroy( pDst + pType.mSize * --i );
+
+                throw;
+            }
+
+            return;
+        }
+
+        std::memcpy( pDst, pValue, pType.mSize );
+
+        ecs_size_t filled = 1;
+
+        while ( filled < pCount )
+        {
+            const ecs_size_t copyCount = std::min( filled, pCount - filled );
+            std::memcpy( pDst + pType.mSize * filled, pDst, pType.mSize * copyCount );
+            filled += copyCount;
+        }
+    }
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    Archetype::Archetype( const ecs_uint32_t pIndex, const ecs_Signature& pSignature, bt_SlabAllocator& pAllocator, const ecs_atomic<ecs_uint32_t>& pTick )
+        : mIndex( pIndex ),
+          mTick( pTick ),
+          mSignature( pSignature ),
+          mAllocator( pAllocator ),
+          mTypes(),
+          mOffsets(),
+          mChunkCapacity( 0 ),
+          mChunks(),
+          mCount( 0 ),
+          mVersions(),
+          mDirtyWords( 0 ),
+          mDirtyRows(),
+          mAddEdges(),
+          mRemoveEdges()
+    {
+        for ( ecs_size_t i = 0; i < ECS_MAX_COMPONENT_TYPES; i++ )
+            mColumns[i] = NO_COLUMN;
+
+        ecs_size_t rowSize = sizeof( ecs_Handle );
+
+        mSignature.forEach( [&]( const ecs_TypeID pType )
+        {
+            const ecs_ComponentTypeInfo* const typeInfo = ecs_ComponentTypeInfo::Get( pType );
+
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+            ecs_assert( typeInfo != nullptr && "Archetype - Component type not registered." );
+#endif // DEBUG
+
+            // Tags are Signature bits only.
+            if ( typeInfo->mTag )
+                return;
+
+            mColumns[pType] = static_cast<ecs_int16_t>( mTypes.size() );
+            mTypes.push_back( typeInfo );
+            rowSize += typeInfo->mSize;
+        } );
+
+        mOffsets.resize( mTypes.size() );
+
+        // Columns are aligned, so capacity is decreased until all columns fit.
+        ecs_size_t capacity = ECS_ARCHETYPE_CHUNK_SIZE / rowSize;
+
+        while ( capacity > 0 )
+        {
+            ecs_size_t offset = sizeof( ecs_Handle ) * capacity;
+
+            for ( ecs_size_t i = 0; i < mTypes.size(); i++ )
+            {
+                const ecs_size_t align = mTypes[i]->mAlign > ECS_ARCHETYPE_COLUMN_ALIGN ? mTypes[i]->mAlign : ECS_ARCHETYPE_COLUMN_ALIGN;
+                offset = bt_VirtualMemory::RoundUp( offset, align );
+                mOffsets[i] = static_cast<ecs_uint32_t>( offset );
+                offset += mTypes[i]->mSize * capacity;
+            }
+
+            if ( offset <= ECS_ARCHETYPE_CHUNK_SIZE )
+                break;
+
+            capacity--;
+        }
+
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+        ecs_assert( capacity > 0 && "Archetype - Components too large for Chunk, increase ECS_ARCHETYPE_CHUNK_SIZE." );
+#endif // DEBUG
+
+        mChunkCapacity = static_cast<ecs_uint32_t>( capacity );
+        mDirtyWords = ( mChunkCapacity + 63 ) / 64;
+    }
+
+    Archetype::~Archetype() noexcept
+    {
+        Clear();
+    }
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    Archetype* Archetype::getAddEdge( const ecs_TypeID pType ) const noexcept
+    {
+        auto pos = mAddEdges.find( pType );
+        return pos == mAddEdges.cend() ? nullptr : pos->second;
+    }
+
+    Archetype* Archetype::getRemoveEdge( const ecs_TypeID pType ) const noexcept
+    {
+        auto pos = mRemoveEdges.find( pType );
+        return pos == mRemoveEdges.cend() ? nullptr : pos->second;
+    }
+
+    void Archetype::setEdge( const ecs_TypeID pType, Archetype* const pWith )
+    {
+        mAddEdges[pType] = pWith;
+        pWith->mRemoveEdges[pType] = this;
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void Archetype::AddChunk()
+    {
+        void* const data = mAllocator.Allocate();
+
+        if ( data == nullptr )
+            throw std::bad_alloc();
+
+        mChunks.push_back( ArchetypeChunk{ static_cast<unsigned char*>(data), 0, mTick.load(std::memory_order_relaxed) } );
+        mVersions.resize( mChunks.size() * mTypes.size(), ColumnVersion{ 0, 0 } );
+        mDirtyRows.resize( mChunks.size() * mTypes.size() * mDirtyWords, 0 );
+    }
+
+    ArchetypeRow Archetype::Allocate( const ecs_Handle pEntity )
+    {
+        if ( mChunks.empty() || mChunks.back().mCount >= mChunkCapacity )
+            AddChunk();
+
+        ArchetypeChunk& chunk = mChunks.back();
+        chunk.mVersion = mTick.load( std::memory_order_relaxed );
+        const ArchetypeRow row{ static_cast<ecs_uint32_t>(mChunks.size() - 1), chunk.mCount++ };
+
+        getEntities( chunk )[row.mRow] = pEntity;
+        mCount++;
+
+        // New row is changed in all columns.
+        for ( ecs_size_t i = 0; i < mTypes.size(); i++ )
+            MarkChanged( row, i );
+
+        return row;
+    }
+
+    void Archetype::AllocateBatch( const ecs_Handle* const pEntities, const ecs_size_t pCount, const void* const* const pValues, ArchetypeRow* const pRows )
+    {
+        const ecs_size_t chunksCount = mChunks.size();
+        const ecs_uint32_t lastCount = chunksCount > 0 ? mChunks.back().mCount : 0;
+        const ecs_uint32_t firstChunkIdx = static_cast<ecs_uint32_t>( chunksCount > 0 && lastCount < mChunkCapacity ? chunksCount - 1 : chunksCount );
+        ecs_uint32_t chunkIdx = firstChunkIdx;
+        ecs_uint32_t first = 0;
+        ecs_uint32_t count = 0;
+        ecs_size_t column = 0;
+        ecs_size_t done = 0;
+
+        try
+        {
+            // All Chunks are added before writing, so only Components copy can throw.
+            ecs_size_t capacity = chunksCount > 0 ? mChunkCapacity - lastCount : 0;
+
+            while ( capacity < pCount )
+            {
+                AddChunk();
+                capacity += mChunkCapacity;
+            }
+
+            for ( ; done < pCount; chunkIdx++ )
+            {
+                ArchetypeChunk& chunk = mChunks[chunkIdx];
+                first = chunk.mCount;
+                count = static_cast<ecs_uint32_t>( std::min<ecs_size_t>(mChunkCapacity - first, pCount - done) );
+                chunk.mVersion = mTick.load( std::memory_order_relaxed );
+
+                std::memcpy( getEntities(chunk) + first, pEntities + done, sizeof(ecs_Handle) * count );
+
+                for ( column = 0; column < mTypes.size(); column++ )
+                {
+                    const ecs_ComponentTypeInfo& typeInfo = *mTypes[column];
+
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+                    ecs_assert( ( typeInfo.mTrivial || (pValues != nullptr && pValues[column] != nullptr && typeInfo.mCopy != nullptr) ) && "Archetype::AllocateBatch - Component can't be zero-filled or copied." );
+#endif // DEBUG
+
+                    FillComponents( typeInfo, static_cast<unsigned char*>(getColumn(chunk, column)) + typeInfo.mSize * first, count, pValues == nullptr ? nullptr : pValues[column] );
+
+                    // Whole Chunk is versioned at once, if it was empty.
+                    if ( first == 0 )
+                    {
+                        MarkChanged( chunkIdx, column );
+                    }
+                    else
+                    {
+                        for ( ecs_uint32_t row = first; row < first + count; row++ )
+                            MarkChanged( ArchetypeRow{ chunkIdx, row }, column );
+                    }
+                }
+
+                for ( ecs_uint32_t row = 0; row < count; row++ )
+                    pRows[done + row] = ArchetypeRow{ chunkIdx, first + row };
+
+                chunk.mCount += count;
+                mCount += count;
+                done += count;
+            }
+        }
+        catch( ... )
+        {
+            // Failed Chunk: its rows are not counted, only previous columns are filled.
+            if ( chunkIdx < mChunks.size() )
+                DestroyRows( mChunks[chunkIdx], first, count, column );
+
+            // Filled Chunks.
+            for ( ecs_uint32_t idx = firstChunkIdx; idx < chunkIdx; idx++ )
+            {
+                ArchetypeChunk& chunk = mChunks[idx];
+                const ecs_uint32_t start = idx < chunksCount ? lastCount : 0;
+
+                DestroyRows( chunk, start, chunk.mCount - start, mTypes.size() );
+                mCount -= chunk.mCount - start;
+                chunk.mCount = start;
+            }
+
+            while ( mChunks.size() > chunksCount )
+            {
+                mAllocator.Deallocate( mChunks.back().mData );
+                mChunks.pop_back();
+            }
+
+            mVersions.resize( mChunks.size() * mTypes.size() );
+            mDirtyRows.resize( mChunks.size() * mTypes.size() * mDirtyWords );
+
+            // Removed rows bits must not leak to rows allocated later.
+            if ( firstChunkIdx < chunksCount )
+            {
+                for ( ecs_size_t i = 0; i < mTypes.size(); i++ )
+                {
+                    ecs_uint64_t* const dirty = mDirtyRows.data() + ( firstChunkIdx * mTypes.size() + i ) * mDirtyWords;
+
+                    for ( ecs_uint32_t row = lastCount; row < mChunkCapacity; row++ )
+                        dirty[row >> 6] &= ~( ecs_uint64_t(1) << (row & 63) );
+                }
+            }
+
+            throw;
+        }
+    }
+
+    void Archetype::DestroyRows( ArchetypeChunk& pChunk, const ecs_uint32_t pFirst, const ecs_uint32_t pCount, const ecs_size_t pColumns ) noexcept
+    {
+        for ( ecs_size_t i = 0; i < pColumns; i++ )
+        {
+            const ecs_ComponentTypeInfo& typeInfo = *mTypes[i];
+
+            if ( typeInfo.mTrivial )
+                continue;
+
+            unsigned char* const column = static_cast<unsigned char*>( getColumn(pChunk, i) );
+
+            for ( ecs_uint32_t row = pFirst; row < pFirst + pCount; row++ )
+                typeInfo.mDestroy( column + typeInfo.mSize * row );
+        }
+    }
+
+    ecs_Handle Archetype::Remove( const ArchetypeRow& pRow, const bool pDestroy ) noexcept
+    {
+        ArchetypeChunk& chunk = mChunks[pRow.mChunk];
+
+        if ( pDestroy )
+        {
+            for ( ecs_size_t i = 0; i < mTypes.size(); i++ )
+            {
+                if ( !mTypes[i]->mTrivial )
+                    mTypes[i]->mDestroy( getComponent(pRow, i) );
+            }
+        }
+
+        const ecs_uint32_t lastChunkIdx = static_cast<ecs_uint32_t>( mChunks.size() - 1 );
+        ArchetypeChunk& lastChunk = mChunks[lastChunkIdx];
+        const ArchetypeRow lastRow{ lastChunkIdx, lastChunk.mCount - 1 };
+        ecs_Handle moved;
+
+        if ( pRow.mChunk != lastRow.mChunk || pRow.mRow != lastRow.mRow )
+        {
+            for ( ecs_size_t i = 0; i < mTypes.size(); i++ )
+            {
+                MoveComponent( *mTypes[i], getComponent(pRow, i), getComponent(lastRow, i) );
+                MergeChanges( pRow, lastRow, i );
+            }
+
+            moved = getEntities( lastChunk )[lastRow.mRow];
+            getEntities( chunk )[pRow.mRow] = moved;
+        }
+
+        const ecs_uint32_t tick = mTick.load( std::memory_order_relaxed );
+        chunk.mVersion = tick;
+        lastChunk.mVersion = tick;
+        lastChunk.mCount--;
+        mCount--;
+
+        if ( lastChunk.mCount < 1 )
+        {
+            mAllocator.Deallocate( lastChunk.mData );
+            mChunks.pop_back();
+            mVersions.resize( mChunks.size() * mTypes.size() );
+            mDirtyRows.resize( mChunks.size() * mTypes.size() * mDirtyWords );
+        }
+        else
+        {
+            // Removed row bits must not leak to row allocated later.
+            for ( ecs_size_t i = 0; i < mTypes.size(); i++ )
+                mDirtyRows[( lastRow.mChunk * mTypes.size() + i ) * mDirtyWords + ( lastRow.mRow >> 6 )] &= ~( ecs_uint64_t(1) << (lastRow.mRow & 63) );
+        }
+
+        return moved;
+    }
+
+    ArchetypeRow Archetype::MoveTo( const ArchetypeRow& pRow, Archetype& pDst, ecs_Handle& pMoved )
+    {
+        const ecs_Handle entity = getEntities( mChunks[pRow.mChunk] )[pRow.mRow];
+        const ArchetypeRow dstRow = pDst.Allocate( entity );
+
+        for ( ecs_size_t i = 0; i < mTypes.size(); i++ )
+        {
+            void* const src = getComponent( pRow, i );
+            const ecs_int16_t dstColumn = pDst.getColumnIndex( mTypes[i]->mTypeID );
+
+            if ( dstColumn != NO_COLUMN )
+                MoveComponent( *mTypes[i], pDst.getComponent(dstRow, static_cast<ecs_size_t>(dstColumn)), src );
+            else if ( !mTypes[i]->mTrivial )
+                mTypes[i]->mDestroy( src );
+        }
+
+        pMoved = Remove( pRow, false );
+
+        return dstRow;
+    }
+
+    void Archetype::Clear() noexcept
+    {
+        for ( ArchetypeChunk& chunk : mChunks )
+        {
+            for ( ecs_size_t i = 0; i < mTypes.size(); i++ )
+            {
+                const ecs_ComponentTypeInfo& typeInfo = *mTypes[i];
+
+                if ( typeInfo.mTrivial )
+                    continue;
+
+                unsigned char* const column = static_cast<unsigned char*>( getColumn(chunk, i) );
+
+                for ( ecs_uint32_t row = 0; row < chunk.mCount; row++ )
+                    typeInfo.mDestroy( column + typeInfo.mSize * row );
+            }
+
+            mAllocator.Deallocate( chunk.mData );
+        }
+
+        mChunks.clear();
+        mVersions.clear();
+        mDirtyRows.clear();
+        mCount = 0;
+    }
+
+    void Archetype::MarkChanged( const ArchetypeRow& pRow, const ecs_size_t pColumn ) noexcept
+    {
+        const ecs_size_t index = pRow.mChunk * mTypes.size() + pColumn;
+        ColumnVersion& version = mVersions[index];
+        const ecs_uint32_t tick = mTick.load( std::memory_order_relaxed );
+        ecs_uint64_t* const dirty = mDirtyRows.data() + index * mDirtyWords;
+
+        // Rows bitset tracks changes of one tick.
+        if ( version.mVersion != tick )
+        {
+            version.mPrevVersion = version.mVersion;
+            version.mVersion = tick;
+
+            for ( ecs_uint32_t word = 0; word < mDirtyWords; word++ )
+                dirty[word] = 0;
+        }
+
+        dirty[pRow.mRow >> 6] |= ecs_uint64_t(1) << ( pRow.mRow & 63 );
+    }
+
+    bool Archetype::isTrivial() const noexcept
+    {
+        for ( const ecs_ComponentTypeInfo* const typeInfo : mTypes )
+        {
+            if ( !typeInfo->mTrivial )
+                return false;
+        }
+
+        return true;
+    }
+
+    ecs_uint32_t Archetype::getChunkVersion( const ecs_size_t pChunk ) const noexcept
+    {
+        ecs_uint32_t version = mChunks[pChunk].mVersion;
+
+        for ( ecs_size_t i = 0; i < mTypes.size(); i++ )
+            version = std::max( version, getVersion(pChunk, i) );
+
+        return version;
+    }
+
+    void Archetype::ResizeChunks( const ecs_size_t pCount )
+    {
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+        ecs_assert( ( mCount < 1 || isTrivial() ) && "Archetype::ResizeChunks - Components must be trivial." );
+#endif // DEBUG
+
+        while ( mChunks.size() > pCount )
+        {
+            mCount -= mChunks.back().mCount;
+            mAllocator.Deallocate( mChunks.back().mData );
+            mChunks.pop_back();
+        }
+
+        mVersions.resize( mChunks.size() * mTypes.size() );
+        mDirtyRows.resize( mChunks.size() * mTypes.size() * mDirtyWords );
+
+        while ( mChunks.size() < pCount )
+            AddChunk();
+    }
+
+    void Archetype::RestoreChunk( const ecs_size_t pChunk, const void* const pData, const ecs_uint32_t pCount ) noexcept
+    {
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+        ecs_assert( isTrivial() && "Archetype::RestoreChunk - Components must be trivial." );
+#endif // DEBUG
+
+        ArchetypeChunk& chunk = mChunks[pChunk];
+
+        std::memcpy( chunk.mData, pData, ECS_ARCHETYPE_CHUNK_SIZE );
+        mCount = mCount - chunk.mCount + pCount;
+        chunk.mCount = pCount;
+        chunk.mVersion = mTick.load( std::memory_order_relaxed );
+
+        for ( ecs_size_t i = 0; i < mTypes.size(); i++ )
+        {
+            ecs_uint64_t* const dirty = mDirtyRows.data() + ( pChunk * mTypes.size() + i ) * mDirtyWords;
+
+            for ( ecs_uint32_t word = 0; word < mDirtyWords; word++ )
+                dirty[word] = 0;
+
+            MarkChanged( pChunk, i );
+        }
+    }
+
+    void Archetype::MergeChanges( const ArchetypeRow& pDst, const ArchetypeRow& pSrc, const ecs_size_t pColumn ) noexcept
+    {
+        const ecs_size_t dstIndex = pDst.mChunk * mTypes.size() + pColumn;
+        const ecs_size_t srcIndex = pSrc.mChunk * mTypes.size() + pColumn;
+        ColumnVersion& dst = mVersions[dstIndex];
+        const ColumnVersion src = mVersions[srcIndex];
+        ecs_uint64_t* const dstDirty = mDirtyRows.data() + dstIndex * mDirtyWords;
+        ecs_uint64_t* const srcDirty = mDirtyRows.data() + srcIndex * mDirtyWords;
+
+        const ecs_uint64_t srcMask = ecs_uint64_t(1) << ( pSrc.mRow & 63 );
+        const ecs_uint64_t dstMask = ecs_uint64_t(1) << ( pDst.mRow & 63 );
+        const bool srcDirtyRow = ( srcDirty[pSrc.mRow >> 6] & srcMask ) != 0;
+
+        srcDirty[pSrc.mRow >> 6] &= ~srcMask;
+        dstDirty[pDst.mRow >> 6] &= ~dstMask;
+
+        if ( src.mVersion == dst.mVersion )
+        {
+            // Same tick: row bit is exact.
+            dst.mPrevVersion = std::max( dst.mPrevVersion, src.mPrevVersion );
+
+            if ( srcDirtyRow )
+                dstDirty[pDst.mRow >> 6] |= dstMask;
+        }
+        else if ( src.mVersion < dst.mVersion )
+        {
+            // Row changed before destination tick, can't be tracked per row.
+            dst.mPrevVersion = std::max( dst.mPrevVersion, src.mVersion );
+        }
+        else
+        {
+            // Destination rows changed before source tick.
+            dst.mPrevVersion = std::max( dst.mVersion, src.mPrevVersion );
+            dst.mVersion = src.mVersion;
+
+            for ( ecs_uint32_t word = 0; word < mDirtyWords; word++ )
+                dstDirty[word] = 0;
+
+            if ( srcDirtyRow )
+                dstDirty[pDst.mRow >> 6] |= dstMask;
+        }
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
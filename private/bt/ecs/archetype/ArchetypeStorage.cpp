@@ -0,0 +1,718 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../../../../public/bt/ecs/archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include ecs::HierarchyStore
+#ifndef ECS_HIERARCHY_STORE_HPP
+#include "../../../../public/bt/ecs/hierarchy/HierarchyStore.hpp"
+#endif // !ECS_HIERARCHY_STORE_HPP
+
+// Include ecs::EntityRegistry
+#ifndef ECS_ENTITY_REGISTRY_HPP
+#include "../../../../public/bt/ecs/entity/EntityRegistry.hpp"
+#endif // !ECS_ENTITY_REGISTRY_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// Include C++ cstring
+#include <cstring>
+
+// Include C++ functional
+#include <functional>
+
+// ===========================================================
+// ecs::ArchetypeStorage
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTANTS
+    // ===========================================================
+
+    constexpr const ecs_uint32_t ArchetypeStorage::NO_SLOT;
+
+    // ===========================================================
+    // FIELDS
+    // ===========================================================
+
+    /** Placeholder memory, returned by Attach for tags (empty types, nothing is stored). **/
+    static unsigned char gTagMemory = 0;
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    /**
+     * @brief
+     * Move-constructs column value from constructed Component & destroys source.
+     *
+     * @param pType - type info.
+     * @param pDst - column memory (not initialized).
+     * @param pSrc - constructed Component, destroyed after move.
+     * @throws - no exceptions.
+    **/
+    static inline void MoveValue( const ecs_ComponentTypeInfo& pType, void* const pDst, void* const pSrc ) noexcept
+    {
+        if ( pType.mTrivial )
+            std::memcpy( pDst, pSrc, pType.mSize );
+        else
+            pType.mMove( pDst, pSrc );
+    }
+
+    /**
+     * @brief
+     * Destroys Component, which was not attached.
+     *
+     * @param pType - type info.
+     * @param pValue - constructed Component, or null for tag.
+     * @throws - no exceptions.
+    **/
+    static inline void ReleaseValue( const ecs_ComponentTypeInfo& pType, void* const pValue ) noexcept
+    {
+        if ( pValue != nullptr && !pType.mTrivial )
+            pType.mDestroy( pValue );
+    }
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    ArchetypeStorage::ArchetypeStorage( const ecs_size_t pReserve )
+        : mChunkAllocator( ECS_ARCHETYPE_CHUNK_SIZE, pReserve ),
+          mTick( 1 ),
+          mArchetypes(),
+          mSignatures(),
+          mRoot( nullptr ),
+          mLocations(),
+          mGenerations(),
+          mFreeSlots(),
+          mCount( 0 ),
+          mReserved( 0 ),
+          mObservers(),
+          mHierarchy(),
+          mRegistry( nullptr )
+    {
+        mRoot = getArchetype( ecs_Signature() );
+    }
+
+    ArchetypeStorage::~ArchetypeStorage() noexcept
+    {
+        // Archetypes must release Chunks before allocator.
+        mArchetypes.clear();
+    }
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    ecs_Archetype* ArchetypeStorage::getArchetype( const ecs_Signature& pSignature )
+    {
+        auto pos = mSignatures.find( pSignature );
+
+        if ( pos != mSignatures.cend() )
+            return pos->second;
+
+        ecs_sptr<ecs_Archetype> archetype = ecs_Shared<ecs_Archetype>( static_cast<ecs_uint32_t>(mArchetypes.size()), pSignature, mChunkAllocator, mTick );
+        mArchetypes.push_back( archetype );
+        mSignatures[pSignature] = archetype.get();
+
+        return archetype.get();
+    }
+
+    ecs_Archetype* ArchetypeStorage::getEdge( ecs_Archetype* const pSrc, const ecs_TypeID pType, const bool pAdd )
+    {
+        ecs_Archetype* dst = pAdd ? pSrc->getAddEdge( pType ) : pSrc->getRemoveEdge( pType );
+
+        if ( dst != nullptr )
+            return dst;
+
+        ecs_Signature signature = pSrc->getSignature();
+
+        if ( pAdd )
+        {
+            signature.Set( pType );
+            dst = getArchetype( signature );
+            pSrc->setEdge( pType, dst );
+        }
+        else
+        {
+            signature.Reset( pType );
+            dst = getArchetype( signature );
+            dst->setEdge( pType, pSrc );
+        }
+
+        return dst;
+    }
+
+    void* ArchetypeStorage::getComponent( const ecs_Handle pEntity, const ecs_TypeID pType ) const noexcept
+    {
+        if ( !isAlive(pEntity) )
+            return nullptr;
+
+        const EntityLocation& location = mLocations[pEntity.getIndex()];
+        const ecs_int16_t column = location.mArchetype->getColumnIndex( pType );
+
+        if ( column == ecs_Archetype::NO_COLUMN )
+            return nullptr;
+
+        return location.mArchetype->getComponent( location.mRow, static_cast<ecs_size_t>(column) );
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void ArchetypeStorage::Move( EntityLocation& pLocation, ecs_Archetype* const pDst )
+    {
+        ecs_Handle moved;
+        const ecs_ArchetypeRow row = pLocation.mArchetype->MoveTo( pLocation.mRow, *pDst, moved );
+
+        if ( moved.isValid() )
+            mLocations[moved.getIndex()].mRow = pLocation.mRow;
+
+        pLocation.mArchetype = pDst;
+        pLocation.mRow = row;
+    }
+
+    void ArchetypeStorage::SpawnInto( ecs_Archetype* const pArchetype, const ecs_size_t pCount, const void* const* const pValues, ecs_Handle* const pEntities )
+    {
+        if ( mReserved.load(std::memory_order_relaxed) > 0 )
+            FlushReserved();
+
+        const ecs_size_t reused = std::min( pCount, mFreeSlots.size() );
+        const ecs_uint32_t first = static_cast<ecs_uint32_t>( mLocations.size() );
+
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+        ecs_assert( first + (pCount - reused) <= NO_SLOT && "ArchetypeStorage::spawnBatch - out of Handles." );
+#endif // DEBUG
+
+        ecs_vec<ecs_ArchetypeRow> rows( pCount );
+
+        mLocations.resize( first + (pCount - reused), EntityLocation{ nullptr, ecs_ArchetypeRow{ 0, 0 } } );
+        mGenerations.resize( first + (pCount - reused), 0 );
+
+        for ( ecs_size_t i = 0; i < reused; i++ )
+        {
+            const ecs_uint32_t slot = mFreeSlots[mFreeSlots.size() - 1 - i];
+            pEntities[i] = ecs_Handle::Make( slot, mGenerations[slot] );
+        }
+
+        for ( ecs_size_t i = reused; i < pCount; i++ )
+            pEntities[i] = ecs_Handle::Make( first + static_cast<ecs_uint32_t>(i - reused), 0 );
+
+        try
+        {
+            pArchetype->AllocateBatch( pEntities, pCount, pValues, rows.data() );
+        }
+        catch( ... )
+        {
+            mLocations.resize( first );
+            mGenerations.resize( first );
+            throw;
+        }
+
+        mFreeSlots.resize( mFreeSlots.size() - reused );
+
+        for ( ecs_size_t i = 0; i < pCount; i++ )
+            mLocations[pEntities[i].getIndex()] = EntityLocation{ pArchetype, rows[i] };
+
+        mCount += pCount;
+    }
+
+    ecs_Handle ArchetypeStorage::Create()
+    {
+        // Reserved Handles use slots after last one.
+        if ( mReserved.load(std::memory_order_relaxed) > 0 )
+            FlushReserved();
+
+        ecs_uint32_t slot;
+
+        if ( !mFreeSlots.empty() )
+        {
+            slot = mFreeSlots.back();
+            mFreeSlots.pop_back();
+        }
+        else
+        {
+            slot = static_cast<ecs_uint32_t>( mLocations.size() );
+
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+            ecs_assert( slot < NO_SLOT && "ArchetypeStorage::Create - out of Handles." );
+#endif // DEBUG
+
+            mLocations.push_back( EntityLocation{ nullptr, ecs_ArchetypeRow{ 0, 0 } } );
+            mGenerations.push_back( 0 );
+        }
+
+        const ecs_Handle entity = ecs_Handle::Make( slot, mGenerations[slot] );
+        EntityLocation& location = mLocations[slot];
+
+        location.mRow = mRoot->Allocate( entity );
+        location.mArchetype = mRoot;
+        mCount++;
+
+        return entity;
+    }
+
+    ecs_Handle ArchetypeStorage::Reserve() noexcept
+    {
+        const ecs_uint32_t slot = static_cast<ecs_uint32_t>( mLocations.size() ) + mReserved.fetch_add( 1, std::memory_order_relaxed );
+
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+        ecs_assert( slot < NO_SLOT && "ArchetypeStorage::Reserve - out of Handles." );
+#endif // DEBUG
+
+        return ecs_Handle::Make( slot, 0 );
+    }
+
+    void ArchetypeStorage::FlushReserved()
+    {
+        const ecs_uint32_t reserved = mReserved.exchange( 0, std::memory_order_acq_rel );
+
+        if ( reserved == 0 )
+            return;
+
+        const ecs_uint32_t first = static_cast<ecs_uint32_t>( mLocations.size() );
+        mLocations.resize( first + reserved, EntityLocation{ nullptr, ecs_ArchetypeRow{ 0, 0 } } );
+        mGenerations.resize( first + reserved, 0 );
+
+        for ( ecs_uint32_t slot = first; slot < first + reserved; slot++ )
+        {
+            EntityLocation& location = mLocations[slot];
+            location.mRow = mRoot->Allocate( ecs_Handle::Make(slot, 0) );
+            location.mArchetype = mRoot;
+        }
+
+        mCount += reserved;
+    }
+
+    bool ArchetypeStorage::Destroy( const ecs_Handle pEntity )
+    {
+        if ( !isAlive(pEntity) )
+            return false;
+
+        const ecs_uint32_t slot = pEntity.getIndex();
+        EntityLocation& location = mLocations[slot];
+
+        mObservers.Record( EObserverEvents::OnRemove, location.mArchetype->getSignature(), &pEntity, 1 );
+        const ecs_Handle moved = location.mArchetype->Remove( location.mRow, true );
+
+        if ( mHierarchy != nullptr )
+            mHierarchy->Remove( pEntity );
+
+        if ( moved.isValid() )
+            mLocations[moved.getIndex()].mRow = location.mRow;
+
+        location.mArchetype = nullptr;
+        mGenerations[slot]++;
+        mFreeSlots.push_back( slot );
+        mCount--;
+
+        return true;
+    }
+
+    bool ArchetypeStorage::spawnBatch( const ecs_Handle pPrefab, const ecs_size_t pCount, ecs_Handle* const pEntities )
+    {
+        if ( !isAlive(pPrefab) )
+            return false;
+
+        const EntityLocation location = mLocations[pPrefab.getIndex()];
+        ecs_Archetype* const archetype = location.mArchetype;
+        const ecs_size_t columnsCount = archetype->getColumnsCount();
+        ecs_vec<const void*> values( columnsCount );
+
+        for ( ecs_size_t i = 0; i < columnsCount; i++ )
+        {
+            const ecs_ComponentTypeInfo& typeInfo = archetype->getColumnType( i );
+
+            if ( !typeInfo.mTrivial && typeInfo.mCopy == nullptr )
+                return false;
+
+            // Chunks data is not moved, so prefab values stay valid while rows are appended.
+            values[i] = archetype->getComponent( location.mRow, i );
+        }
+
+        if ( pCount > 0 )
+        {
+            SpawnInto( archetype, pCount, values.data(), pEntities );
+            mObservers.Record( EObserverEvents::OnAdd, archetype->getSignature(), pEntities, pCount );
+            NotifyObservers();
+        }
+
+        return true;
+    }
+
+    bool ArchetypeStorage::spawnBatch( const ecs_Signature& pSignature, const ecs_size_t pCount, ecs_Handle* const pEntities )
+    {
+        ecs_Archetype* const archetype = getArchetype( pSignature );
+        const ecs_size_t columnsCount = archetype->getColumnsCount();
+
+        for ( ecs_size_t i = 0; i < columnsCount; i++ )
+        {
+            if ( !archetype->getColumnType(i).mTrivial )
+                return false;
+        }
+
+        if ( pCount > 0 )
+        {
+            SpawnInto( archetype, pCount, nullptr, pEntities );
+            mObservers.Record( EObserverEvents::OnAdd, pSignature, pEntities, pCount );
+            NotifyObservers();
+        }
+
+        return true;
+    }
+
+    ecs_size_t ArchetypeStorage::destroyBatch( const ecs_Handle* const pEntities, const ecs_size_t pCount )
+    {
+        // Sort key: Archetype, Chunk & row, see ecs::CommandQueue.
+        ecs_vec<ecs_uint64_t> keys;
+        keys.reserve( pCount );
+
+        for ( ecs_size_t i = 0; i < pCount; i++ )
+        {
+            if ( !isAlive(pEntities[i]) )
+                continue;
+
+            const EntityLocation& location = mLocations[pEntities[i].getIndex()];
+            keys.push_back( ( static_cast<ecs_uint64_t>(location.mArchetype->getIndex()) << 40 )
+                          | ( static_cast<ecs_uint64_t>(location.mRow.mChunk) << 16 )
+                          | static_cast<ecs_uint64_t>(location.mRow.mRow) );
+        }
+
+        // Duplicates are removed, last rows first.
+        std::sort( keys.begin(), keys.end(), std::greater<ecs_uint64_t>() );
+        keys.erase( std::unique(keys.begin(), keys.end()), keys.end() );
+        mFreeSlots.reserve( mFreeSlots.size() + keys.size() );
+
+        for ( const ecs_uint64_t key : keys )
+        {
+            ecs_Archetype* const archetype = mArchetypes[static_cast<ecs_size_t>(key >> 40)].get();
+            const ecs_ArchetypeRow row{ static_cast<ecs_uint32_t>( (key >> 16) & 0xFFFFFF ), static_cast<ecs_uint32_t>( key & 0xFFFF ) };
+            const ecs_Handle entity = archetype->getEntities( archetype->getChunk(row.mChunk) )[row.mRow];
+            const ecs_uint32_t slot = entity.getIndex();
+
+            mObservers.Record( EObserverEvents::OnRemove, archetype->getSignature(), &entity, 1 );
+
+            const ecs_Handle moved = archetype->Remove( row, true );
+
+            if ( moved.isValid() )
+                mLocations[moved.getIndex()].mRow = row;
+
+            if ( mHierarchy != nullptr )
+                mHierarchy->Remove( entity );
+
+            mLocations[slot].mArchetype = nullptr;
+            mGenerations[slot]++;
+            mFreeSlots.push_back( slot );
+        }
+
+        mCount -= keys.size();
+        NotifyObservers();
+
+        return keys.size();
+    }
+
+    void* ArchetypeStorage::Attach( const ecs_Handle pEntity, const ecs_TypeID pType, void* const pValue )
+    {
+        // Not registered Type-ID has no column layout (covers out of range Type-ID).
+        const ecs_ComponentTypeInfo* const typeInfo = ecs_ComponentTypeInfo::Get( pType );
+
+        if ( typeInfo == nullptr )
+            return nullptr;
+
+        // Value is consumed on every path: moved to column, or destroyed.
+        if ( !isAlive(pEntity) )
+        {
+            ReleaseValue( *typeInfo, pValue );
+            return nullptr;
+        }
+
+        EntityLocation& location = mLocations[pEntity.getIndex()];
+        ecs_int16_t column = location.mArchetype->getColumnIndex( pType );
+
+        // Tag already attached.
+        if ( column == ecs_Archetype::NO_COLUMN && location.mArchetype->hasType(pType) )
+        {
+            ReleaseValue( *typeInfo, pValue );
+            return &gTagMemory;
+        }
+
+        if ( column != ecs_Archetype::NO_COLUMN )
+        {
+            void* const memory = location.mArchetype->getComponent( location.mRow, static_cast<ecs_size_t>(column) );
+
+            // Old value is destroyed only when new one is already constructed.
+            if ( !typeInfo->mTrivial )
+                typeInfo->mDestroy( memory );
+
+            MoveValue( *typeInfo, memory, pValue );
+            location.mArchetype->MarkChanged( location.mRow, static_cast<ecs_size_t>(column) );
+            mObservers.Record( EObserverEvents::OnSet, pType, pEntity );
+
+            return memory;
+        }
+
+        // Move allocates destination row before Components are moved, so nothing is changed if it throws.
+        try
+        {
+            Move( location, getEdge(location.mArchetype, pType, true) );
+        }
+        catch( ... )
+        {
+            ReleaseValue( *typeInfo, pValue );
+            throw;
+        }
+
+        column = location.mArchetype->getColumnIndex( pType );
+        mObservers.Record( EObserverEvents::OnAdd, pType, pEntity );
+
+        if ( column == ecs_Archetype::NO_COLUMN )
+        {
+            ReleaseValue( *typeInfo, pValue );
+            return &gTagMemory;
+        }
+
+        void* const memory = location.mArchetype->getComponent( location.mRow, static_cast<ecs_size_t>(column) );
+        MoveValue( *typeInfo, memory, pValue );
+
+        return memory;
+    }
+
+    bool ArchetypeStorage::Detach( const ecs_Handle pEntity, const ecs_TypeID pType )
+    {
+        if ( !hasComponent(pEntity, pType) )
+            return false;
+
+        EntityLocation& location = mLocations[pEntity.getIndex()];
+        Move( location, getEdge(location.mArchetype, pType, false) );
+        mObservers.Record( EObserverEvents::OnRemove, pType, pEntity );
+
+        return true;
+    }
+
+    bool ArchetypeStorage::MarkChanged( const ecs_Handle pEntity, const ecs_TypeID pType )
+    {
+        if ( !isAlive(pEntity) )
+            return false;
+
+        const EntityLocation& location = mLocations[pEntity.getIndex()];
+        const ecs_int16_t column = location.mArchetype->getColumnIndex( pType );
+
+        if ( column == ecs_Archetype::NO_COLUMN )
+            return false;
+
+        location.mArchetype->MarkChanged( location.mRow, static_cast<ecs_size_t>(column) );
+        mObservers.Record( EObserverEvents::OnSet, pType, pEntity );
+
+        return true;
+    }
+
+    bool ArchetypeStorage::Capture( ecs_StorageSnapshot& pDst, const ecs_StorageSnapshot* const pPrev )
+    {
+        if ( mReserved.load(std::memory_order_relaxed) > 0 )
+            FlushReserved();
+
+        for ( const ecs_sptr<ecs_Archetype>& archetype : mArchetypes )
+        {
+            if ( archetype->Count() > 0 && !archetype->isTrivial() )
+                return false;
+        }
+
+        const ecs_size_t archetypesCount = mArchetypes.size();
+        pDst.mChunks.resize( archetypesCount );
+
+        for ( ecs_size_t i = 0; i < archetypesCount; i++ )
+        {
+            const ecs_Archetype& archetype = *mArchetypes[i];
+            const ecs_vec<ecs_SnapshotChunk>* const prevChunks = pPrev != nullptr && i < pPrev->mChunks.size() ? &pPrev->mChunks[i] : nullptr;
+            const ecs_size_t chunksCount = archetype.getChunksCount();
+            ecs_vec<ecs_SnapshotChunk>& chunks = pDst.mChunks[i];
+
+            chunks.resize( chunksCount );
+
+            for ( ecs_size_t chunkIdx = 0; chunkIdx < chunksCount; chunkIdx++ )
+            {
+                const ecs_ArchetypeChunk& chunk = archetype.getChunk( chunkIdx );
+                ecs_SnapshotChunk& dst = chunks[chunkIdx];
+                dst.mCount = chunk.mCount;
+
+                // Copy-on-write: Chunk not changed since previous snapshot.
+                if ( prevChunks != nullptr && chunkIdx < prevChunks->size() && archetype.getChunkVersion(chunkIdx) <= pPrev->mTick )
+                {
+                    dst.mPage = (*prevChunks)[chunkIdx].mPage;
+                    continue;
+                }
+
+                // Page is reused if not shared with other snapshots.
+                if ( dst.mPage == nullptr || dst.mPage.use_count() > 1 )
+                    dst.mPage = ecs_Shared<ecs_SnapshotPage>();
+
+                std::memcpy( dst.mPage->mData, chunk.mData, ECS_ARCHETYPE_CHUNK_SIZE );
+            }
+        }
+
+        const ecs_size_t slotsCount = mLocations.size();
+        pDst.mLocations.resize( slotsCount );
+
+        for ( ecs_size_t slot = 0; slot < slotsCount; slot++ )
+        {
+            const EntityLocation& location = mLocations[slot];
+            pDst.mLocations[slot] = ecs_SnapshotLocation{ location.mArchetype == nullptr ? ecs_StorageSnapshot::NO_ARCHETYPE : location.mArchetype->getIndex(), location.mRow };
+        }
+
+        pDst.mGenerations = mGenerations;
+        pDst.mFreeSlots = mFreeSlots;
+        pDst.mCount = mCount;
+
+        if ( mHierarchy != nullptr )
+            mHierarchy->Capture( pDst );
+        else
+        {
+            pDst.mHierarchy.clear();
+            pDst.mHierarchyParents.clear();
+        }
+
+        if ( mRegistry != nullptr )
+            mRegistry->Capture( pDst );
+        else
+        {
+            pDst.mRegistry.clear();
+            pDst.mRegistryMasks.clear();
+        }
+
+        pDst.mTick = AdvanceTick();
+
+        return true;
+    }
+
+    void ArchetypeStorage::Restore( const ecs_StorageSnapshot& pSrc )
+    {
+        // Archetypes are never removed, so snapshot Archetypes still exist.
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+        ecs_assert( pSrc.mChunks.size() <= mArchetypes.size() && "ArchetypeStorage::Restore - snapshot of another storage." );
+#endif // DEBUG
+
+        mReserved.store( 0, std::memory_order_relaxed );
+
+        // Recorded changes refer to discarded state.
+        mObservers.Clear();
+
+        const ecs_size_t archetypesCount = mArchetypes.size();
+
+        for ( ecs_size_t i = 0; i < archetypesCount; i++ )
+        {
+            ecs_Archetype& archetype = *mArchetypes[i];
+
+            // Archetypes with not trivial Components are empty in snapshot.
+            if ( !archetype.isTrivial() )
+            {
+                archetype.Clear();
+                continue;
+            }
+
+            if ( i >= pSrc.mChunks.size() )
+            {
+                archetype.ResizeChunks( 0 );
+                continue;
+            }
+
+            const ecs_vec<ecs_SnapshotChunk>& chunks = pSrc.mChunks[i];
+            archetype.ResizeChunks( chunks.size() );
+
+            for ( ecs_size_t chunkIdx = 0; chunkIdx < chunks.size(); chunkIdx++ )
+                archetype.RestoreChunk( chunkIdx, chunks[chunkIdx].mPage->mData, chunks[chunkIdx].mCount );
+        }
+
+        const ecs_size_t slotsCount = pSrc.mLocations.size();
+        mLocations.resize( slotsCount );
+
+        for ( ecs_size_t slot = 0; slot < slotsCount; slot++ )
+        {
+            const ecs_SnapshotLocation& location = pSrc.mLocations[slot];
+            mLocations[slot] = EntityLocation{ location.mArchetype == ecs_StorageSnapshot::NO_ARCHETYPE ? nullptr : mArchetypes[location.mArchetype].get(), location.mRow };
+        }
+
+        mGenerations = pSrc.mGenerations;
+        mFreeSlots = pSrc.mFreeSlots;
+        mCount = pSrc.mCount;
+
+        // Links & masks of Entities, destroyed or created after snapshot.
+        if ( mHierarchy != nullptr )
+            mHierarchy->Restore( pSrc );
+
+        if ( mRegistry != nullptr )
+            mRegistry->Restore( pSrc );
+    }
+
+    void ArchetypeStorage::Clear() noexcept
+    {
+        mObservers.Clear();
+
+        if ( mHierarchy != nullptr )
+            mHierarchy->Clear();
+
+        for ( ecs_sptr<ecs_Archetype>& archetype : mArchetypes )
+            archetype->Clear();
+
+        for ( ecs_uint32_t slot = 0; slot < mLocations.size(); slot++ )
+        {
+            if ( mLocations[slot].mArchetype == nullptr )
+                continue;
+
+            mLocations[slot].mArchetype = nullptr;
+            mGenerations[slot]++;
+            mFreeSlots.push_back( slot );
+        }
+
+        mCount = 0;
+        mChunkAllocator.Trim();
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
@@ -0,0 +1,220 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_COMPONENT_OBSERVERS_HPP
+#include "../../../../public/bt/ecs/archetype/ComponentObservers.hpp"
+#endif // !ECS_COMPONENT_OBSERVERS_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// DEBUG
+#if defined( DEBUG ) || defined( BT_DEBUG )
+
+// Include ecs::assert
+#ifndef ECS_ASSERT_HPP
+#include "../../../../public/bt/ecs/types/ecs_assert.hpp"
+#endif // !ECS_ASSERT_HPP
+
+#endif
+// DEBUG
+
+// ===========================================================
+// ecs::ComponentObservers
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTANTS
+    // ===========================================================
+
+    constexpr const ecs_size_t ComponentObservers::EVENTS;
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    ComponentObservers::ComponentObservers() noexcept
+        : mObserved(),
+          mTypes(),
+          mPending(),
+          mNotifyTypes(),
+          mNotifyHandles(),
+          mNotifyRuns()
+    {
+    }
+
+    ComponentObservers::~ComponentObservers() noexcept = default;
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void ComponentObservers::Append( const EObserverEvents pEvent, const ecs_TypeID pType, const ecs_Handle* const pEntities, const ecs_size_t pCount )
+    {
+        TypeObservers& type = mTypes[pType];
+
+        if ( type.mHandles.empty() )
+            mPending.push_back( pType );
+
+        type.mHandles.insert( type.mHandles.end(), pEntities, pEntities + pCount );
+
+        const ecs_uint32_t end = static_cast<ecs_uint32_t>( type.mHandles.size() );
+
+        // Same event continues last run.
+        if ( !type.mRuns.empty() && type.mRuns.back().mEvent == pEvent )
+            type.mRuns.back().mEnd = end;
+        else
+            type.mRuns.push_back( Run{ pEvent, end } );
+    }
+
+    void ComponentObservers::Subscribe( const EObserverEvents pEvent, const ecs_TypeID pType, const observer_fn pFunction, void* const pUser )
+    {
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+        ecs_assert( pType < ECS_MAX_COMPONENT_TYPES && pFunction != nullptr && "ComponentObservers::Subscribe - invalid Type-ID or function." );
+#endif // DEBUG
+
+        if ( mTypes.size() <= pType )
+            mTypes.resize( pType + 1 );
+
+        mTypes[pType].mObservers[static_cast<ecs_size_t>(pEvent)].push_back( Observer{ pFunction, pUser } );
+        mObserved[static_cast<ecs_size_t>(pEvent)].Set( pType );
+    }
+
+    void ComponentObservers::Unsubscribe( const EObserverEvents pEvent, const ecs_TypeID pType, const observer_fn pFunction, void* const pUser ) noexcept
+    {
+        if ( !isObserved(pEvent, pType) )
+            return;
+
+        ecs_vec<Observer>& observers = mTypes[pType].mObservers[static_cast<ecs_size_t>(pEvent)];
+
+        auto pos = std::find_if( observers.begin(), observers.end(), [pFunction, pUser]( const Observer& pObserver )
+        { return pObserver.mFunction == pFunction && pObserver.mUser == pUser; } );
+
+        if ( pos == observers.end() )
+            return;
+
+        observers.erase( pos );
+
+        if ( observers.empty() )
+            mObserved[static_cast<ecs_size_t>(pEvent)].Reset( pType );
+    }
+
+    void ComponentObservers::Record( const EObserverEvents pEvent, const ecs_Signature& pSignature, const ecs_Handle* const pEntities, const ecs_size_t pCount )
+    {
+        if ( pCount == 0 || !isObserved(pEvent, pSignature) )
+            return;
+
+        pSignature.forEach( [&]( const ecs_TypeID pType )
+        {
+            if ( isObserved(pEvent, pType) )
+                Append( pEvent, pType, pEntities, pCount );
+        } );
+    }
+
+    void ComponentObservers::Notify( ecs_ArchetypeStorage& pStorage )
+    {
+        if ( mPending.empty() )
+            return;
+
+        // Observers can record new events, they are kept for next call.
+        mNotifyTypes.swap( mPending );
+
+        for ( ecs_size_t i = 0; i < mNotifyTypes.size(); i++ )
+        {
+            const ecs_TypeID typeID = mNotifyTypes[i];
+
+            mNotifyHandles.swap( mTypes[typeID].mHandles );
+            mNotifyRuns.swap( mTypes[typeID].mRuns );
+
+            try
+            {
+                ecs_uint32_t begin = 0;
+
+                for ( const Run& run : mNotifyRuns )
+                {
+                    const ecs_size_t event = static_cast<ecs_size_t>( run.mEvent );
+
+                    // Observer can subscribe (mTypes can grow) or unsubscribe, so observers are indexed each time.
+                    for ( ecs_size_t observer = 0; observer < mTypes[typeID].mObservers[event].size(); observer++ )
+                    {
+                        const Observer current = mTypes[typeID].mObservers[event][observer];
+                        current.mFunction( pStorage, mNotifyHandles.data() + begin, run.mEnd - begin, current.mUser );
+                    }
+
+                    begin = run.mEnd;
+                }
+            }
+            catch( ... )
+            {
+                // Types, not notified yet, are pending again.
+                mPending.insert( mPending.end(), mNotifyTypes.begin() + i + 1, mNotifyTypes.end() );
+                mNotifyTypes.clear();
+                mNotifyHandles.clear();
+                mNotifyRuns.clear();
+                throw;
+            }
+
+            mNotifyHandles.clear();
+            mNotifyRuns.clear();
+        }
+
+        mNotifyTypes.clear();
+    }
+
+    void ComponentObservers::Clear() noexcept
+    {
+        for ( const ecs_TypeID typeID : mPending )
+        {
+            mTypes[typeID].mHandles.clear();
+            mTypes[typeID].mRuns.clear();
+        }
+
+        mPending.clear();
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,624 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::World
+#ifndef ECS_WORLD_HPP
+#include "../../../../public/bt/ecs/world/World.hpp"
+#endif // !ECS_WORLD_HPP
+
+// Include ecs::EntitiesManager
+#ifndef ECS_ENTITIES_MANAGER_HPP
+#include "../../../../public/bt/ecs/entity/EntitiesManager.hpp"
+#endif // !ECS_ENTITIES_MANAGER_HPP
+
+// Include ecs::Entity
+#ifndef ECS_ENTITY_HPP
+#include "../../../../public/bt/ecs/entity/Entity.hpp"
+#endif // !ECS_ENTITY_HPP
+
+// Include ecs::ComponentsManager
+#ifndef ECS_COMPONENTS_MANAGER_HPP
+#include "../../../../public/bt/ecs/component/ComponentsManager.hpp"
+#endif // !ECS_COMPONENTS_MANAGER_HPP
+
+// Include ecs::Component
+#ifndef ECS_COMPONENT_HPP
+#include "../../../../public/bt/ecs/component/Component.hpp"
+#endif // !ECS_COMPONENT_HPP
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../../../../public/bt/ecs/archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include ecs::EventsManager
+#ifndef ECS_EVENTS_MANAGER_HPP
+#include "../../../../public/bt/ecs/event/EventsManager.hpp"
+#endif // !ECS_EVENTS_MANAGER_HPP
+
+// Include ecs::Event
+#ifndef ECS_EVENT_HPP
+#include "../../../../public/bt/ecs/event/Event.hpp"
+#endif // !ECS_EVENT_HPP
+
+// Include ecs::IEventListener
+#ifndef ECS_I_EVENT_LISTENER_HXX
+#include "../../../../public/bt/ecs/event/IEventListener.hxx"
+#endif // !ECS_I_EVENT_LISTENER_HXX
+
+// Include bt::core::AsyncMap
+#ifndef BT_CORE_ASYNC_MAP_HPP
+#include "../../../../public/bt/core/containers/AsyncMap.hpp"
+#endif // !BT_CORE_ASYNC_MAP_HPP
+
+// Include bt::core::AsyncDeque
+#ifndef BT_CORE_ASYNC_DEQUE_HPP
+#include "../../../../public/bt/core/containers/AsyncDeque.hpp"
+#endif // !BT_CORE_ASYNC_DEQUE_HPP
+
+// Include C++ chrono
+#include <chrono>
+
+// Include C++ cstdio
+#include <cstdio>
+
+// Include C++ cstring
+#include <cstring>
+
+// Include C++ string
+#include <string>
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Measurements per benchmark, fastest one is reported. **/
+#ifndef ECS_BENCH_REPEATS
+#define ECS_BENCH_REPEATS 5
+#endif // !ECS_BENCH_REPEATS
+
+/** Max threads count for contention benchmarks. **/
+#ifndef ECS_BENCH_MAX_THREADS
+#define ECS_BENCH_MAX_THREADS 8
+#endif // !ECS_BENCH_MAX_THREADS
+
+/** Max listeners count for events benchmarks. **/
+#ifndef ECS_BENCH_MAX_LISTENERS
+#define ECS_BENCH_MAX_LISTENERS 16
+#endif // !ECS_BENCH_MAX_LISTENERS
+
+// ===========================================================
+// ecs::bench
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace bench
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Result - benchmark result.
+        **/
+        struct Result final
+        {
+            /** Benchmark name. **/
+            std::string mName;
+
+            /** Parameter name (threads, listeners), or empty. **/
+            std::string mParam;
+
+            /** Parameter value. **/
+            ecs_size_t mValue;
+
+            /** Operations per measurement. **/
+            ecs_size_t mOperations;
+
+            /** Fastest measurement, nanoseconds per operation. **/
+            double mNanoseconds;
+        };
+
+        /** Archetype Component. **/
+        struct Position final
+        {
+            float x;
+            float y;
+            float z;
+        };
+
+        /** Archetype Component. **/
+        struct Velocity final
+        {
+            float x;
+            float y;
+            float z;
+        };
+
+        /** Legacy Component. **/
+        class BenchComponent final : public ecs_Component
+        {
+
+        public:
+
+            explicit BenchComponent( const ecs_TypeID pType )
+                : ecs_Component( pType )
+            {
+            }
+
+        };
+
+        /** Legacy Entity. **/
+        class BenchEntity final : public ecs::Entity
+        {
+
+        public:
+
+            explicit BenchEntity( const ecs_TypeID pType )
+                : ecs::Entity( pType )
+            {
+            }
+
+        };
+
+        /** Event, not repeated. **/
+        class BenchEvent final : public ecs_Event
+        {
+
+        public:
+
+            explicit BenchEvent( const ecs_TypeID pType )
+                : ecs_Event( pType, false )
+            {
+            }
+
+        };
+
+        /** Events listener, counts received events. **/
+        class BenchListener final : public ecs_IEventListener
+        {
+
+        public:
+
+            ecs_size_t mReceived = 0;
+
+            virtual char OnEvent( ecs_sptr<ecs_IEvent> pEvent, const bool pAsync, const unsigned char pThread ) override
+            {
+                (void)pEvent; (void)pAsync; (void)pThread;
+                mReceived++;
+                return 0;
+            }
+
+            virtual void onEventError( ecs_sptr<ecs_IEvent> pEvent, const std::exception& pException, const bool pAsync, const unsigned char pThread ) override
+            {
+                (void)pEvent; (void)pException; (void)pAsync; (void)pThread;
+            }
+
+        };
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Legacy Entity & Component Type-ID. **/
+        static constexpr const ecs_TypeID LEGACY_TYPE = 1;
+
+        /** Event Type-ID. **/
+        static constexpr const ecs_TypeID EVENT_TYPE = 1;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Results. **/
+        static ecs_vec<Result> gResults;
+
+        /** Operations count multiplier. **/
+        static ecs_size_t gScale = 1;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Measures function, fastest of ECS_BENCH_REPEATS runs is stored.
+         *
+         * @param pName - benchmark name.
+         * @param pParam - parameter name, or empty.
+         * @param pValue - parameter value.
+         * @param pOperations - operations count, performed by one call.
+         * @param pFunction - f( operations ), called once per run.
+        **/
+        template <typename F>
+        static void Measure( const char* const pName, const char* const pParam, const ecs_size_t pValue, const ecs_size_t pOperations, F pFunction )
+        {
+            double best = 0.0;
+
+            for ( int run = 0; run < ECS_BENCH_REPEATS; run++ )
+            {
+                const auto start = std::chrono::steady_clock::now();
+                pFunction( pOperations );
+                const double elapsed = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - start ).count();
+
+                if ( run == 0 || elapsed < best )
+                    best = elapsed;
+            }
+
+            gResults.push_back( Result{ pName, pParam, pValue, pOperations, best / static_cast<double>(pOperations) } );
+            std::fprintf( stderr, "%-40s %-10s %4zu %12.2f ns/op\n", pName, pParam, static_cast<std::size_t>(pValue), best / static_cast<double>(pOperations) );
+        }
+
+        /**
+         * @brief
+         * Runs function on threads at once, main thread waits.
+         *
+         * @param pThreads - threads count.
+         * @param pFunction - f( thread index ).
+        **/
+        template <typename F>
+        static void RunThreads( const ecs_size_t pThreads, F pFunction )
+        {
+            ecs_vec<ecs_thread> threads;
+            threads.reserve( pThreads );
+
+            for ( ecs_size_t i = 0; i < pThreads; i++ )
+                threads.emplace_back( pFunction, i );
+
+            for ( ecs_thread& thread : threads )
+                thread.join();
+        }
+
+        static void BenchEntities()
+        {
+            const ecs_size_t count = 10000 * gScale;
+
+            Measure( "entity.legacy.create_destroy", "", 0, count, []( const ecs_size_t pCount )
+            {
+                ecs_vec<ecs_sptr<ecs_IEntity>> entities;
+                entities.reserve( pCount );
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                {
+                    entities.push_back( ecs_Shared<BenchEntity>(LEGACY_TYPE) );
+                    ecs_Entities::registerEntity( entities.back() );
+                }
+
+                for ( ecs_sptr<ecs_IEntity>& entity : entities )
+                    ecs_Entities::unregisterEntity( entity->getTypeID(), entity->getID() );
+            } );
+
+            Measure( "entity.handle.create_destroy", "", 0, count, []( const ecs_size_t pCount )
+            {
+                ecs_vec<ecs_Handle> entities( pCount );
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    entities[i] = ecs_Entities::createHandle();
+
+                for ( const ecs_Handle entity : entities )
+                    ecs_Entities::destroyHandle( entity );
+            } );
+
+            Measure( "entity.archetype.create_destroy", "", 0, count, []( const ecs_size_t pCount )
+            {
+                ecs_ArchetypeStorage storage;
+                ecs_vec<ecs_Handle> entities( pCount );
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    entities[i] = storage.Create();
+
+                for ( const ecs_Handle entity : entities )
+                    storage.Destroy( entity );
+            } );
+
+            Measure( "entity.archetype.spawn_destroy_batch", "", 0, count, []( const ecs_size_t pCount )
+            {
+                ecs_ArchetypeStorage storage;
+                const ecs_Handle prefab = storage.Create();
+                storage.addComponent<Position>( prefab, Position{ 0.0f, 0.0f, 0.0f } );
+                storage.addComponent<Velocity>( prefab, Velocity{ 1.0f, 1.0f, 1.0f } );
+
+                ecs_vec<ecs_Handle> entities( pCount );
+                storage.spawnBatch( prefab, pCount, entities.data() );
+                storage.destroyBatch( entities.data(), pCount );
+            } );
+        }
+
+        static void BenchComponents()
+        {
+            const ecs_size_t count = 10000 * gScale;
+
+            Measure( "component.legacy.add_get_remove", "", 0, count, []( const ecs_size_t pCount )
+            {
+                ecs_vec<ecs_sptr<ecs_Component>> components;
+                components.reserve( pCount );
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                {
+                    components.push_back( ecs_Shared<BenchComponent>(LEGACY_TYPE) );
+                    ecs_Components::addComponent( components.back() );
+                }
+
+                for ( ecs_sptr<ecs_Component>& component : components )
+                    ecs_Components::getComponent( component->mTypeID, component->mID );
+
+                for ( ecs_sptr<ecs_Component>& component : components )
+                    ecs_Components::removeComponent( component );
+            } );
+
+            ecs_ArchetypeStorage storage;
+            ecs_vec<ecs_Handle> entities( count );
+
+            for ( ecs_size_t i = 0; i < count; i++ )
+                entities[i] = storage.Create();
+
+            Measure( "component.archetype.add_remove", "", 0, count, [&]( const ecs_size_t pCount )
+            {
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    storage.addComponent<Position>( entities[i], Position{ 1.0f, 2.0f, 3.0f } );
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    storage.removeComponent<Position>( entities[i] );
+            } );
+
+            for ( ecs_size_t i = 0; i < count; i++ )
+                storage.addComponent<Position>( entities[i], Position{ 1.0f, 2.0f, 3.0f } );
+
+            float sum = 0.0f;
+            Measure( "component.archetype.get", "", 0, count, [&]( const ecs_size_t pCount )
+            {
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    sum += storage.getComponent<Position>( entities[i] )->x;
+            } );
+
+            if ( sum < 0.0f )
+                std::fprintf( stderr, "%f\n", static_cast<double>(sum) );
+        }
+
+        static void BenchEvents()
+        {
+            const ecs_size_t count = 10000 * gScale;
+
+            for ( ecs_size_t listenersCount = 1; listenersCount <= ECS_BENCH_MAX_LISTENERS; listenersCount *= 2 )
+            {
+                ecs_vec<ecs_sptr<ecs_IEventListener>> listeners;
+
+                for ( ecs_size_t i = 0; i < listenersCount; i++ )
+                {
+                    listeners.push_back( ecs_Shared<BenchListener>() );
+                    ecs_Events::Subscribe( EVENT_TYPE, listeners.back() );
+                }
+
+                Measure( "event.send", "listeners", listenersCount, count, []( const ecs_size_t pCount )
+                {
+                    for ( ecs_size_t i = 0; i < pCount; i++ )
+                    {
+                        ecs_sptr<ecs_IEvent> event = ecs_Shared<BenchEvent>( EVENT_TYPE );
+                        ecs_Events::sendEvent( event );
+                    }
+                } );
+
+                Measure( "event.queue_update", "listeners", listenersCount, count, []( const ecs_size_t pCount )
+                {
+                    for ( ecs_size_t i = 0; i < pCount; i++ )
+                    {
+                        ecs_sptr<ecs_IEvent> event = ecs_Shared<BenchEvent>( EVENT_TYPE );
+                        ecs_Events::queueEvent( event );
+                    }
+
+                    ecs_Events::Update( 0 );
+                } );
+
+                for ( ecs_sptr<ecs_IEventListener>& listener : listeners )
+                    ecs_Events::Unsubscribe( EVENT_TYPE, listener );
+            }
+        }
+
+        static void BenchIDs()
+        {
+            const ecs_size_t count = 10000 * gScale;
+
+            Measure( "id.generate_release", "", 0, count, []( const ecs_size_t pCount )
+            {
+                ecs_IDMap<ecs_TypeID, ecs_ObjectID> ids;
+                ecs_vec<ecs_ObjectID> generated( pCount );
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    generated[i] = ids.getAvailableID( LEGACY_TYPE );
+
+                for ( const ecs_ObjectID id : generated )
+                    ids.releaseID( LEGACY_TYPE, id );
+            } );
+
+            Measure( "id.manager.generate_release", "", 0, count, []( const ecs_size_t pCount )
+            {
+                ecs_vec<ecs_ObjectID> generated( pCount );
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    generated[i] = ecs_Entities::generateEntityID( LEGACY_TYPE );
+
+                for ( const ecs_ObjectID id : generated )
+                    ecs_Entities::releaseEntityID( LEGACY_TYPE, id );
+            } );
+        }
+
+        static void BenchContainers()
+        {
+            const ecs_size_t count = 10000 * gScale;
+
+            Measure( "async_map.insert_get_erase", "", 0, count, []( const ecs_size_t pCount )
+            {
+                bt_AsyncMap<ecs_uint32_t, ecs_uint32_t> map;
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    map.Insert( static_cast<ecs_uint32_t>(i), static_cast<ecs_uint32_t>(i) );
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    map.Get( static_cast<ecs_uint32_t>(i) );
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    map.Erase( static_cast<ecs_uint32_t>(i) );
+            } );
+
+            Measure( "async_deque.push_pop", "", 0, count, []( const ecs_size_t pCount )
+            {
+                bt::core::AsyncDeque<ecs_uint32_t> deque;
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                {
+                    ecs_uint32_t item = static_cast<ecs_uint32_t>( i );
+                    deque.PushBack( item );
+                }
+
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    deque.PopFront();
+            } );
+        }
+
+        static void BenchSpinLock()
+        {
+            const ecs_size_t count = 100000 * gScale;
+
+            for ( ecs_size_t threadsCount = 1; threadsCount <= ECS_BENCH_MAX_THREADS; threadsCount *= 2 )
+            {
+                Measure( "spinlock.lock_unlock", "threads", threadsCount, count, [threadsCount]( const ecs_size_t pCount )
+                {
+                    ecs_Mutex mutex;
+                    ecs_size_t counter = 0;
+
+                    RunThreads( threadsCount, [&]( const ecs_size_t pThread )
+                    {
+                        const ecs_size_t operations = pCount / threadsCount + ( pThread < pCount % threadsCount ? 1 : 0 );
+
+                        for ( ecs_size_t i = 0; i < operations; i++ )
+                        {
+                            ecs_SpinLock lock( &mutex );
+                            counter++;
+                        }
+                    } );
+                } );
+            }
+        }
+
+        /**
+         * @brief
+         * Writes results as JSON.
+         *
+         * @param pFile - output file.
+        **/
+        static void WriteJSON( std::FILE* const pFile )
+        {
+            std::fprintf( pFile, "{\n  \"suite\": \"btEngine_ECS_bench\",\n  \"repeats\": %d,\n  \"scale\": %zu,\n  \"results\": [\n", ECS_BENCH_REPEATS, static_cast<std::size_t>(gScale) );
+
+            for ( ecs_size_t i = 0; i < gResults.size(); i++ )
+            {
+                const Result& result = gResults[i];
+
+                std::fprintf( pFile, "    { \"name\": \"%s\", \"param\": \"%s\", \"value\": %zu, \"operations\": %zu, \"ns_per_op\": %.3f, \"ops_per_sec\": %.1f }%s\n",
+                              result.mName.c_str(), result.mParam.c_str(), static_cast<std::size_t>(result.mValue), static_cast<std::size_t>(result.mOperations),
+                              result.mNanoseconds, 1.0e9 / result.mNanoseconds, i + 1 < gResults.size() ? "," : "" );
+            }
+
+            std::fprintf( pFile, "  ]\n}\n" );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::bench
+
+} /// ecs
+
+// ===========================================================
+// MAIN
+// ===========================================================
+
+/**
+ * @brief
+ * Runs ECS benchmarks, JSON is written to stdout or file.
+ *
+ * Usage: btEngine_ECS_bench [--out <file.json>] [--scale <N>]
+**/
+int main( int argc, char** argv )
+{
+    const char* outPath = nullptr;
+
+    for ( int i = 1; i < argc; i++ )
+    {
+        if ( std::strcmp(argv[i], "--out") == 0 && i + 1 < argc )
+            outPath = argv[++i];
+        else if ( std::strcmp(argv[i], "--scale") == 0 && i + 1 < argc )
+            ecs::bench::gScale = static_cast<ecs_size_t>( std::strtoul(argv[++i], nullptr, 10) );
+    }
+
+    if ( ecs::bench::gScale < 1 )
+        ecs::bench::gScale = 1;
+
+    // Managers static API uses this World.
+    ecs_World world;
+    ecs_WorldScope scope( &world );
+
+    ecs::bench::BenchEntities();
+    ecs::bench::BenchComponents();
+    ecs::bench::BenchEvents();
+    ecs::bench::BenchIDs();
+    ecs::bench::BenchContainers();
+    ecs::bench::BenchSpinLock();
+
+    std::FILE* const file = outPath != nullptr ? std::fopen( outPath, "w" ) : stdout;
+
+    if ( file == nullptr )
+    {
+        std::fprintf( stderr, "btEngine_ECS_bench: can't open %s\n", outPath );
+        return 1;
+    }
+
+    ecs::bench::WriteJSON( file );
+
+    if ( file != stdout )
+        std::fclose( file );
+
+    return 0;
+}
+
+// -----------------------------------------------------------
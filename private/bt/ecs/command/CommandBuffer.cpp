@@ -0,0 +1,182 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_COMMAND_BUFFER_HPP
+#include "../../../../public/bt/ecs/command/CommandBuffer.hpp"
+#endif // !ECS_COMMAND_BUFFER_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// Include C++ iterator
+#include <iterator>
+
+// ===========================================================
+// ecs::CommandBuffer
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    CommandBuffer::CommandBuffer( ecs_ArchetypeStorage& pStorage ) noexcept
+        : mStorage( pStorage ),
+          mCommands(),
+          mEntityCommands(),
+          mBlocks(),
+          mBlock( 0 ),
+          mOffset( 0 )
+    {
+    }
+
+    CommandBuffer::~CommandBuffer() noexcept
+    {
+        Discard();
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void* CommandBuffer::Allocate( const ecs_size_t pSize, const ecs_size_t pAlign )
+    {
+        while ( mBlock < mBlocks.size() )
+        {
+            const Block& block = mBlocks[mBlock];
+            const ecs_size_t base = reinterpret_cast<ecs_size_t>( block.mMemory.get() );
+            const ecs_size_t address = ( base + mOffset + pAlign - 1 ) & ~( pAlign - 1 );
+
+            if ( address + pSize <= base + block.mSize )
+            {
+                mOffset = address + pSize - base;
+                return reinterpret_cast<void*>( address );
+            }
+
+            mBlock++;
+            mOffset = 0;
+        }
+
+        // Oversized Components get own block.
+        const ecs_size_t size = std::max<ecs_size_t>( ECS_COMMAND_BLOCK_SIZE, pSize + pAlign );
+        mBlocks.push_back( Block{ ecs_uptr<unsigned char[]>( new unsigned char[size] ), size } );
+        mBlock = mBlocks.size() - 1;
+
+        return Allocate( pSize, pAlign );
+    }
+
+    void CommandBuffer::Destroy( const ecs_Handle pEntity )
+    { mCommands.push_back( Command{ ECommandTypes::Destroy, ECS_INVALID_TYPE_ID, pEntity, nullptr } ); }
+
+    void CommandBuffer::Detach( const ecs_Handle pEntity, const ecs_TypeID pType )
+    { mCommands.push_back( Command{ ECommandTypes::Detach, pType, pEntity, nullptr } ); }
+
+    void CommandBuffer::attachComponent( ecs_sptr<ecs_IEntity> pEntity, ecs_sptr<ecs_Component> pComponent )
+    { mEntityCommands.push_back( EntityCommand{ ECommandTypes::AttachComponent, pEntity, pComponent, ECS_INVALID_TYPE_ID, ECS_INVALID_OBJECT_ID } ); }
+
+    void CommandBuffer::detachComponent( ecs_sptr<ecs_IEntity> pEntity, const ecs_TypeID pType, const ecs_ObjectID pID )
+    { mEntityCommands.push_back( EntityCommand{ ECommandTypes::DetachComponent, pEntity, nullptr, pType, pID } ); }
+
+    void CommandBuffer::registerEntity( ecs_sptr<ecs_IEntity> pEntity )
+    { mEntityCommands.push_back( EntityCommand{ ECommandTypes::RegisterEntity, pEntity, nullptr, ECS_INVALID_TYPE_ID, ECS_INVALID_OBJECT_ID } ); }
+
+    void CommandBuffer::destroyEntity( ecs_sptr<ecs_IEntity> pEntity )
+    { mEntityCommands.push_back( EntityCommand{ ECommandTypes::DestroyEntity, pEntity, nullptr, ECS_INVALID_TYPE_ID, ECS_INVALID_OBJECT_ID } ); }
+
+    void CommandBuffer::Reset() noexcept
+    {
+        mCommands.clear();
+        mEntityCommands.clear();
+        mBlock = 0;
+        mOffset = 0;
+    }
+
+    void CommandBuffer::Take( ecs_vec<Command>& pCommands, ecs_vec<EntityCommand>& pEntityCommands )
+    {
+        const ecs_size_t commandsCount = pCommands.size();
+        pCommands.insert( pCommands.end(), mCommands.begin(), mCommands.end() );
+
+        try
+        {
+            pEntityCommands.insert( pEntityCommands.end(), std::make_move_iterator(mEntityCommands.begin()), std::make_move_iterator(mEntityCommands.end()) );
+        }
+        catch( ... )
+        {
+            pCommands.resize( commandsCount );
+            throw;
+        }
+
+        mCommands.clear();
+        mEntityCommands.clear();
+    }
+
+    void CommandBuffer::Rewind() noexcept
+    {
+        if ( !mCommands.empty() )
+            return;
+
+        mBlock = 0;
+        mOffset = 0;
+    }
+
+    void CommandBuffer::Discard() noexcept
+    {
+        for ( const Command& command : mCommands )
+        {
+            if ( command.mCommand != ECommandTypes::Attach || command.mData == nullptr )
+                continue;
+
+            const ecs_ComponentTypeInfo* const typeInfo = ecs_ComponentTypeInfo::Get( command.mType );
+
+            if ( !typeInfo->mTrivial )
+                typeInfo->mDestroy( command.mData );
+        }
+
+        Reset();
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
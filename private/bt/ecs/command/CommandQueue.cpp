@@ -0,0 +1,294 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_COMMAND_QUEUE_HPP
+#include "../../../../public/bt/ecs/command/CommandQueue.hpp"
+#endif // !ECS_COMMAND_QUEUE_HPP
+
+// Include ecs::IEntity
+#ifndef ECS_I_ENTITY_HXX
+#include "../../../../public/bt/ecs/entity/IEntity.hxx"
+#endif // !ECS_I_ENTITY_HXX
+
+// Include ecs::EntitiesManager
+#ifndef ECS_ENTITIES_MANAGER_HPP
+#include "../../../../public/bt/ecs/entity/EntitiesManager.hpp"
+#endif // !ECS_ENTITIES_MANAGER_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// ===========================================================
+// ecs::CommandQueue
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // FIELDS
+    // ===========================================================
+
+    /** Queue IDs generator. **/
+    static ecs_atomic<ecs_uint64_t> gQueueIDs( 0 );
+
+    /**
+     * @brief
+     * Cached queue & buffer of thread.
+    **/
+    struct LocalBuffer final
+    {
+        /** Queue ID, 0 if empty. **/
+        ecs_uint64_t mQueue;
+
+        /** Buffer. **/
+        ecs_CommandBuffer* mBuffer;
+    };
+
+    /** Recently used queues & buffers of thread (several Worlds). Queue IDs are never reused. **/
+    static thread_local LocalBuffer gLocalBuffers[ECS_COMMAND_QUEUE_LOCAL_CACHE] = {};
+
+    /** Next entry of thread cache to replace. **/
+    static thread_local ecs_size_t gLocalNext( 0 );
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    CommandQueue::CommandQueue( ecs_ArchetypeStorage& pStorage ) noexcept
+        : mID( ++gQueueIDs ),
+          mStorage( pStorage ),
+          mBuffers(),
+          mBuffersMutex(),
+          mCommands(),
+          mEntityCommands(),
+          mSorted()
+    {
+    }
+
+    CommandQueue::~CommandQueue() noexcept
+    {
+        Discard();
+    }
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    ecs_CommandBuffer& CommandQueue::getLocal()
+    {
+        for ( const LocalBuffer& cached : gLocalBuffers )
+        {
+            if ( cached.mQueue == mID )
+                return *cached.mBuffer;
+        }
+
+        const ecs_thread::id thread = std::this_thread::get_id();
+        ecs_SpinLock lock( &mBuffersMutex );
+
+        ecs_CommandBuffer* buffer = nullptr;
+        for ( const ThreadBuffer& threadBuffer : mBuffers )
+        {
+            if ( threadBuffer.mThread == thread )
+            {
+                buffer = threadBuffer.mBuffer.get();
+                break;
+            }
+        }
+
+        if ( buffer == nullptr )
+        {
+            mBuffers.push_back( ThreadBuffer{ thread, ecs_Shared<ecs_CommandBuffer>( mStorage ) } );
+            buffer = mBuffers.back().mBuffer.get();
+        }
+
+        // Oldest entry replaced.
+        gLocalBuffers[gLocalNext] = LocalBuffer{ mID, buffer };
+        gLocalNext = (gLocalNext + 1) % ECS_COMMAND_QUEUE_LOCAL_CACHE;
+
+        return *buffer;
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    ecs_uint64_t CommandQueue::getKey( const ecs_Handle pEntity ) const noexcept
+    {
+        const ecs_Archetype* const archetype = mStorage.getArchetypeOf( pEntity );
+
+        // Stale Handles last, their commands are ignored.
+        if ( archetype == nullptr )
+            return ecs_NumericUtil<ecs_uint64_t>::MAX;
+
+        const ecs_ArchetypeRow& row = mStorage.getRowOf( pEntity );
+
+        return ( static_cast<ecs_uint64_t>( archetype->getIndex() ) << 40 )
+               | ( static_cast<ecs_uint64_t>( row.mChunk & 0xFFFFFF ) << 16 )
+               | static_cast<ecs_uint64_t>( row.mRow & 0xFFFF );
+    }
+
+    void CommandQueue::Release() noexcept
+    {
+        for ( const ecs_CommandBuffer::Command& command : mCommands )
+        {
+            if ( command.mCommand != ECommandTypes::Attach || command.mData == nullptr )
+                continue;
+
+            const ecs_ComponentTypeInfo* const typeInfo = ecs_ComponentTypeInfo::Get( command.mType );
+
+            if ( !typeInfo->mTrivial )
+                typeInfo->mDestroy( command.mData );
+        }
+
+        mSorted.clear();
+        mCommands.clear();
+        mEntityCommands.clear();
+
+        ecs_SpinLock lock( &mBuffersMutex );
+
+        for ( const ThreadBuffer& threadBuffer : mBuffers )
+            threadBuffer.mBuffer->Rewind();
+    }
+
+    void CommandQueue::Apply()
+    {
+        // Reserved Entities become alive in root Archetype.
+        mStorage.FlushReserved();
+
+        try
+        {
+            // Commands are applied without lock, so they can use CommandQueue::getLocal.
+            {
+                ecs_SpinLock lock( &mBuffersMutex );
+
+                for ( const ThreadBuffer& threadBuffer : mBuffers )
+                    threadBuffer.mBuffer->Take( mCommands, mEntityCommands );
+            }
+
+            for ( ecs_CommandBuffer::Command& command : mCommands )
+                mSorted.push_back( SortedCommand{ getKey(command.mEntity), &command } );
+
+            // Key is computed once per Entity location, so stable sort keeps commands order of each Entity.
+            std::stable_sort( mSorted.begin(), mSorted.end(),
+                              []( const SortedCommand& pA, const SortedCommand& pB ) { return pA.mKey < pB.mKey; } );
+
+            for ( const SortedCommand& sorted : mSorted )
+            {
+                ecs_CommandBuffer::Command& command = *sorted.mCommand;
+
+                switch ( command.mCommand )
+                {
+                case ECommandTypes::Destroy:
+                    mStorage.Destroy( command.mEntity );
+                    break;
+                case ECommandTypes::Attach:
+                {
+                    void* const data = command.mData;
+
+                    // Consumed by Attach (moved or destroyed), even if it throws.
+                    command.mData = nullptr;
+                    mStorage.Attach( command.mEntity, command.mType, data );
+
+                    break;
+                }
+                case ECommandTypes::Detach:
+                    mStorage.Detach( command.mEntity, command.mType );
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            mSorted.clear();
+
+            for ( ecs_CommandBuffer::EntityCommand& entityCommand : mEntityCommands )
+            {
+                // Moved out, so applied command is never applied again.
+                const ecs_CommandBuffer::EntityCommand command( std::move(entityCommand) );
+
+                switch ( command.mCommand )
+                {
+                case ECommandTypes::AttachComponent:
+                    command.mEntity->attachComponent( command.mComponent );
+                    break;
+                case ECommandTypes::DetachComponent:
+                    command.mEntity->detachComponent( command.mType, command.mID );
+                    break;
+                case ECommandTypes::RegisterEntity:
+                {
+                    ecs_sptr<ecs_IEntity> entity = command.mEntity;
+                    ecs_Entities::registerEntity( entity );
+                    break;
+                }
+                case ECommandTypes::DestroyEntity:
+                    command.mEntity->Destroy();
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+        catch( ... )
+        {
+            Release();
+            throw;
+        }
+
+        Release();
+
+        // Components observers get changes of all buffers at once.
+        mStorage.NotifyObservers();
+    }
+
+    void CommandQueue::Discard() noexcept
+    {
+        ecs_SpinLock lock( &mBuffersMutex );
+
+        for ( const ThreadBuffer& threadBuffer : mBuffers )
+            threadBuffer.mBuffer->Discard();
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
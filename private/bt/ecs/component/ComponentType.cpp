@@ -0,0 +1,92 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_COMPONENT_TYPE_HPP
+#include "../../../../public/bt/ecs/component/ComponentType.hpp"
+#endif // !ECS_COMPONENT_TYPE_HPP
+
+// Include ecs::mutex
+#ifndef ECS_MUTEX_HPP
+#include "../../../../public/bt/ecs/types/ecs_mutex.hpp"
+#endif // !ECS_MUTEX_HPP
+
+// ===========================================================
+// ecs::ComponentTypeInfo
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // FIELDS
+    // ===========================================================
+
+    /** Registered types, indexed by Type-ID. Read without lock by Worlds threads. **/
+    static ecs_atomic<const ComponentTypeInfo*> gComponentTypes[ECS_MAX_COMPONENT_TYPES] = {};
+
+    /** Registration Mutex. **/
+    static ecs_Mutex gComponentTypesMutex;
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void ComponentTypeInfo::Register( const ComponentTypeInfo* const pInfo )
+    {
+        if ( pInfo->mTypeID >= ECS_MAX_COMPONENT_TYPES )
+            throw std::out_of_range( "ComponentTypeInfo::Register - Type-ID out of range, increase ECS_MAX_COMPONENT_TYPES." );
+
+        ecs_SpinLock lock( &gComponentTypesMutex );
+        const ComponentTypeInfo* const registered = gComponentTypes[pInfo->mTypeID].load( std::memory_order_relaxed );
+
+        // Two Component types with one Type-ID would share Archetype columns.
+        if ( registered != nullptr && registered != pInfo )
+            throw std::logic_error( "ComponentTypeInfo::Register - Type-ID already used by another Component type." );
+
+        gComponentTypes[pInfo->mTypeID].store( pInfo, std::memory_order_release );
+    }
+
+    const ComponentTypeInfo* ComponentTypeInfo::Get( const ecs_TypeID pType ) noexcept
+    { return pType < ECS_MAX_COMPONENT_TYPES ? gComponentTypes[pType].load( std::memory_order_acquire ) : nullptr; }
+
+    // -----------------------------------------------------------
+
+} /// ecs
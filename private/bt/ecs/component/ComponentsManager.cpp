@@ -46,6 +46,11 @@
 #include "../../../../public/bt/ecs/component/Component.hpp"
 #endif // !ECS_COMPONENT_HPP
 
+// Include ecs::World
+#ifndef ECS_WORLD_HPP
+#include "../../../../public/bt/ecs/world/World.hpp"
+#endif // !ECS_WORLD_HPP
+
 // ===========================================================
 // ecs::ComponentsManager
 // ===========================================================
@@ -69,8 +74,14 @@ namespace ecs
         : mTypedComponents(),
           mComponentsMutex(),
           mIDStorage(),
-          mIDMutex()
+          mIDMutex(),
+          mPools(),
+          mPoolsMutex(),
+          mArchetypes( ecs_Shared<ecs_ArchetypeStorage>() ),
+          mCommands( ecs_Shared<ecs_CommandQueue>(*mArchetypes) ),
+          mHierarchy( ecs_Shared<ecs_HierarchyStore>() )
     {
+        mArchetypes->setHierarchy( mHierarchy );
     }
 
     ComponentsManager::~ComponentsManager() = default;
@@ -80,7 +91,28 @@ namespace ecs
     // ===========================================================
 
     ecs_sptr<ComponentsManager> ComponentsManager::getInstance()
-    { return mInstanceStorage.getItem(); }
+    {
+        ecs_World* const world = ecs_World::getCurrent();
+        return world != nullptr ? world->getComponents() : mInstanceStorage.getItem();
+    }
+
+    ecs_sptr<ecs_ArchetypeStorage> ComponentsManager::getArchetypes()
+    {
+        auto instance = getInstance();
+        return instance == nullptr ? ecs_sptr<ecs_ArchetypeStorage>( nullptr ) : instance->mArchetypes;
+    }
+
+    ecs_CommandBuffer* ComponentsManager::getCommands()
+    {
+        auto instance = getInstance();
+        return instance == nullptr ? nullptr : &instance->mCommands->getLocal();
+    }
+
+    ecs_sptr<ecs_HierarchyStore> ComponentsManager::getHierarchy()
+    {
+        auto instance = getInstance();
+        return instance == nullptr ? ecs_sptr<ecs_HierarchyStore>( nullptr ) : instance->mHierarchy;
+    }
 
     ComponentsManager::components_map_storage& ComponentsManager::getComponents(const ecs_TypeID pType)
     {
@@ -178,6 +210,19 @@ namespace ecs
         componentsStorage.mItem.erase( pComponent->mID );
     }
 
+    void ComponentsManager::removePool( const ecs_TypeID pType )
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr )
+            return;
+
+        ecs_SpinLock lock( &instance->mPoolsMutex );
+
+        if ( pType < instance->mPools.size() )
+            instance->mPools[pType] = nullptr;
+    }
+
     ecs_ObjectID ComponentsManager::generateComponentID(const ecs_TypeID pType) ECS_NOEXCEPT
     {
         ecs_sptr<ComponentsManager> componentsManager = getInstance();
@@ -202,6 +247,14 @@ namespace ecs
         }
     }
 
+    void ComponentsManager::ApplyCommands()
+    {
+        auto instance = getInstance();
+
+        if ( instance != nullptr )
+            instance->mCommands->Apply();
+    }
+
     void ComponentsManager::Initialize()
     {
         if ( mInstanceStorage.getItem() == nullptr )
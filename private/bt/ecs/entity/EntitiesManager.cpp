@@ -46,6 +46,16 @@
 #include "../../../public/bt/ecs/entity/IEntity.hxx"
 #endif // !ECS_I_ENTITY_HXX
 
+// Include ecs::World
+#ifndef ECS_WORLD_HPP
+#include "../../../public/bt/ecs/world/World.hpp"
+#endif // !ECS_WORLD_HPP
+
+// Include ecs::ComponentsManager
+#ifndef ECS_COMPONENTS_MANAGER_HPP
+#include "../../../public/bt/ecs/component/ComponentsManager.hpp"
+#endif // !ECS_COMPONENTS_MANAGER_HPP
+
 // ===========================================================
 // ecs::EntitiesManager
 // ===========================================================
@@ -65,11 +75,13 @@ namespace ecs
     // CONSTRUCTOR & DESTRUCTOR
     // ===========================================================
 
-    EntitiesManager::EntitiesManager()
+    EntitiesManager::EntitiesManager( const ecs_sptr<ecs_ArchetypeStorage>& pStorage )
         : mIDStorage(),
           mIDMutex(),
           mEntities(),
-          mEntitiesMutex()
+          mEntitiesMutex(),
+          mRegistry( pStorage != nullptr ? pStorage : ecs_Shared<ecs_ArchetypeStorage>() ),
+          mRegistryMutex()
     {
     }
 
@@ -80,7 +92,13 @@ namespace ecs
     // ===========================================================
 
     ecs_sptr<EntitiesManager> EntitiesManager::getInstance()
-    { return mInstanceHolder.getItem(); }
+    {
+        ecs_World* const world = ecs_World::getCurrent();
+        return world != nullptr ? world->getEntities() : mInstanceHolder.getItem();
+    }
+
+    ecs_wptr<EntitiesManager> EntitiesManager::getCurrent()
+    { return getInstance(); }
 
     EntitiesManager::ecs_entities_map_storage& EntitiesManager::getEntities( const ecs_TypeID pType )
     {
@@ -177,20 +195,57 @@ namespace ecs
     }
 
     void EntitiesManager::releaseEntityID(const ecs_TypeID pType, const ecs_ObjectID pID) ECS_NOEXCEPT
+    { releaseEntityID( getInstance(), pType, pID ); }
+
+    void EntitiesManager::releaseEntityID( const ecs_sptr<EntitiesManager>& pInstance, const ecs_TypeID pType, const ecs_ObjectID pID ) ECS_NOEXCEPT
     {
-        ecs_sptr<ecs_Entities> instance = getInstance();
+        if ( pInstance != nullptr )
+        {
+            ecs_SpinLock lock( &pInstance->mIDMutex );
+            pInstance->mIDStorage.releaseID(pType, pID);
+        }
+    }
 
-        if ( instance != nullptr )
+    ecs_Handle EntitiesManager::createHandle()
+    { return createHandle( getInstance() ); }
+
+    ecs_Handle EntitiesManager::createHandle( const ecs_sptr<EntitiesManager>& pInstance )
+    {
+        if ( pInstance == nullptr )
+            return ecs_Handle();
+
+        ecs_SpinLock lock( &pInstance->mRegistryMutex );
+        return pInstance->mRegistry.Create();
+    }
+
+    void EntitiesManager::destroyHandle( const ecs_Handle pEntity )
+    { destroyHandle( getInstance(), pEntity ); }
+
+    void EntitiesManager::destroyHandle( const ecs_sptr<EntitiesManager>& pInstance, const ecs_Handle pEntity )
+    {
+        if ( pInstance != nullptr )
         {
-            ecs_SpinLock lock( &instance->mIDMutex );
-            instance->mIDStorage.releaseID(pType, pID);
+            ecs_SpinLock lock( &pInstance->mRegistryMutex );
+            pInstance->mRegistry.Destroy( pEntity );
+        }
+    }
+
+    void EntitiesManager::setComponent( const ecs_Handle pEntity, const ecs_TypeID pType, const bool pAttached ) ECS_NOEXCEPT
+    { setComponent( getInstance(), pEntity, pType, pAttached ); }
+
+    void EntitiesManager::setComponent( const ecs_sptr<EntitiesManager>& pInstance, const ecs_Handle pEntity, const ecs_TypeID pType, const bool pAttached ) ECS_NOEXCEPT
+    {
+        if ( pInstance != nullptr )
+        {
+            ecs_SpinLock lock( &pInstance->mRegistryMutex );
+            pInstance->mRegistry.setComponent( pEntity, pType, pAttached );
         }
     }
 
     void EntitiesManager::Initialize()
     {
         if ( getInstance() == nullptr )
-            mInstanceHolder.setItem( ecs_Shared<ecs_Entities>() );
+            mInstanceHolder.setItem( ecs_Shared<ecs_Entities>(ecs_Components::getArchetypes()) );
     }
 
     void EntitiesManager::Terminate()
@@ -70,14 +70,27 @@ namespace ecs
           mChildren(),
           mChildrenMutex(),
           mParent(),
+          mManager( ecs_Entities::getCurrent() ),
           mTypeID( pType ),
-          mID( ecs_Entities::generateEntityID( mTypeID ) )
+          mID( ecs_Entities::generateEntityID( mTypeID ) ),
+          mHandle( ecs_Entities::createHandle( mManager.lock() ) )
     {
     }
 
     Entity::~Entity()
     {
-        ecs_Entities::releaseEntityID( mTypeID, mID );
+        const ecs_sptr<ecs_Entities> manager = mManager.lock();
+
+        try
+        {
+            ecs_Entities::destroyHandle( manager, mHandle );
+        }
+        catch( ... )
+        {
+            // Handle is released with storage.
+        }
+
+        ecs_Entities::releaseEntityID( manager, mTypeID, mID );
     }
 
     // ===========================================================
@@ -90,6 +103,9 @@ namespace ecs
     ecs_TypeID Entity::getID() const noexcept
     { return mID; }
 
+    ecs_Handle Entity::getHandle() const noexcept
+    { return mHandle; }
+
     ecs_sptr<ecs_Component> Entity::getComponent( const ecs_TypeID pType, const ecs_ObjectID pID )
     {
         ecs_SpinLock lock(&mComponentsMutex );
@@ -136,6 +152,7 @@ namespace ecs
         ecs_SpinLock lock( &mComponentsMutex );
         ecs_map<ecs_ObjectID, ecs_sptr<ecs_Component>>& components = mComponents[pComponent->mTypeID];
         components[pComponent->mID] = pComponent;
+        ecs_Entities::setComponent( mManager.lock(), mHandle, pComponent->mTypeID, true );
     }
 
     void Entity::detachComponent( const ecs_TypeID pType, const ecs_ObjectID pID )
@@ -143,6 +160,9 @@ namespace ecs
         ecs_SpinLock lock( &mComponentsMutex );
         ecs_map<ecs_ObjectID, ecs_sptr<ecs_Component>>& components = mComponents[pType];
         components.erase( pID );
+
+        if ( components.empty() )
+            ecs_Entities::setComponent( mManager.lock(), mHandle, pType, false );
     }
 
     bool Entity::attachEntity( ecs_sptr<IEntity> pEntity )
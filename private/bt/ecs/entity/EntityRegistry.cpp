@@ -0,0 +1,204 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_ENTITY_REGISTRY_HPP
+#include "../../../../public/bt/ecs/entity/EntityRegistry.hpp"
+#endif // !ECS_ENTITY_REGISTRY_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// ===========================================================
+// ecs::EntityRegistry
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTANTS
+    // ===========================================================
+
+    constexpr const ecs_uint32_t EntityRegistry::NO_INDEX;
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    EntityRegistry::EntityRegistry( const ecs_sptr<ecs_ArchetypeStorage>& pStorage ) noexcept
+        : mStorage( pStorage ),
+          mSlots(),
+          mEntities(),
+          mMasks()
+    {
+        mStorage->setRegistry( this );
+    }
+
+    EntityRegistry::~EntityRegistry() noexcept
+    {
+        if ( mStorage->getRegistry() == this )
+            mStorage->setRegistry( nullptr );
+    }
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    bool EntityRegistry::setComponent( const ecs_Handle pEntity, const ecs_TypeID pType, const bool pAttached ) noexcept
+    {
+        if ( pType >= ECS_MAX_COMPONENT_TYPES || !isAlive(pEntity) )
+            return false;
+
+        ecs_Signature& mask = mMasks[mSlots[pEntity.getIndex()]];
+
+        if ( pAttached )
+            mask.Set( pType );
+        else
+            mask.Reset( pType );
+
+        return true;
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void EntityRegistry::Remove( const ecs_uint32_t pSlot ) noexcept
+    {
+        const ecs_uint32_t index = mSlots[pSlot];
+        const ecs_uint32_t last = static_cast<ecs_uint32_t>( mEntities.size() - 1 );
+
+        // Last Entity fills the hole.
+        if ( index != last )
+        {
+            mEntities[index] = mEntities[last];
+            mMasks[index] = mMasks[last];
+            mSlots[mEntities[index].getIndex()] = index;
+        }
+
+        mEntities.pop_back();
+        mMasks.pop_back();
+        mSlots[pSlot] = NO_INDEX;
+    }
+
+    ecs_Handle EntityRegistry::Create()
+    {
+        const ecs_Handle entity = mStorage->Create();
+        const ecs_uint32_t slot = entity.getIndex();
+
+        try
+        {
+            if ( slot >= mSlots.size() )
+                mSlots.resize( slot + 1, NO_INDEX );
+
+            // Slot of Entity, destroyed directly in storage.
+            if ( mSlots[slot] != NO_INDEX )
+                Remove( slot );
+
+            mEntities.push_back( entity );
+            mMasks.push_back( ecs_Signature() );
+        }
+        catch( ... )
+        {
+            if ( mEntities.size() > mMasks.size() )
+                mEntities.pop_back();
+
+            mStorage->Destroy( entity );
+            throw;
+        }
+
+        mSlots[slot] = static_cast<ecs_uint32_t>( mEntities.size() - 1 );
+
+        return entity;
+    }
+
+    bool EntityRegistry::Destroy( const ecs_Handle pEntity )
+    {
+        if ( !isAlive(pEntity) )
+            return false;
+
+        Remove( pEntity.getIndex() );
+        mStorage->Destroy( pEntity );
+
+        return true;
+    }
+
+    void EntityRegistry::Capture( ecs_StorageSnapshot& pDst ) const
+    {
+        pDst.mRegistry = mEntities;
+        pDst.mRegistryMasks = mMasks;
+    }
+
+    void EntityRegistry::Restore( const ecs_StorageSnapshot& pSrc )
+    {
+        mEntities = pSrc.mRegistry;
+        mMasks = pSrc.mRegistryMasks;
+        std::fill( mSlots.begin(), mSlots.end(), NO_INDEX );
+
+        const ecs_size_t entitiesCount = mEntities.size();
+
+        for ( ecs_size_t i = 0; i < entitiesCount; i++ )
+        {
+            const ecs_uint32_t slot = mEntities[i].getIndex();
+
+            if ( slot >= mSlots.size() )
+                mSlots.resize( slot + 1, NO_INDEX );
+
+            mSlots[slot] = static_cast<ecs_uint32_t>( i );
+        }
+    }
+
+    void EntityRegistry::Clear()
+    {
+        while ( !mEntities.empty() )
+        {
+            const ecs_Handle entity = mEntities.back();
+
+            Remove( entity.getIndex() );
+            mStorage->Destroy( entity );
+        }
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
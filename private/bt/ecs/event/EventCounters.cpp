@@ -0,0 +1,225 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_EVENT_COUNTERS_HPP
+#include "../../../../public/bt/ecs/event/EventCounters.hpp"
+#endif // !ECS_EVENT_COUNTERS_HPP
+
+// ===========================================================
+// ecs::EventCounters
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    EventCounters::EventCounters() noexcept
+        : mQueued( 0 ),
+          mDispatched( 0 ),
+          mDropped( 0 ),
+          mDepth( 0 ),
+          mMaxDepth( 0 ),
+          mLatency(),
+          mListenersTime( 0 )
+    {
+        for ( ecs_atomic<ecs_uint64_t>& bucket : mLatency )
+            bucket.store( 0, std::memory_order_relaxed );
+    }
+
+    EventCounters::~EventCounters() noexcept = default;
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    EventStats EventCounters::getStats() const noexcept
+    {
+        EventStats result;
+
+        result.mQueued = mQueued.load( std::memory_order_relaxed );
+        result.mDispatched = mDispatched.load( std::memory_order_relaxed );
+        result.mDropped = mDropped.load( std::memory_order_relaxed );
+
+        const ecs_int64_t depth = mDepth.load( std::memory_order_relaxed );
+        result.mDepth = depth > 0 ? static_cast<ecs_uint64_t>( depth ) : 0;
+
+        const ecs_int64_t maxDepth = mMaxDepth.load( std::memory_order_relaxed );
+        result.mMaxDepth = maxDepth > 0 ? static_cast<ecs_uint64_t>( maxDepth ) : 0;
+
+        for ( ecs_size_t i = 0; i < ECS_EVENT_LATENCY_BUCKETS; i++ )
+            result.mLatency[i] = mLatency[i].load( std::memory_order_relaxed );
+
+        result.mListenersTime = ecs_nanoseconds( mListenersTime.load(std::memory_order_relaxed) );
+
+        return result;
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void EventCounters::Queued() noexcept
+    {
+        mQueued.fetch_add( 1, std::memory_order_relaxed );
+
+        const ecs_int64_t depth = mDepth.fetch_add( 1, std::memory_order_relaxed ) + 1;
+        ecs_int64_t maxDepth = mMaxDepth.load( std::memory_order_relaxed );
+
+        while ( depth > maxDepth && !mMaxDepth.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed) )
+        {
+        }
+    }
+
+    void EventCounters::Dispatched( const bool pDequeued ) noexcept
+    {
+        mDispatched.fetch_add( 1, std::memory_order_relaxed );
+
+        if ( pDequeued )
+            mDepth.fetch_sub( 1, std::memory_order_relaxed );
+    }
+
+    void EventCounters::Dropped() noexcept
+    {
+        mDropped.fetch_add( 1, std::memory_order_relaxed );
+        mDepth.fetch_sub( 1, std::memory_order_relaxed );
+    }
+
+    void EventCounters::Dequeued() noexcept
+    { mDepth.fetch_sub( 1, std::memory_order_relaxed ); }
+
+    void EventCounters::addLatency( const ecs_nanoseconds pLatency ) noexcept
+    {
+        // Buckets are microseconds.
+        ecs_uint64_t micros = pLatency.count() > 0 ? static_cast<ecs_uint64_t>( pLatency.count() ) / 1000 : 0;
+        ecs_size_t bucket = 0;
+
+        // Bit length.
+        while ( micros > 0 && bucket < ECS_EVENT_LATENCY_BUCKETS - 1 )
+        {
+            micros >>= 1;
+            bucket++;
+        }
+
+        mLatency[bucket].fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    void EventCounters::addListenerTime( const ecs_nanoseconds pTime ) noexcept
+    {
+        if ( pTime.count() > 0 )
+            mListenersTime.fetch_add( static_cast<ecs_uint64_t>(pTime.count()), std::memory_order_relaxed );
+    }
+
+    void EventCounters::Reset() noexcept
+    {
+        mQueued.store( 0, std::memory_order_relaxed );
+        mDispatched.store( 0, std::memory_order_relaxed );
+        mDropped.store( 0, std::memory_order_relaxed );
+        mMaxDepth.store( mDepth.load(std::memory_order_relaxed), std::memory_order_relaxed );
+
+        for ( ecs_atomic<ecs_uint64_t>& bucket : mLatency )
+            bucket.store( 0, std::memory_order_relaxed );
+
+        mListenersTime.store( 0, std::memory_order_relaxed );
+    }
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // ecs::EventListenerCounters
+    // ===========================================================
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    EventListenerCounters::EventListenerCounters() noexcept
+        : mCalls( 0 ),
+          mTime( 0 ),
+          mMaxTime( 0 )
+    {
+    }
+
+    EventListenerCounters::~EventListenerCounters() noexcept = default;
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    EventListenerStats EventListenerCounters::getStats() const noexcept
+    {
+        return EventListenerStats{ mCalls.load( std::memory_order_relaxed ),
+                                   ecs_nanoseconds( mTime.load(std::memory_order_relaxed) ),
+                                   ecs_nanoseconds( mMaxTime.load(std::memory_order_relaxed) ) };
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void EventListenerCounters::Called( const ecs_nanoseconds pTime ) noexcept
+    {
+        const ecs_uint64_t nanos = pTime.count() > 0 ? static_cast<ecs_uint64_t>( pTime.count() ) : 0;
+
+        mCalls.fetch_add( 1, std::memory_order_relaxed );
+        mTime.fetch_add( nanos, std::memory_order_relaxed );
+
+        ecs_uint64_t maxTime = mMaxTime.load( std::memory_order_relaxed );
+
+        while ( nanos > maxTime && !mMaxTime.compare_exchange_weak(maxTime, nanos, std::memory_order_relaxed) )
+        {
+        }
+    }
+
+    void EventListenerCounters::Reset() noexcept
+    {
+        mCalls.store( 0, std::memory_order_relaxed );
+        mTime.store( 0, std::memory_order_relaxed );
+        mMaxTime.store( 0, std::memory_order_relaxed );
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
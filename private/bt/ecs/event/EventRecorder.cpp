@@ -0,0 +1,291 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_EVENT_RECORDER_HPP
+#include "../../../../public/bt/ecs/event/EventRecorder.hpp"
+#endif // !ECS_EVENT_RECORDER_HPP
+
+// Include ecs::IEvent
+#ifndef ECS_I_EVENT_HXX
+#include "../../../../public/bt/ecs/event/IEvent.hxx"
+#endif // !ECS_I_EVENT_HXX
+
+// Include ecs::EventsManager
+#ifndef ECS_EVENTS_MANAGER_HPP
+#include "../../../../public/bt/ecs/event/EventsManager.hpp"
+#endif // !ECS_EVENTS_MANAGER_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// ===========================================================
+// ecs::EventRecorder
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTANTS
+    // ===========================================================
+
+    constexpr const ecs_uint8_t EventRecorder::VERSION;
+    constexpr const ecs_size_t EventRecorder::HEADER_SIZE;
+
+    /** Log magic. **/
+    static constexpr const ecs_uint8_t gMagic[4] = { 'B', 'T', 'E', 'L' };
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    EventRecorder::EventRecorder() noexcept
+        : mCodecs(),
+          mData(),
+          mPayload(),
+          mFrame( 0 ),
+          mRecordFrame( 0 ),
+          mCount( 0 ),
+          mReadPos( HEADER_SIZE ),
+          mReadFrame( 0 ),
+          mMutex()
+    {
+    }
+
+    EventRecorder::~EventRecorder() noexcept = default;
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    void EventRecorder::setCodec( const ecs_TypeID pType, const EventCodec& pCodec )
+    {
+        ecs_SpinLock lock( &mMutex );
+        mCodecs[pType] = pCodec;
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void EventRecorder::writeVarint( ecs_uint64_t pValue )
+    {
+        while ( pValue >= 0x80 )
+        {
+            mData.push_back( static_cast<ecs_uint8_t>( pValue | 0x80 ) );
+            pValue >>= 7;
+        }
+
+        mData.push_back( static_cast<ecs_uint8_t>( pValue ) );
+    }
+
+    bool EventRecorder::readVarint( ecs_uint64_t& pOutput ) noexcept
+    {
+        const ecs_size_t dataSize = mData.size();
+        ecs_uint64_t result = 0;
+
+        for ( ecs_uint32_t shift = 0; shift < 64 && mReadPos < dataSize; shift += 7 )
+        {
+            const ecs_uint8_t byte = mData[mReadPos++];
+            result |= static_cast<ecs_uint64_t>( byte & 0x7F ) << shift;
+
+            if ( (byte & 0x80) == 0 )
+            {
+                pOutput = result;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void EventRecorder::writeHeader()
+    {
+        if ( !mData.empty() )
+            return;
+
+        mData.insert( mData.end(), std::begin(gMagic), std::end(gMagic) );
+        mData.push_back( VERSION );
+    }
+
+    void EventRecorder::Record( const ecs_IEvent& pEvent, const ecs_uint8_t pThread, const bool pSent )
+    {
+        const ecs_TypeID type = pEvent.getTypeID();
+
+        ecs_SpinLock lock( &mMutex );
+
+        mPayload.clear();
+
+        auto codec = mCodecs.find( type );
+
+        if ( codec != mCodecs.end() && codec->second.mWrite != nullptr )
+            codec->second.mWrite( pEvent, mPayload );
+
+        writeHeader();
+        writeVarint( mFrame - mRecordFrame );
+        writeVarint( type );
+        mData.push_back( pThread );
+        mData.push_back( pSent ? 1 : 0 );
+        writeVarint( mPayload.size() );
+        mData.insert( mData.end(), mPayload.cbegin(), mPayload.cend() );
+
+        mRecordFrame = mFrame;
+        mCount++;
+    }
+
+    void EventRecorder::NextFrame() noexcept
+    {
+        ecs_SpinLock lock( &mMutex );
+        mFrame++;
+    }
+
+    bool EventRecorder::Load( const ecs_uint8_t* const pData, const ecs_size_t pSize )
+    {
+        Clear();
+
+        if ( pData == nullptr || pSize < HEADER_SIZE || !std::equal(std::begin(gMagic), std::end(gMagic), pData) || pData[4] != VERSION )
+            return false;
+
+        mData.assign( pData, pData + pSize );
+
+        return true;
+    }
+
+    void EventRecorder::Rewind() noexcept
+    {
+        mReadPos = HEADER_SIZE;
+        mReadFrame = 0;
+    }
+
+    bool EventRecorder::ReplayFrame( ecs_vec<ecs_uint8_t>* const pThreads )
+    {
+        const ecs_size_t dataSize = mData.size();
+        ecs_uint64_t frameDelta = 0;
+
+        if ( mReadPos >= dataSize || !readVarint(frameDelta) )
+            return false;
+
+        mReadFrame += frameDelta;
+
+        for ( ;; )
+        {
+            ecs_uint64_t type = 0;
+            ecs_uint64_t payloadSize = 0;
+
+            if ( !readVarint(type) || dataSize - mReadPos < 2 )
+                return false;
+
+            const ecs_uint8_t thread = mData[mReadPos++];
+            const bool sent = mData[mReadPos++] != 0;
+
+            if ( !readVarint(payloadSize) || payloadSize > dataSize - mReadPos )
+                return false;
+
+            const ecs_uint8_t* const payload = mData.data() + mReadPos;
+            mReadPos += static_cast<ecs_size_t>( payloadSize );
+
+            auto codec = mCodecs.find( static_cast<ecs_TypeID>(type) );
+            event_ptr event = codec != mCodecs.end() && codec->second.mRead != nullptr ? codec->second.mRead( payload, static_cast<ecs_size_t>(payloadSize) ) : event_ptr( nullptr );
+
+            if ( event != nullptr && sent )
+                ecs_Events::sendEvent( event, thread );
+            else if ( event != nullptr )
+            {
+                ecs_Events::queueEvent( event, thread );
+
+                if ( pThreads != nullptr && std::find(pThreads->cbegin(), pThreads->cend(), thread) == pThreads->cend() )
+                    pThreads->push_back( thread );
+            }
+
+            if ( mReadPos >= dataSize )
+                break;
+
+            // Record of next frame is read again by next call.
+            const ecs_size_t pos = mReadPos;
+
+            if ( !readVarint(frameDelta) )
+                return false;
+
+            if ( frameDelta != 0 )
+            {
+                mReadPos = pos;
+                break;
+            }
+        }
+
+        return true;
+    }
+
+    ecs_size_t EventRecorder::Replay()
+    {
+        ecs_vec<ecs_uint8_t> threads;
+        ecs_size_t result = 0;
+
+        while ( ReplayFrame(&threads) )
+        {
+            for ( const ecs_uint8_t thread : threads )
+                ecs_Events::Update( thread );
+
+            threads.clear();
+            result++;
+        }
+
+        return result;
+    }
+
+    void EventRecorder::Clear() noexcept
+    {
+        ecs_SpinLock lock( &mMutex );
+
+        mData.clear();
+        mPayload.clear();
+        mFrame = 0;
+        mRecordFrame = 0;
+        mCount = 0;
+        mReadPos = HEADER_SIZE;
+        mReadFrame = 0;
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
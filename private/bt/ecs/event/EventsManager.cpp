@@ -51,6 +51,16 @@
 #include "../../../../public/bt/ecs/event/IEventListener.hxx"
 #endif // !ECS_I_EVENT_LISTENER_HXX
 
+// Include ecs::EventRecorder
+#ifndef ECS_EVENT_RECORDER_HPP
+#include "../../../../public/bt/ecs/event/EventRecorder.hpp"
+#endif // !ECS_EVENT_RECORDER_HPP
+
+// Include ecs::World
+#ifndef ECS_WORLD_HPP
+#include "../../../../public/bt/ecs/world/World.hpp"
+#endif // !ECS_WORLD_HPP
+
 // DEBUG
 #if defined( BT_DEBUG ) || defined( DEBUG )
 
@@ -96,98 +106,383 @@ namespace ecs
               mIDStorage(),
               mIDMutex(),
               mEventsByThread(),
-              mEventsMutex(),
+              mEventLanes(),
+              mEventCoalescing(),
+              mTimers(),
+              mTimersCount( 0 ),
+              mTimersMutex(),
               mEventListeners(),
-              mEventListenersMutex()
+              mEventListenersMutex(),
+              mRetiredListeners(),
+              mRetiredRecorders(),
+              mRetired( false ),
+              mReaders( 0 ),
+              mStatsEnabled( false ),
+              mEventCounters(),
+              mRecorder(),
+              mRecorderPtr( nullptr )
     {
+        for( ecs_atomic<ecs_uint8_t>& lane : mEventLanes )
+            lane.store( ECS_EVENT_DEFAULT_LANE, std::memory_order_relaxed );
+
+        for( ecs_atomic<event_listeners_ptr>& listeners : mEventListeners )
+            listeners.store( nullptr, std::memory_order_relaxed );
     }
 
-    EventsManager::~EventsManager() = default;
+    EventsManager::~EventsManager()
+    {
+        // Readers hold EventsManager instance, so none is alive.
+        for( ecs_atomic<event_listeners_ptr>& listeners : mEventListeners )
+            delete listeners.load( std::memory_order_relaxed );
+
+        for( const event_listeners_ptr listeners : mRetiredListeners )
+            delete listeners;
+    }
 
     // ===========================================================
     // GETTERS & SETTERS
     // ===========================================================
 
     ecs_sptr<EventsManager> EventsManager::getInstance()
-    { return mInstanceHolder.getItem(); }
+    {
+        ecs_World* const world = ecs_World::getCurrent();
+        return world != nullptr ? world->getEvents() : mInstanceHolder.getItem();
+    }
 
-    EventsManager::events_queues_storage& EventsManager::getEventsQueue( const unsigned char pThread )
+    EventsManager::ThreadEvents* EventsManager::getEventsQueue( const unsigned char pThread ) noexcept
     {
-        ecs_SpinLock lock( &mEventsMutex );
-        return mEventsByThread[pThread];
+#if defined( BT_DEBUG ) || defined( DEBUG ) // DEBUG
+        ecs_assert( pThread < ECS_MAX_EVENT_THREADS && "EventsManager::getEventsQueue: Thread-Type out of range, see ECS_MAX_EVENT_THREADS." );
+#endif // DEBUG
+
+        return pThread < ECS_MAX_EVENT_THREADS ? &mEventsByThread[pThread] : nullptr;
     }
 
-    EventsManager::event_listeners_storage& EventsManager::getEventListeners( const ecs_TypeID pType )
+    EventsManager::event_listeners_ptr EventsManager::getEventListeners( const ecs_TypeID pType ) const noexcept
     {
-        ecs_SpinLock lock( &mEventListenersMutex );
-        return mEventListeners[pType];
+        if ( pType >= ECS_MAX_EVENT_TYPES )
+            return event_listeners_ptr( nullptr );
+
+        return mEventListeners[pType].load( std::memory_order_seq_cst );
     }
 
-    ECS_API EventsManager::event_ptr EventsManager::getNextEvent( events_queues_storage& eventsStorage )
+    void EventsManager::setEventListeners( const ecs_TypeID pType, ecs_uptr<event_listeners_vector> pListeners )
     {
-        ecs_SpinLock  lock( &eventsStorage.mMutex );
+        // Slot is added before publishing, so retiring does not throw.
+        mRetiredListeners.push_back( nullptr );
+        mRetiredListeners.back() = mEventListeners[pType].exchange( pListeners.release(), std::memory_order_seq_cst );
+
+        if ( mRetiredListeners.back() == nullptr )
+            mRetiredListeners.pop_back();
+        else
+            mRetired.store( true, std::memory_order_relaxed );
+
+        Reclaim();
+    }
+
+    ecs_EventCounters* EventsManager::getEventCounters( const ecs_TypeID pType ) noexcept
+    { return pType < ECS_MAX_EVENT_TYPES ? &mEventCounters[pType] : nullptr; }
 
-        if ( !eventsStorage.mItem.empty() )
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    char EventsManager::handleEvent( event_ptr& pEvent, const bool pAsync, const ecs_uint8_t pThread )
+    {
+        const ecs_TypeID type = pEvent->getTypeID();
+        const Reader reader( mReaders );
+        const event_listeners_ptr listeners = getEventListeners( type );
+
+        char result = 0;
+
+        if ( listeners != nullptr )
         {
-            event_ptr result = eventsStorage.mItem.front();
+            const bool measured = mStatsEnabled.load( std::memory_order_relaxed );
+            ecs_EventCounters* const typeCounters = measured ? getEventCounters( type ) : nullptr;
+            ecs_EventCounters* const threadCounters = measured && pThread < ECS_MAX_EVENT_THREADS ? &mEventsByThread[pThread].mCounters : nullptr;
 
-            if ( result != nullptr && !result->isRepeatable() )
-                eventsStorage.mItem.pop_front();
+            for( const ListenerEntry& entry : *listeners )
+            {
+                if ( !mEnabled )
+                    break;
 
-            return result;
+                const ecs_time_point start = measured ? ecs_clock::now() : ecs_time_point();
+                bool handled = false;
+
+                try
+                {
+                    handled = (result = entry.mListener->OnEvent( pEvent, pAsync, pThread )) != 0;
+                }
+                catch( const std::exception& pException )
+                {
+#if defined( DEBUG ) // DEBUG
+                    ecs_String logMsg = u8"EventsManager::handleEvent: ERROR ";
+                    logMsg += pException.what();
+                    ecs_log::Print( logMsg.c_str(), static_cast<ecs_uint8_t>(ecs_log_level::Error) );
+#endif // DEBUG
+                    pEvent->onError( pEvent, pException, pAsync, pThread );
+                    result = -1;
+                }
+
+                if ( measured )
+                {
+                    const ecs_nanoseconds time = std::chrono::duration_cast<ecs_nanoseconds>( ecs_clock::now() - start );
+                    entry.mCounters->Called( time );
+
+                    if ( typeCounters != nullptr )
+                        typeCounters->addListenerTime( time );
+
+                    if ( threadCounters != nullptr )
+                        threadCounters->addListenerTime( time );
+                }
+
+                if ( handled )
+                    break;
+            }
         }
 
-        return event_ptr( nullptr );
+        pEvent->onSend( pEvent, pAsync, pThread );
+
+        return result;
     }
 
-    ECS_API EventsManager::event_listener EventsManager::getNextEventListener( ecs_size_t& pIdx, event_listeners_storage& listenersStorage )
+    void EventsManager::updateEventListeners( const ecs_TypeID pType, event_listener& pListener, const bool pSubscribe )
     {
-        ecs_SpinLock lock( &listenersStorage.mMutex );
+#if defined( BT_DEBUG ) || defined( DEBUG ) // DEBUG
+        ecs_assert( pType < ECS_MAX_EVENT_TYPES && "EventsManager::updateEventListeners: Type-ID out of range, see ECS_MAX_EVENT_TYPES." );
+#endif // DEBUG
 
-        if ( !listenersStorage.mItem.empty() && listenersStorage.mItem.size() < pIdx + 1 )
+        if ( pType >= ECS_MAX_EVENT_TYPES )
+            return;
+
+        ecs_SpinLock lock( &mEventListenersMutex );
+
+        // Retired Event Listeners are freed under same lock, so writer needs no Reader.
+        const event_listeners_ptr current = getEventListeners( pType );
+        ecs_size_t index = 0;
+
+        if ( current != nullptr )
         {
-            pIdx++;
-            return listenersStorage.mItem[pIdx];
+            const ecs_size_t listenersCount = current->size();
+
+            while ( index < listenersCount && (*current)[index].mListener != pListener )
+                index++;
         }
 
-        return event_listener( nullptr );
+        const bool stored = current != nullptr && index < current->size();
+
+        if ( pSubscribe )
+        {
+#if defined( DEBUG ) // DEBUG
+            ecs_assert( !stored && "EventsManager::Subscribe - already stored." );
+#endif // DEBUG
+
+            if ( stored )
+                return;
+
+            ecs_uptr<event_listeners_vector> listeners( current != nullptr ? new event_listeners_vector( *current ) : new event_listeners_vector() );
+            listeners->push_back( ListenerEntry{ pListener, ecs_Shared<ecs_EventListenerCounters>() } );
+            setEventListeners( pType, std::move(listeners) );
+        }
+        else if ( stored )
+        {
+            if ( current->size() == 1 )
+            {
+                setEventListeners( pType, ecs_uptr<event_listeners_vector>() );
+                return;
+            }
+
+            ecs_uptr<event_listeners_vector> listeners( new event_listeners_vector(*current) );
+            ecs_VectorUtil<ListenerEntry>::SwapPopByIdx( *listeners, index );
+            setEventListeners( pType, std::move(listeners) );
+        }
     }
 
-    // ===========================================================
-    // METHODS
-    // ===========================================================
+    void EventsManager::Reclaim() noexcept
+    {
+        if ( mRetiredListeners.empty() && mRetiredRecorders.empty() )
+            return;
 
-    char EventsManager::handleEvent( event_ptr& pEvent, const bool pAsync, const ecs_uint8_t pThread )
+        // Readers, created after this check, can load only published pointers.
+        if ( mReaders.load(std::memory_order_seq_cst) != 0 )
+            return;
+
+        for( const event_listeners_ptr listeners : mRetiredListeners )
+            delete listeners;
+
+        mRetiredListeners.clear();
+        mRetiredRecorders.clear();
+        mRetired.store( false, std::memory_order_relaxed );
+    }
+
+    ecs_size_t EventsManager::sendEvents( ecs_EventsQueue& pLane, const ecs_size_t pCount, const ecs_uint8_t pThread, const ecs_time_point pDeadline, const bool pTimed )
     {
-        event_listeners_storage& listenersStorage = getEventListeners( pEvent->getTypeID() );
+        ecs_size_t result = 0;
+        ecs_time_point queued;
 
-        char result = 0;
-        ecs_size_t listenerIdx = 0;
-        event_listener eventListener;
-        while( (eventListener = getNextEventListener( listenerIdx, listenersStorage )) != nullptr && mEnabled )
+        while( result < pCount && mEnabled )
         {
-            try
+            event_ptr event = pLane.getNext( &queued );
+
+            if ( event == nullptr )
+                break;
+
+            // Repeatable Event stays queued. Only Events queued with time are counted in depth.
+            const bool timed = queued != ecs_time_point();
+            const bool dequeued = timed && !event->isRepeatable();
+
+            if ( mStatsEnabled.load(std::memory_order_relaxed) )
             {
-                if ( (result = eventListener->OnEvent( pEvent, pAsync, pThread )) != 0 )
-                    break;
+                ecs_EventCounters& threadCounters = mEventsByThread[pThread].mCounters;
+                ecs_EventCounters* const typeCounters = getEventCounters( event->getTypeID() );
+                const ecs_nanoseconds latency = timed ? std::chrono::duration_cast<ecs_nanoseconds>( ecs_clock::now() - queued ) : ecs_nanoseconds::zero();
+
+                threadCounters.Dispatched( dequeued );
+
+                if ( timed )
+                    threadCounters.addLatency( latency );
+
+                if ( typeCounters != nullptr )
+                {
+                    typeCounters->Dispatched( dequeued );
+
+                    if ( timed )
+                        typeCounters->addLatency( latency );
+                }
             }
-            catch( const std::exception& pException )
+            else if ( dequeued )
             {
-#if defined( DEBUG ) // DEBUG
-                ecs_String logMsg = u8"EventsManager::handleEvent: ERROR ";
-                logMsg += pException.what();
-                ecs_log::Print( logMsg.c_str(), static_cast<ecs_uint8_t>(ecs_log_level::Error) );
-#endif // DEBUG
-                pEvent->onError( pEvent, pException, pAsync, pThread );
-                result = -1;
+                // Queued while counting was enabled.
+                ecs_EventCounters* const typeCounters = getEventCounters( event->getTypeID() );
+
+                mEventsByThread[pThread].mCounters.Dequeued();
+
+                if ( typeCounters != nullptr )
+                    typeCounters->Dequeued();
             }
+
+            handleEvent( event, true, pThread );
+            result++;
+
+            if ( pTimed && ecs_clock::now() >= pDeadline )
+                break;
         }
 
-        pEvent->onSend( pEvent, pAsync, pThread );
+        return result;
+    }
+
+    void EventsManager::pushEvent( const event_ptr& pEvent, const ecs_uint8_t pThread )
+    {
+        const ecs_TypeID type = pEvent->getTypeID();
+        const bool measured = mStatsEnabled.load( std::memory_order_relaxed );
+        ecs_EventCounters* const typeCounters = measured ? getEventCounters( type ) : nullptr;
+        ThreadEvents* const threadEvents = getEventsQueue( pThread );
+
+        if ( typeCounters != nullptr )
+            typeCounters->Queued();
+
+        if ( threadEvents == nullptr )
+        {
+            if ( typeCounters != nullptr )
+                typeCounters->Dropped();
+
+            return;
+        }
+
+        const ecs_time_point time = measured ? ecs_clock::now() : ecs_time_point();
+
+        if ( measured )
+            threadEvents->mCounters.Queued();
+
+        if ( type >= ECS_MAX_EVENT_TYPES )
+        {
+            threadEvents->mLanes[ECS_EVENT_DEFAULT_LANE].Push( pEvent, 0, time );
+            return;
+        }
+
+        const ecs_uint8_t lane = mEventLanes[type].load( std::memory_order_relaxed );
+        ecs_EventsQueue::coalescing_key key = 0;
+
+        switch( static_cast<EEventCoalescing>( mEventCoalescing[type].load(std::memory_order_relaxed) ) )
+        {
+        case EEventCoalescing::Type:
+            key = static_cast<ecs_EventsQueue::coalescing_key>( type + 1 ) << 32;
+            break;
+        case EEventCoalescing::Target:
+            key = (static_cast<ecs_EventsQueue::coalescing_key>( type + 1 ) << 32) | pEvent->getTargetID();
+            break;
+        default:
+            break;
+        }
+
+        threadEvents->mLanes[lane].Push( pEvent, key, time );
+    }
+
+    void EventsManager::fireTimers()
+    {
+        if ( mTimersCount.load(std::memory_order_acquire) == 0 )
+            return;
+
+        ecs_vec<ecs_TimerWheel::Fired> fired;
+
+        {
+            ecs_SpinLock lock( &mTimersMutex );
+            mTimers.Advance( mTimers.getTick(ecs_clock::now()), fired );
+            mTimersCount.store( mTimers.Count(), std::memory_order_release );
+        }
+
+        for( const ecs_TimerWheel::Fired& event : fired )
+        {
+            recordEvent( event.mEvent, event.mThread, false );
+            pushEvent( event.mEvent, event.mThread );
+        }
+    }
+
+    ecs_TimerID EventsManager::scheduleEvent( const event_ptr& pEvent, const ecs_uint8_t pThread, const ecs_uint64_t pDue, const ecs_uint64_t pPeriod )
+    {
+#if defined( BT_DEBUG ) || defined( DEBUG ) // DEBUG
+        ecs_assert( pEvent != nullptr && "EventsManager::scheduleEvent: Event is null." );
+        ecs_assert( pThread < ECS_MAX_EVENT_THREADS && "EventsManager::scheduleEvent: Thread-Type out of range, see ECS_MAX_EVENT_THREADS." );
+#endif // DEBUG
+
+        if ( pEvent == nullptr || pThread >= ECS_MAX_EVENT_THREADS )
+            return ECS_INVALID_TIMER_ID;
+
+        ecs_uint64_t due = pDue;
+
+        // Due already, queue now.
+        if ( due <= mTimers.getTick(ecs_clock::now()) )
+        {
+            recordEvent( pEvent, pThread, false );
+            pushEvent( pEvent, pThread );
+
+            if ( pPeriod == 0 )
+                return ECS_INVALID_TIMER_ID;
+
+            due += pPeriod;
+        }
+
+        ecs_SpinLock lock( &mTimersMutex );
+
+        const ecs_TimerID result = mTimers.Schedule( pEvent, pThread, due, pPeriod );
+        mTimersCount.store( mTimers.Count(), std::memory_order_release );
 
         return result;
     }
 
+    void EventsManager::recordEvent( const event_ptr& pEvent, const ecs_uint8_t pThread, const bool pSent )
+    {
+        // Relaxed check skips Reader when not recording.
+        if ( pEvent == nullptr || mRecorderPtr.load(std::memory_order_relaxed) == nullptr )
+            return;
+
+        const Reader reader( mReaders );
+        ecs_EventRecorder* const recorder = mRecorderPtr.load( std::memory_order_seq_cst );
+
+        if ( recorder != nullptr )
+            recorder->Record( *pEvent, pThread, pSent );
+    }
+
     ECS_API void EventsManager::Subscribe( const ecs_TypeID eventType, event_listener& pListener )
     {
 #if defined( BT_DEBUG ) || defined( DEBUG ) // DEBUG
@@ -200,17 +495,7 @@ namespace ecs
         if ( instance == nullptr )
             return;
 
-        event_listeners_storage& listeners = instance->getEventListeners( eventType );
-        ecs_SpinLock lock( &listeners.mMutex );
-
-#if defined( DEBUG ) // DEBUG
-        ecs_assert( !ecs_VectorUtil<event_listener>::Find( listeners.mItem, pListener, nullptr ) && "EventsManager::Subscribe - already stored." );
-#else // !DEBUG
-        if ( ecs_VectorUtil<event_listener>::Find(listeners.mItem, pListener, nullptr) )
-            return;
-#endif // DEBUG
-
-        listeners.mItem.push_back( pListener );
+        instance->updateEventListeners( eventType, pListener, true );
     }
 
     ECS_API void EventsManager::SubscribeBatch( const ecs_vec<ecs_TypeID>& pTypes, event_listener& pListener )
@@ -228,10 +513,7 @@ namespace ecs
         if ( instance == nullptr )
             return;
 
-        event_listeners_storage& listeners = instance->getEventListeners( eventType );
-        ecs_SpinLock lock( &listeners.mMutex );
-
-        ecs_VectorUtil<event_listener>::SwapPop( listeners.mItem, pListener );
+        instance->updateEventListeners( eventType, pListener, false );
     }
 
     ECS_API void EventsManager::UnsubscribeBatch( const ecs_vec<ecs_TypeID>& pTypes, event_listener& pListener )
@@ -241,10 +523,23 @@ namespace ecs
     {
         auto instance = getInstance();
 
-        if ( instance != nullptr )
-            return instance->handleEvent( pEvent, false, pThread );
+        if ( instance == nullptr )
+            return 0;
 
-        return 0;
+        instance->recordEvent( pEvent, pThread, true );
+
+        if ( instance->mStatsEnabled.load(std::memory_order_relaxed) )
+        {
+            ecs_EventCounters* const typeCounters = instance->getEventCounters( pEvent->getTypeID() );
+
+            if ( typeCounters != nullptr )
+                typeCounters->Dispatched( false );
+
+            if ( pThread < ECS_MAX_EVENT_THREADS )
+                instance->mEventsByThread[pThread].mCounters.Dispatched( false );
+        }
+
+        return instance->handleEvent( pEvent, false, pThread );
     }
 
     ECS_API void EventsManager::queueEvent( event_ptr& pEvent, const ecs_uint8_t pThread )
@@ -254,96 +549,373 @@ namespace ecs
         if ( instance == nullptr )
             return;
 
-        events_queues_storage& eventsStorage = instance->getEventsQueue( pThread );
-        ecs_SpinLock lock( &eventsStorage.mMutex );
-        eventsStorage.mItem.push_back( pEvent );
+        instance->recordEvent( pEvent, pThread, false );
+        instance->pushEvent( pEvent, pThread );
+    }
+
+    ECS_API ecs_TimerID EventsManager::queueEventAt( event_ptr& pEvent, const ecs_time_point pTime, const ecs_uint8_t pThread )
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr )
+            return ECS_INVALID_TIMER_ID;
+
+        return instance->scheduleEvent( pEvent, pThread, instance->mTimers.getTick( pTime, true ), 0 );
+    }
+
+    ECS_API ecs_TimerID EventsManager::queueEventAfter( event_ptr& pEvent, const ecs_microseconds pDelay, const ecs_uint8_t pThread, const ecs_microseconds pPeriod )
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr )
+            return ECS_INVALID_TIMER_ID;
+
+        return instance->scheduleEvent( pEvent, pThread, instance->mTimers.getTick( ecs_clock::now() + pDelay, true ), ecs_TimerWheel::getTicks( pPeriod ) );
+    }
+
+    ECS_API bool EventsManager::CancelEvent( const ecs_TimerID pTimer ) noexcept
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr )
+            return false;
+
+        ecs_SpinLock lock( &instance->mTimersMutex );
+
+        if ( !instance->mTimers.Cancel(pTimer) )
+            return false;
+
+        instance->mTimersCount.store( instance->mTimers.Count(), std::memory_order_release );
+
+        return true;
     }
 
-    ECS_API void EventsManager::removeEvents( events_queues_storage& eventsStorage, const ecs_TypeID pType, const ecs_ObjectID pID )
+    ECS_API void EventsManager::FlushEvents( const ecs_TypeID pType, const unsigned char pThread )
     {
-        ecs_SpinLock  lock( &eventsStorage.mMutex );
-        ecs_vec<event_ptr> eventsToRemove;
+        auto instance = getInstance();
 
-        for( event_ptr& event : eventsStorage.mItem )
+        if ( instance == nullptr )
+            return;
+
+        if ( pThread != 0 )
         {
-            if ( event != nullptr && event->getTypeID() == pType )
+            ThreadEvents* const threadEvents = instance->getEventsQueue( pThread );
+
+            if ( threadEvents != nullptr )
             {
-                if ( pID != ECS_INVALID_OBJECT_ID )
-                {
-                    if ( pID == event->getID() )
-                        eventsToRemove.push_back( event );
-                }
-                else
-                    eventsToRemove.push_back( event );
+                for( ecs_EventsQueue& lane : threadEvents->mLanes )
+                    lane.Remove( pType );
             }
+
+            return;
         }
 
-        for( event_ptr& event : eventsToRemove )
+        for( ThreadEvents& threadEvents : instance->mEventsByThread )
         {
-            auto pos = eventsStorage.mItem.begin();
-            auto end = eventsStorage.mItem.cend();
+            for( ecs_EventsQueue& lane : threadEvents.mLanes )
+                lane.Remove( pType );
+        }
+    }
+
+    ECS_API void EventsManager::RemoveEvent( const ecs_TypeID pType, const ecs_ObjectID pID, const unsigned char pThread )
+    {
+        auto instance = getInstance();
 
-            while( pos != end )
+        if ( instance == nullptr )
+            return;
+
+        ThreadEvents* const threadEvents = instance->getEventsQueue( pThread );
+
+        if ( threadEvents == nullptr )
+            return;
+
+        for( ecs_EventsQueue& lane : threadEvents->mLanes )
+            lane.Remove( pType, pID );
+    }
+
+    ECS_API ecs_size_t EventsManager::Update( const ecs_uint8_t pThread, const ecs_size_t pMaxEvents, const ecs_microseconds pMaxTime )
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr )
+            return 0;
+
+        ThreadEvents* const threadEvents = instance->getEventsQueue( pThread );
+
+        if ( threadEvents == nullptr )
+            return 0;
+
+        // Retired Event Listeners, not freed by writers due to Readers.
+        if ( instance->mRetired.load(std::memory_order_relaxed) )
+        {
+            ecs_SpinLock lock( &instance->mEventListenersMutex );
+            instance->Reclaim();
+        }
+
+        instance->fireTimers();
+
+        // Batches are fixed before sending, requeued Events are appended after them.
+        ecs_size_t batches[ECS_EVENT_LANES];
+        ecs_size_t sent[ECS_EVENT_LANES];
+        ecs_uint8_t order[ECS_EVENT_LANES];
+        ecs_uint8_t ordered = 0;
+        // Counted Events are collected even if counting is disabled, to keep depth.
+        ecs_vec<ecs_TypeID>* const dropped = &threadEvents->mDropped;
+
+        for( ecs_uint8_t lane = 0; lane < ECS_EVENT_LANES; lane++ )
+        {
+            batches[lane] = threadEvents->mLanes[lane].Drain( dropped );
+            sent[lane] = 0;
+
+            // Starving lanes first.
+            if ( threadEvents->mStarvedUpdates[lane] >= ECS_EVENT_STARVATION_UPDATES )
+                order[ordered++] = lane;
+        }
+
+        for( ecs_uint8_t lane = 0; lane < ECS_EVENT_LANES; lane++ )
+        {
+            if ( threadEvents->mStarvedUpdates[lane] < ECS_EVENT_STARVATION_UPDATES )
+                order[ordered++] = lane;
+        }
+
+        if ( !dropped->empty() )
+        {
+            const bool measured = instance->mStatsEnabled.load( std::memory_order_relaxed );
+
+            for( const ecs_TypeID type : *dropped )
             {
-                if ( *pos == event )
+                ecs_EventCounters* const typeCounters = instance->getEventCounters( type );
+
+                if ( measured )
                 {
-                    eventsStorage.mItem.erase( pos );
-                    break;
+                    if ( typeCounters != nullptr )
+                        typeCounters->Dropped();
+
+                    threadEvents->mCounters.Dropped();
                 }
+                else
+                {
+                    if ( typeCounters != nullptr )
+                        typeCounters->Dequeued();
 
-                pos++;
+                    threadEvents->mCounters.Dequeued();
+                }
             }
+
+            dropped->clear();
         }
+
+        const bool timed = pMaxTime > ecs_microseconds::zero();
+        const ecs_time_point deadline = timed ? ecs_clock::now() + pMaxTime : ecs_time_point();
+        ecs_size_t budget = pMaxEvents > 0 ? pMaxEvents : ecs_NumericUtil<ecs_size_t>::MAX;
+
+        for( ecs_uint8_t i = 0; i < ECS_EVENT_LANES && budget > 0 && instance->mEnabled; i++ )
+        {
+            const ecs_uint8_t lane = order[i];
+            const ecs_size_t laneBudget = threadEvents->mBudgets[lane].load( std::memory_order_relaxed );
+
+            ecs_size_t eventsCount = batches[lane] < budget ? batches[lane] : budget;
+
+            if ( laneBudget > 0 && laneBudget < eventsCount )
+                eventsCount = laneBudget;
+
+            sent[lane] = instance->sendEvents( threadEvents->mLanes[lane], eventsCount, pThread, deadline, timed );
+            budget -= sent[lane];
+
+            // Empty lanes don't stop, so at least one Event is sent.
+            if ( timed && sent[lane] > 0 && ecs_clock::now() >= deadline )
+                break;
+        }
+
+        ecs_size_t result = 0;
+
+        for( ecs_uint8_t lane = 0; lane < ECS_EVENT_LANES; lane++ )
+        {
+            if ( batches[lane] > 0 && sent[lane] == 0 )
+                threadEvents->mStarvedUpdates[lane]++;
+            else
+                threadEvents->mStarvedUpdates[lane] = 0;
+
+            result += threadEvents->mLanes[lane].Count();
+        }
+
+        return result;
     }
 
-    ECS_API void EventsManager::FlushEvents( const ecs_TypeID pType, const unsigned char pThread )
+    ECS_API void EventsManager::setEventPriority( const ecs_TypeID pType, const ecs_uint8_t pLane ) noexcept
     {
+#if defined( BT_DEBUG ) || defined( DEBUG ) // DEBUG
+        ecs_assert( pType < ECS_MAX_EVENT_TYPES && "EventsManager::setEventPriority: Type-ID out of range, see ECS_MAX_EVENT_TYPES." );
+        ecs_assert( pLane < ECS_EVENT_LANES && "EventsManager::setEventPriority: lane out of range, see ECS_EVENT_LANES." );
+#endif // DEBUG
+
         auto instance = getInstance();
 
-        if ( instance == nullptr )
+        if ( instance != nullptr && pType < ECS_MAX_EVENT_TYPES && pLane < ECS_EVENT_LANES )
+            instance->mEventLanes[pType].store( pLane, std::memory_order_relaxed );
+    }
+
+    ECS_API ecs_uint8_t EventsManager::getEventPriority( const ecs_TypeID pType ) noexcept
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr || pType >= ECS_MAX_EVENT_TYPES )
+            return ECS_EVENT_DEFAULT_LANE;
+
+        return instance->mEventLanes[pType].load( std::memory_order_relaxed );
+    }
+
+    ECS_API void EventsManager::setEventCoalescing( const ecs_TypeID pType, const EEventCoalescing pCoalescing ) noexcept
+    {
+#if defined( BT_DEBUG ) || defined( DEBUG ) // DEBUG
+        ecs_assert( pType < ECS_MAX_EVENT_TYPES && "EventsManager::setEventCoalescing: Type-ID out of range, see ECS_MAX_EVENT_TYPES." );
+#endif // DEBUG
+
+        auto instance = getInstance();
+
+        if ( instance != nullptr && pType < ECS_MAX_EVENT_TYPES )
+            instance->mEventCoalescing[pType].store( static_cast<ecs_uint8_t>(pCoalescing), std::memory_order_relaxed );
+    }
+
+    ECS_API EEventCoalescing EventsManager::getEventCoalescing( const ecs_TypeID pType ) noexcept
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr || pType >= ECS_MAX_EVENT_TYPES )
+            return EEventCoalescing::None;
+
+        return static_cast<EEventCoalescing>( instance->mEventCoalescing[pType].load(std::memory_order_relaxed) );
+    }
+
+    ECS_API void EventsManager::setLaneBudget( const ecs_uint8_t pThread, const ecs_uint8_t pLane, const ecs_size_t pMaxEvents ) noexcept
+    {
+#if defined( BT_DEBUG ) || defined( DEBUG ) // DEBUG
+        ecs_assert( pLane < ECS_EVENT_LANES && "EventsManager::setLaneBudget: lane out of range, see ECS_EVENT_LANES." );
+#endif // DEBUG
+
+        auto instance = getInstance();
+
+        if ( instance == nullptr || pLane >= ECS_EVENT_LANES )
             return;
 
-        if ( pThread != 0 )
+        ThreadEvents* const threadEvents = instance->getEventsQueue( pThread );
+
+        if ( threadEvents != nullptr )
+            threadEvents->mBudgets[pLane].store( pMaxEvents, std::memory_order_relaxed );
+    }
+
+    ECS_API void EventsManager::setStatsEnabled( const bool pEnabled ) noexcept
+    {
+        auto instance = getInstance();
+
+        if ( instance != nullptr )
+            instance->mStatsEnabled.store( pEnabled, std::memory_order_relaxed );
+    }
+
+    ECS_API bool EventsManager::isStatsEnabled() noexcept
+    {
+        auto instance = getInstance();
+
+        return instance != nullptr && instance->mStatsEnabled.load( std::memory_order_relaxed );
+    }
+
+    ECS_API ecs_EventStats EventsManager::getEventStats( const ecs_TypeID pType ) noexcept
+    {
+        auto instance = getInstance();
+        ecs_EventCounters* const counters = instance != nullptr ? instance->getEventCounters( pType ) : nullptr;
+
+        return counters != nullptr ? counters->getStats() : ecs_EventStats();
+    }
+
+    ECS_API ecs_EventStats EventsManager::getThreadStats( const ecs_uint8_t pThread ) noexcept
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr || pThread >= ECS_MAX_EVENT_THREADS )
+            return ecs_EventStats();
+
+        return instance->mEventsByThread[pThread].mCounters.getStats();
+    }
+
+    ECS_API ecs_EventListenerStats EventsManager::getListenerStats( const ecs_TypeID pType, const event_listener& pListener ) noexcept
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr )
+            return ecs_EventListenerStats();
+
+        const Reader reader( instance->mReaders );
+        const event_listeners_ptr listeners = instance->getEventListeners( pType );
+
+        if ( listeners != nullptr )
         {
-            events_queues_storage& eventsStorage = instance->getEventsQueue( pThread );
-            removeEvents( eventsStorage, pType );
-            return;
+            for( const ListenerEntry& entry : *listeners )
+            {
+                if ( entry.mListener == pListener )
+                    return entry.mCounters->getStats();
+            }
         }
 
-        auto pos = instance->mEventsByThread.begin();
-        auto end = instance->mEventsByThread.cend();
+        return ecs_EventListenerStats();
+    }
+
+    ECS_API void EventsManager::ResetStats() noexcept
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr )
+            return;
+
+        for( ThreadEvents& threadEvents : instance->mEventsByThread )
+            threadEvents.mCounters.Reset();
 
-        while( pos != end )
+        const Reader reader( instance->mReaders );
+
+        for( ecs_TypeID type = 0; type < ECS_MAX_EVENT_TYPES; type++ )
         {
-            events_queues_storage& eventsStorage = pos->second;
-            removeEvents( eventsStorage, pType );
-            pos++;
+            instance->mEventCounters[type].Reset();
+
+            const event_listeners_ptr listeners = instance->getEventListeners( type );
+
+            if ( listeners == nullptr )
+                continue;
+
+            for( const ListenerEntry& entry : *listeners )
+                entry.mCounters->Reset();
         }
     }
 
-    ECS_API void EventsManager::RemoveEvent( const ecs_TypeID pType, const ecs_ObjectID pID, const unsigned char pThread )
+    ECS_API void EventsManager::setRecorder( ecs_sptr<ecs_EventRecorder> pRecorder )
     {
         auto instance = getInstance();
 
         if ( instance == nullptr )
             return;
 
-        events_queues_storage& eventsStorage = instance->getEventsQueue( pThread );
-        removeEvents( eventsStorage, pType, pID );
+        ecs_SpinLock lock( &instance->mEventListenersMutex );
+
+        // Previous recorder can be used by Readers, so it is retired.
+        if ( instance->mRecorder != nullptr )
+        {
+            instance->mRetiredRecorders.push_back( instance->mRecorder );
+            instance->mRetired.store( true, std::memory_order_relaxed );
+        }
+
+        instance->mRecorderPtr.store( pRecorder.get(), std::memory_order_seq_cst );
+        instance->mRecorder = std::move( pRecorder );
+        instance->Reclaim();
     }
 
-    ECS_API void EventsManager::Update( const ecs_uint8_t pThread )
+    ECS_API ecs_sptr<ecs_EventRecorder> EventsManager::getRecorder() noexcept
     {
         auto instance = getInstance();
 
         if ( instance == nullptr )
-            return;
+            return ecs_sptr<ecs_EventRecorder>( nullptr );
 
-        events_queues_storage& eventsStorage = instance->getEventsQueue( pThread );
-        event_ptr event;
+        ecs_SpinLock lock( &instance->mEventListenersMutex );
 
-        while( ( event = getNextEvent(eventsStorage) ) != nullptr && instance->mEnabled )
-            instance->handleEvent( event, true, pThread );
+        return instance->mRecorder;
     }
 
     ECS_API ecs_ObjectID EventsManager::generateEventID(const ecs_TypeID pType) ECS_NOEXCEPT
@@ -0,0 +1,243 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_EVENTS_QUEUE_HPP
+#include "../../../../public/bt/ecs/event/EventsQueue.hpp"
+#endif // !ECS_EVENTS_QUEUE_HPP
+
+// Include ecs::IEvent
+#ifndef ECS_I_EVENT_HXX
+#include "../../../../public/bt/ecs/event/IEvent.hxx"
+#endif // !ECS_I_EVENT_HXX
+
+// ===========================================================
+// ecs::EventsQueue
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTANTS
+    // ===========================================================
+
+    constexpr const ecs_size_t EventsQueue::CACHE_LINE;
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    EventsQueue::EventsQueue() noexcept
+        : mHead( &mStub ),
+          mHeadPadding(),
+          mTail( &mStub ),
+          mStub{ { nullptr }, event_ptr( nullptr ), 0, ecs_time_point(), ECS_INVALID_TYPE_ID, ECS_INVALID_OBJECT_ID },
+          mPending(),
+          mCoalesced()
+    {
+    }
+
+    EventsQueue::~EventsQueue() noexcept
+    {
+        Clear();
+
+        if ( mTail != &mStub )
+            delete mTail;
+    }
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    EventsQueue::event_ptr EventsQueue::getNext( ecs_time_point* const pTime )
+    {
+        if ( mPending.empty() )
+            return event_ptr( nullptr );
+
+        Pending& front = mPending.front();
+        event_ptr result = std::move( front.mEvent );
+        const coalescing_key key = front.mKey;
+        const bool counted = front.mCounted;
+
+        if ( pTime != nullptr )
+            *pTime = front.mTime;
+
+        if ( key != 0 )
+            mCoalesced.erase( key );
+
+        mPending.pop_front();
+
+        if ( result != nullptr && result->isRepeatable() )
+        {
+            mPending.push_back( Pending{ result, key, ecs_time_point(), counted } );
+
+            if ( key != 0 )
+                mCoalesced[key] = &mPending.back();
+        }
+
+        return result;
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void EventsQueue::Link( Node* const pNode ) noexcept
+    {
+        Node* const prev = mHead.exchange( pNode, std::memory_order_acq_rel );
+        prev->mNext.store( pNode, std::memory_order_release );
+    }
+
+    EventsQueue::Node* EventsQueue::Pop() noexcept
+    {
+        Node* const next = mTail->mNext.load( std::memory_order_acquire );
+
+        if ( next == nullptr )
+            return nullptr;
+
+        if ( mTail != &mStub )
+            delete mTail;
+
+        mTail = next;
+
+        return next;
+    }
+
+    void EventsQueue::removePending( const ecs_TypeID pType, const ecs_ObjectID pID, ecs_vec<ecs_TypeID>* const pDropped )
+    {
+        auto pos = mPending.begin();
+        bool removed = false;
+
+        while ( pos != mPending.end() )
+        {
+            const event_ptr& event = pos->mEvent;
+
+            if ( event != nullptr && event->getTypeID() == pType && (pID == ECS_INVALID_OBJECT_ID || event->getID() == pID) )
+            {
+                if ( pDropped != nullptr && pos->mCounted )
+                    pDropped->push_back( pType );
+
+                pos = mPending.erase( pos );
+                removed = true;
+            }
+            else
+                pos++;
+        }
+
+        // Erase invalidates references, rebuild.
+        if ( removed && !mCoalesced.empty() )
+        {
+            mCoalesced.clear();
+
+            for ( Pending& pending : mPending )
+            {
+                if ( pending.mKey != 0 )
+                    mCoalesced[pending.mKey] = &pending;
+            }
+        }
+    }
+
+    void EventsQueue::addPending( event_ptr&& pEvent, const coalescing_key pKey, const ecs_time_point pTime, ecs_vec<ecs_TypeID>* const pDropped )
+    {
+        if ( pKey != 0 )
+        {
+            auto pos = mCoalesced.find( pKey );
+
+            if ( pos != mCoalesced.end() )
+            {
+                Pending& pending = *pos->second;
+
+                // Only one of both Events stays counted.
+                if ( pDropped != nullptr && pending.mEvent != nullptr && pTime != ecs_time_point() )
+                    pDropped->push_back( pending.mEvent->getTypeID() );
+
+                // Replacing Event waits since replaced one was queued.
+                pending.mEvent = std::move( pEvent );
+                return;
+            }
+        }
+
+        mPending.push_back( Pending{ std::move(pEvent), pKey, pTime, pTime != ecs_time_point() } );
+
+        if ( pKey != 0 )
+            mCoalesced[pKey] = &mPending.back();
+    }
+
+    void EventsQueue::Push( const event_ptr& pEvent, const coalescing_key pKey, const ecs_time_point pTime )
+    { Link( new Node{ { nullptr }, pEvent, pKey, pTime, ECS_INVALID_TYPE_ID, ECS_INVALID_OBJECT_ID } ); }
+
+    void EventsQueue::Remove( const ecs_TypeID pType, const ecs_ObjectID pID )
+    { Link( new Node{ { nullptr }, event_ptr( nullptr ), 0, ecs_time_point(), pType, pID } ); }
+
+    ecs_size_t EventsQueue::Drain( ecs_vec<ecs_TypeID>* const pDropped )
+    {
+        Node* node;
+
+        while ( (node = Pop()) != nullptr )
+        {
+            if ( node->mEvent != nullptr )
+            {
+                addPending( std::move(node->mEvent), node->mKey, node->mTime, pDropped );
+                node->mEvent = nullptr;
+            }
+            else if ( node->mRemoveType != ECS_INVALID_TYPE_ID )
+                removePending( node->mRemoveType, node->mRemoveID, pDropped );
+        }
+
+        return mPending.size();
+    }
+
+    void EventsQueue::Clear() noexcept
+    {
+        while ( Pop() != nullptr )
+        {
+        }
+
+        mTail->mEvent = nullptr;
+        mCoalesced.clear();
+        mPending.clear();
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,287 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_TIMER_WHEEL_HPP
+#include "../../../../public/bt/ecs/event/TimerWheel.hpp"
+#endif // !ECS_TIMER_WHEEL_HPP
+
+// Include ecs::IEvent
+#ifndef ECS_I_EVENT_HXX
+#include "../../../../public/bt/ecs/event/IEvent.hxx"
+#endif // !ECS_I_EVENT_HXX
+
+// ===========================================================
+// ecs::TimerWheel
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTANTS
+    // ===========================================================
+
+    constexpr const ecs_uint32_t TimerWheel::LEVELS;
+    constexpr const ecs_uint32_t TimerWheel::SLOT_BITS;
+    constexpr const ecs_uint32_t TimerWheel::SLOTS;
+    constexpr const ecs_uint64_t TimerWheel::SLOT_MASK;
+    constexpr const ecs_uint64_t TimerWheel::MAX_DELTA;
+    constexpr const ecs_uint32_t TimerWheel::NO_INDEX;
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    TimerWheel::TimerWheel() noexcept
+        : mStart( ecs_clock::now() ),
+          mNow( 0 ),
+          mSlots(),
+          mNodes(),
+          mFree( NO_INDEX ),
+          mCount( 0 )
+    {
+        for ( ecs_uint32_t& slot : mSlots )
+            slot = NO_INDEX;
+    }
+
+    TimerWheel::~TimerWheel() noexcept = default;
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    ecs_uint64_t TimerWheel::getTick( const ecs_time_point pTime, const bool pRoundUp ) const noexcept
+    {
+        if ( pTime <= mStart )
+            return 0;
+
+        const ecs_uint64_t time = static_cast<ecs_uint64_t>( std::chrono::duration_cast<ecs_microseconds>(pTime - mStart).count() );
+
+        return pRoundUp ? (time + ECS_TIMER_TICK - 1) / ECS_TIMER_TICK : time / ECS_TIMER_TICK;
+    }
+
+    ecs_uint64_t TimerWheel::getTicks( const ecs_microseconds pDuration ) noexcept
+    {
+        if ( pDuration <= ecs_microseconds::zero() )
+            return 0;
+
+        return (static_cast<ecs_uint64_t>( pDuration.count() ) + ECS_TIMER_TICK - 1) / ECS_TIMER_TICK;
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    void TimerWheel::Link( const ecs_uint32_t pIndex ) noexcept
+    {
+        Node& node = mNodes[pIndex];
+
+        const ecs_uint64_t delta = node.mDue > mNow ? node.mDue - mNow : 0;
+        const ecs_uint64_t due = delta > MAX_DELTA ? mNow + MAX_DELTA : node.mDue;
+
+        ecs_uint32_t level = 0;
+
+        while ( level + 1 < LEVELS && delta >= (static_cast<ecs_uint64_t>( 1 ) << (SLOT_BITS * (level + 1))) )
+            level++;
+
+        const ecs_uint32_t slot = level * SLOTS + static_cast<ecs_uint32_t>( (due >> (SLOT_BITS * level)) & SLOT_MASK );
+
+        node.mSlot = static_cast<ecs_uint16_t>( slot );
+        node.mPrev = NO_INDEX;
+        node.mNext = mSlots[slot];
+
+        if ( node.mNext != NO_INDEX )
+            mNodes[node.mNext].mPrev = pIndex;
+
+        mSlots[slot] = pIndex;
+    }
+
+    void TimerWheel::Unlink( const ecs_uint32_t pIndex ) noexcept
+    {
+        Node& node = mNodes[pIndex];
+
+        if ( node.mPrev != NO_INDEX )
+            mNodes[node.mPrev].mNext = node.mNext;
+        else
+            mSlots[node.mSlot] = node.mNext;
+
+        if ( node.mNext != NO_INDEX )
+            mNodes[node.mNext].mPrev = node.mPrev;
+
+        node.mPrev = NO_INDEX;
+        node.mNext = NO_INDEX;
+    }
+
+    void TimerWheel::Release( const ecs_uint32_t pIndex ) noexcept
+    {
+        Node& node = mNodes[pIndex];
+
+        node.mEvent = nullptr;
+        node.mNext = mFree;
+
+        // Generation 0 is never used, so Timer ID is never 0.
+        if ( ++node.mGeneration == 0 )
+            node.mGeneration = 1;
+
+        mFree = pIndex;
+        mCount--;
+    }
+
+    void TimerWheel::Cascade( const ecs_uint32_t pSlot ) noexcept
+    {
+        ecs_uint32_t index = mSlots[pSlot];
+        mSlots[pSlot] = NO_INDEX;
+
+        while ( index != NO_INDEX )
+        {
+            const ecs_uint32_t next = mNodes[index].mNext;
+            Link( index );
+            index = next;
+        }
+    }
+
+    ecs_TimerID TimerWheel::Schedule( const event_ptr& pEvent, const ecs_uint8_t pThread, const ecs_uint64_t pDue, const ecs_uint64_t pPeriod )
+    {
+        ecs_uint32_t index;
+
+        if ( mFree != NO_INDEX )
+        {
+            index = mFree;
+            mFree = mNodes[index].mNext;
+        }
+        else
+        {
+            index = static_cast<ecs_uint32_t>( mNodes.size() );
+            mNodes.push_back( Node{ event_ptr( nullptr ), 0, 0, NO_INDEX, NO_INDEX, 1, 0, 0 } );
+        }
+
+        Node& node = mNodes[index];
+
+        node.mEvent = pEvent;
+        node.mDue = pDue > mNow ? pDue : mNow + 1;
+        node.mPeriod = pPeriod;
+        node.mThread = pThread;
+
+        Link( index );
+        mCount++;
+
+        return (static_cast<ecs_TimerID>( node.mGeneration ) << 32) | index;
+    }
+
+    bool TimerWheel::Cancel( const ecs_TimerID pTimer ) noexcept
+    {
+        const ecs_uint32_t index = static_cast<ecs_uint32_t>( pTimer & 0xFFFFFFFF );
+        const ecs_uint32_t generation = static_cast<ecs_uint32_t>( pTimer >> 32 );
+
+        if ( index >= mNodes.size() || mNodes[index].mGeneration != generation || mNodes[index].mEvent == nullptr )
+            return false;
+
+        Unlink( index );
+        Release( index );
+
+        return true;
+    }
+
+    void TimerWheel::Advance( const ecs_uint64_t pTick, ecs_vec<Fired>& pFired )
+    {
+        while ( mNow < pTick )
+        {
+            // Empty wheel, nothing to cascade or fire.
+            if ( mCount == 0 )
+            {
+                mNow = pTick;
+                break;
+            }
+
+            mNow++;
+
+            const ecs_uint32_t slot = static_cast<ecs_uint32_t>( mNow & SLOT_MASK );
+
+            // Slot of level 0 wrapped, move reached timers of higher levels down.
+            if ( slot == 0 )
+            {
+                for ( ecs_uint32_t level = LEVELS - 1; level > 0; level-- )
+                {
+                    if ( (mNow & ((static_cast<ecs_uint64_t>( 1 ) << (SLOT_BITS * level)) - 1)) == 0 )
+                        Cascade( level * SLOTS + static_cast<ecs_uint32_t>( (mNow >> (SLOT_BITS * level)) & SLOT_MASK ) );
+                }
+            }
+
+            ecs_uint32_t index = mSlots[slot];
+            mSlots[slot] = NO_INDEX;
+
+            while ( index != NO_INDEX )
+            {
+                Node& node = mNodes[index];
+                const ecs_uint32_t next = node.mNext;
+
+                pFired.push_back( Fired{ node.mEvent, node.mThread } );
+
+                if ( node.mPeriod > 0 )
+                {
+                    node.mDue = mNow + node.mPeriod;
+                    Link( index );
+                }
+                else
+                    Release( index );
+
+                index = next;
+            }
+        }
+    }
+
+    void TimerWheel::Clear() noexcept
+    {
+        for ( ecs_uint32_t& slot : mSlots )
+            slot = NO_INDEX;
+
+        for ( ecs_uint32_t index = 0; index < mNodes.size(); index++ )
+        {
+            if ( mNodes[index].mEvent != nullptr )
+                Release( index );
+        }
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,311 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_HIERARCHY_STORE_HPP
+#include "../../../../public/bt/ecs/hierarchy/HierarchyStore.hpp"
+#endif // !ECS_HIERARCHY_STORE_HPP
+
+// ===========================================================
+// ecs::HierarchyStore
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTANTS
+    // ===========================================================
+
+    constexpr const ecs_uint32_t HierarchyStore::NO_INDEX;
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    HierarchyStore::HierarchyStore() noexcept
+        : mLinks(),
+          mEntities(),
+          mParents(),
+          mDepths(),
+          mFirstChildren(),
+          mChildrenCounts(),
+          mValues(),
+          mCount( 0 ),
+          mDirty( false )
+    {
+    }
+
+    HierarchyStore::~HierarchyStore() noexcept = default;
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    ecs_Handle HierarchyStore::getParent( const ecs_Handle pEntity ) const noexcept
+    {
+        const Link* const link = getLink( pEntity );
+
+        if ( link == nullptr || link->mParent == NO_INDEX )
+            return ecs_Handle();
+
+        return mLinks[link->mParent].mEntity;
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    ecs_uint32_t HierarchyStore::Insert( const ecs_Handle pEntity )
+    {
+        const ecs_uint32_t slot = pEntity.getIndex();
+
+        if ( slot >= mLinks.size() )
+            mLinks.resize( slot + 1, Link{ ecs_Handle(), NO_INDEX, NO_INDEX, NO_INDEX, NO_INDEX, NO_INDEX, NO_INDEX } );
+
+        Link& link = mLinks[slot];
+
+        if ( link.mEntity == pEntity )
+            return slot;
+
+        // Slot of destroyed Entity, not removed from hierarchy.
+        if ( link.mEntity.isValid() )
+            Remove( link.mEntity );
+
+        link = Link{ pEntity, NO_INDEX, NO_INDEX, NO_INDEX, NO_INDEX, NO_INDEX, NO_INDEX };
+        mCount++;
+        mDirty = true;
+
+        return slot;
+    }
+
+    void HierarchyStore::Unlink( const ecs_uint32_t pSlot ) noexcept
+    {
+        Link& link = mLinks[pSlot];
+
+        if ( link.mParent == NO_INDEX )
+            return;
+
+        Link& parent = mLinks[link.mParent];
+
+        if ( link.mPrevSibling != NO_INDEX )
+            mLinks[link.mPrevSibling].mNextSibling = link.mNextSibling;
+        else
+            parent.mFirstChild = link.mNextSibling;
+
+        if ( link.mNextSibling != NO_INDEX )
+            mLinks[link.mNextSibling].mPrevSibling = link.mPrevSibling;
+        else
+            parent.mLastChild = link.mPrevSibling;
+
+        link.mParent = NO_INDEX;
+        link.mPrevSibling = NO_INDEX;
+        link.mNextSibling = NO_INDEX;
+        mDirty = true;
+    }
+
+    bool HierarchyStore::Attach( const ecs_Handle pEntity, const ecs_Handle pParent )
+    {
+        if ( !pEntity.isValid() || !pParent.isValid() || pEntity == pParent )
+            return false;
+
+        const ecs_uint32_t slot = Insert( pEntity );
+        const ecs_uint32_t parentSlot = Insert( pParent );
+
+        // Parent must not be descendant of Entity.
+        for ( ecs_uint32_t ancestor = mLinks[parentSlot].mParent; ancestor != NO_INDEX; ancestor = mLinks[ancestor].mParent )
+        {
+            if ( ancestor == slot )
+                return false;
+        }
+
+        Unlink( slot );
+
+        Link& link = mLinks[slot];
+        Link& parent = mLinks[parentSlot];
+
+        link.mParent = parentSlot;
+        link.mPrevSibling = parent.mLastChild;
+
+        if ( parent.mLastChild != NO_INDEX )
+            mLinks[parent.mLastChild].mNextSibling = slot;
+        else
+            parent.mFirstChild = slot;
+
+        parent.mLastChild = slot;
+        mDirty = true;
+
+        return true;
+    }
+
+    void HierarchyStore::Detach( const ecs_Handle pEntity ) noexcept
+    {
+        if ( Contains(pEntity) )
+            Unlink( pEntity.getIndex() );
+    }
+
+    void HierarchyStore::Remove( const ecs_Handle pEntity ) noexcept
+    {
+        if ( !Contains(pEntity) )
+            return;
+
+        const ecs_uint32_t slot = pEntity.getIndex();
+        Unlink( slot );
+
+        Link& link = mLinks[slot];
+        ecs_uint32_t child = link.mFirstChild;
+
+        while ( child != NO_INDEX )
+        {
+            Link& childLink = mLinks[child];
+            const ecs_uint32_t next = childLink.mNextSibling;
+
+            childLink.mParent = NO_INDEX;
+            childLink.mPrevSibling = NO_INDEX;
+            childLink.mNextSibling = NO_INDEX;
+            child = next;
+        }
+
+        link = Link{ ecs_Handle(), NO_INDEX, NO_INDEX, NO_INDEX, NO_INDEX, NO_INDEX, NO_INDEX };
+        mCount--;
+        mDirty = true;
+    }
+
+    void HierarchyStore::Update()
+    {
+        if ( !mDirty )
+            return;
+
+        mEntities.clear();
+        mParents.clear();
+        mDepths.clear();
+        mFirstChildren.clear();
+        mChildrenCounts.clear();
+
+        mEntities.reserve( mCount );
+        mParents.reserve( mCount );
+        mDepths.reserve( mCount );
+        mFirstChildren.reserve( mCount );
+        mChildrenCounts.reserve( mCount );
+
+        const ecs_uint32_t slotsCount = static_cast<ecs_uint32_t>( mLinks.size() );
+
+        // Roots, in slots order.
+        for ( ecs_uint32_t slot = 0; slot < slotsCount; slot++ )
+        {
+            Link& link = mLinks[slot];
+
+            if ( !link.mEntity.isValid() || link.mParent != NO_INDEX )
+                continue;
+
+            link.mNode = static_cast<ecs_uint32_t>( mEntities.size() );
+            mEntities.push_back( link.mEntity );
+            mParents.push_back( NO_INDEX );
+            mDepths.push_back( 0 );
+        }
+
+        // Breadth-first: children of each node are appended after all previous nodes children.
+        for ( ecs_uint32_t node = 0; node < mEntities.size(); node++ )
+        {
+            const ecs_uint32_t depth = mDepths[node] + 1;
+            const ecs_uint32_t first = static_cast<ecs_uint32_t>( mEntities.size() );
+
+            for ( ecs_uint32_t child = mLinks[mEntities[node].getIndex()].mFirstChild; child != NO_INDEX; child = mLinks[child].mNextSibling )
+            {
+                Link& link = mLinks[child];
+
+                link.mNode = static_cast<ecs_uint32_t>( mEntities.size() );
+                mEntities.push_back( link.mEntity );
+                mParents.push_back( node );
+                mDepths.push_back( depth );
+            }
+
+            mFirstChildren.push_back( first );
+            mChildrenCounts.push_back( static_cast<ecs_uint32_t>( mEntities.size() ) - first );
+        }
+
+        mDirty = false;
+    }
+
+    void HierarchyStore::Capture( ecs_StorageSnapshot& pDst )
+    {
+        Update();
+
+        const ecs_size_t nodesCount = mEntities.size();
+        pDst.mHierarchy = mEntities;
+        pDst.mHierarchyParents.resize( nodesCount );
+
+        for ( ecs_size_t node = 0; node < nodesCount; node++ )
+            pDst.mHierarchyParents[node] = mParents[node] == NO_INDEX ? ecs_Handle() : mEntities[mParents[node]];
+    }
+
+    void HierarchyStore::Restore( const ecs_StorageSnapshot& pSrc )
+    {
+        Clear();
+
+        // Parents are before children & siblings are in order, so links are rebuilt as captured.
+        const ecs_size_t nodesCount = pSrc.mHierarchy.size();
+
+        for ( ecs_size_t node = 0; node < nodesCount; node++ )
+        {
+            if ( pSrc.mHierarchyParents[node].isValid() )
+                Attach( pSrc.mHierarchy[node], pSrc.mHierarchyParents[node] );
+            else
+                Insert( pSrc.mHierarchy[node] );
+        }
+    }
+
+    void HierarchyStore::Clear() noexcept
+    {
+        mLinks.clear();
+        mEntities.clear();
+        mParents.clear();
+        mDepths.clear();
+        mFirstChildren.clear();
+        mChildrenCounts.clear();
+        mCount = 0;
+        mDirty = false;
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
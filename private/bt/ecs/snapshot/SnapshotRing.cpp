@@ -0,0 +1,158 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_SNAPSHOT_RING_HPP
+#include "../../../../public/bt/ecs/snapshot/SnapshotRing.hpp"
+#endif // !ECS_SNAPSHOT_RING_HPP
+
+// Include C++ utility
+#include <utility>
+
+// ===========================================================
+// ecs::SnapshotRing
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTANTS
+    // ===========================================================
+
+    constexpr const ecs_uint32_t StorageSnapshot::NO_ARCHETYPE;
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    SnapshotRing::SnapshotRing( ecs_ArchetypeStorage& pStorage, const ecs_size_t pCapacity )
+        : mStorage( pStorage ),
+          mSnapshots( pCapacity > 0 ? pCapacity : 1 ),
+          mScratch(),
+          mFirst( 0 ),
+          mCount( 0 )
+    {
+    }
+
+    SnapshotRing::~SnapshotRing() noexcept = default;
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    ecs_size_t SnapshotRing::getIndexOf( const ecs_uint64_t pFrame ) const noexcept
+    {
+        const ecs_size_t capacity = mSnapshots.size();
+
+        for ( ecs_size_t i = 0; i < mCount; i++ )
+        {
+            const ecs_size_t index = ( mFirst + i ) % capacity;
+
+            if ( mSnapshots[index].mFrame == pFrame )
+                return index;
+        }
+
+        return capacity;
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    bool SnapshotRing::Capture( const ecs_uint64_t pFrame )
+    {
+        const ecs_size_t capacity = mSnapshots.size();
+        const ecs_StorageSnapshot* const prev = mCount > 0 ? &mSnapshots[( mFirst + mCount - 1 ) % capacity] : nullptr;
+
+        // Previous snapshot may be overwritten (capacity 1), so it stays valid until captured.
+        if ( !mStorage.Capture(mScratch, prev) )
+            return false;
+
+        mScratch.mFrame = pFrame;
+
+        ecs_size_t index;
+
+        if ( mCount < capacity )
+        {
+            index = ( mFirst + mCount ) % capacity;
+            mCount++;
+        }
+        else
+        {
+            index = mFirst;
+            mFirst = ( mFirst + 1 ) % capacity;
+        }
+
+        std::swap( mSnapshots[index], mScratch );
+
+        return true;
+    }
+
+    bool SnapshotRing::Restore( const ecs_uint64_t pFrame )
+    {
+        const ecs_size_t index = getIndexOf( pFrame );
+
+        if ( index >= mSnapshots.size() )
+            return false;
+
+        mStorage.Restore( mSnapshots[index] );
+
+        // Newer snapshots belong to discarded timeline.
+        mCount = ( index + mSnapshots.size() - mFirst ) % mSnapshots.size() + 1;
+
+        return true;
+    }
+
+    void SnapshotRing::Clear() noexcept
+    {
+        for ( ecs_StorageSnapshot& snapshot : mSnapshots )
+            snapshot.mChunks.clear();
+
+        mScratch.mChunks.clear();
+        mFirst = 0;
+        mCount = 0;
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
@@ -93,6 +93,9 @@ namespace ecs
     System::System(const ecs_TypeID pType )
         : mStateMutex(),
         mCurrentState(SYSTEM_STATE_NOT_STARTED),
+        mReads(),
+        mWrites(),
+        mExclusive( true ),
         mTypeID( pType ),
         mID( ecs_Systems::generateSystemID(pType) )
     {
@@ -136,6 +139,21 @@ namespace ecs
     bool System::isStarted() const noexcept
     { return mCurrentState > SYSTEM_STATE_NOT_STARTED && mCurrentState < SYSTEM_STATE_STOPPED; }
 
+    const ecs_Signature& System::getReads() const noexcept
+    { return mReads; }
+
+    const ecs_Signature& System::getWrites() const noexcept
+    { return mWrites; }
+
+    bool System::isExclusive() const noexcept
+    { return mExclusive; }
+
+    void System::setExclusive( const bool pExclusive ) noexcept
+    {
+        mExclusive = pExclusive;
+        ecs_Systems::invalidateSchedule();
+    }
+
     // ===========================================================
     // METHODS
     // ===========================================================
@@ -190,6 +208,24 @@ namespace ecs
         ecs_Events::UnsubscribeBatch( pEvents, listener );
     }
 
+    void System::Reads( const ecs_TypeID pType ) noexcept
+    {
+        mReads.Set( pType );
+        mExclusive = false;
+        ecs_Systems::invalidateSchedule();
+    }
+
+    void System::Writes( const ecs_TypeID pType ) noexcept
+    {
+        mWrites.Set( pType );
+        mExclusive = false;
+        ecs_Systems::invalidateSchedule();
+    }
+
+    void System::onUpdate( const ecs_real_t )
+    {
+    }
+
     bool System::onStart()
     {
         return true;
@@ -253,6 +289,12 @@ namespace ecs
         setState(SYSTEM_STATE_STOPPED);
     }
 
+    void System::Update( const ecs_real_t pElapsed )
+    {
+        if ( mCurrentState == SYSTEM_STATE_STARTED )
+            onUpdate( pElapsed );
+    }
+
     // ===========================================================
     // ecs::IEventListener
     // ===========================================================
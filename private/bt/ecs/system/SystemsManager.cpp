@@ -46,6 +46,24 @@
 #include "../../../../public/bt/ecs/system/ISystem.hxx"
 #endif // !ECS_I_SYSTEM_HXX
 
+// Include ecs::ComponentsManager
+#ifndef ECS_COMPONENTS_MANAGER_HPP
+#include "../../../../public/bt/ecs/component/ComponentsManager.hpp"
+#endif // !ECS_COMPONENTS_MANAGER_HPP
+
+// Include ecs::SystemsScheduler
+#ifndef ECS_SYSTEMS_SCHEDULER_HPP
+#include "../../../../public/bt/ecs/system/SystemsScheduler.hpp"
+#endif // !ECS_SYSTEMS_SCHEDULER_HPP
+
+// Include ecs::World
+#ifndef ECS_WORLD_HPP
+#include "../../../../public/bt/ecs/world/World.hpp"
+#endif // !ECS_WORLD_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
 // ===========================================================
 // ecs::SystemsManager
 // ===========================================================
@@ -65,11 +83,14 @@ namespace ecs
     // CONSTRUCTOR & DESTRUCTOR
     // ===========================================================
 
-    SystemsManager::SystemsManager()
+    SystemsManager::SystemsManager( const ecs_size_t pWorkers )
         : mIDStorage(),
         mSystems(),
+        mOrder(),
         mSystemsMutex(),
-        mIDMutex()
+        mIDMutex(),
+        mScheduler( ecs_Shared<ecs_SystemsScheduler>( pWorkers ) ),
+        mScheduleDirty( true )
     {
     }
 
@@ -80,7 +101,10 @@ namespace ecs
     // ===========================================================
 
     ECS_API ecs_sptr<SystemsManager> SystemsManager::getInstance()
-    { return mInstance; }
+    {
+        ecs_World* const world = ecs_World::getCurrent();
+        return world != nullptr ? world->getSystems() : mInstance;
+    }
 
     ECS_API SystemsManager::system_ptr SystemsManager::getSystem( const ecs_TypeID pType )
     {
@@ -131,7 +155,14 @@ namespace ecs
         if ( instance != nullptr )
         {
             ecs_SpinLock lock(&instance->mSystemsMutex);
-            instance->mSystems[pSystem->getTypeID()] = pSystem;
+            system_ptr& system = instance->mSystems[pSystem->getTypeID()];
+
+            // Replaced System keeps its place in schedule.
+            if ( system == nullptr )
+                instance->mOrder.push_back( pSystem->getTypeID() );
+
+            system = pSystem;
+            instance->mScheduleDirty = true;
         }
     }
 
@@ -143,13 +174,61 @@ namespace ecs
         {
             ecs_SpinLock lock( &instance->mSystemsMutex );
             instance->mSystems.erase( pType );
+
+            const auto position = std::find( instance->mOrder.begin(), instance->mOrder.end(), pType );
+
+            if ( position != instance->mOrder.end() )
+                instance->mOrder.erase( position );
+
+            instance->mScheduleDirty = true;
+        }
+    }
+
+    ECS_API void SystemsManager::invalidateSchedule() ECS_NOEXCEPT
+    {
+        auto instance = getInstance();
+
+        if ( instance != nullptr )
+        {
+            ecs_SpinLock lock( &instance->mSystemsMutex );
+            instance->mScheduleDirty = true;
         }
     }
 
-    ECS_API void SystemsManager::Initialize()
+    ECS_API void SystemsManager::Update( const ecs_real_t pElapsed )
+    {
+        auto instance = getInstance();
+
+        if ( instance == nullptr )
+            return;
+
+        {
+            ecs_SpinLock lock( &instance->mSystemsMutex );
+
+            if ( instance->mScheduleDirty )
+            {
+                ecs_vec<system_ptr> systems;
+                systems.reserve( instance->mOrder.size() );
+
+                // Registration order, not Type-ID order: scheduler keeps it for Systems with conflicting access.
+                for( const ecs_TypeID type : instance->mOrder )
+                    systems.push_back( instance->mSystems[type] );
+
+                instance->mScheduler->Build( systems );
+                instance->mScheduleDirty = false;
+            }
+        }
+
+        instance->mScheduler->Run( pElapsed );
+
+        // Sync point: structural changes, recorded by Systems.
+        ecs_Components::ApplyCommands();
+    }
+
+    ECS_API void SystemsManager::Initialize( const ecs_size_t pWorkers )
     {
         if ( mInstance == nullptr )
-            mInstance = ecs_Shared<SystemsManager>();
+            mInstance = ecs_Shared<SystemsManager>( pWorkers );
     }
 
     ECS_API void SystemsManager::Terminate()
@@ -0,0 +1,311 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_SYSTEMS_SCHEDULER_HPP
+#include "../../../../public/bt/ecs/system/SystemsScheduler.hpp"
+#endif // !ECS_SYSTEMS_SCHEDULER_HPP
+
+// Include ecs::World
+#ifndef ECS_WORLD_HPP
+#include "../../../../public/bt/ecs/world/World.hpp"
+#endif // !ECS_WORLD_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// ===========================================================
+// ecs::SystemsScheduler
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // CONSTANTS
+    // ===========================================================
+
+    constexpr const ecs_size_t SystemsScheduler::CURSOR_LEVEL_SHIFT;
+    constexpr const std::uint64_t SystemsScheduler::CURSOR_JOB_MASK;
+
+    // ===========================================================
+    // CONSTRUCTOR & DESTRUCTOR
+    // ===========================================================
+
+    SystemsScheduler::SystemsScheduler( const ecs_size_t pWorkers )
+        : mSystems(),
+        mLevels(),
+        mWorkers(),
+        mMutex(),
+        mWorkCondition(),
+        mDoneCondition(),
+        mDispatch( 0 ),
+        mPending( 0 ),
+        mStop( false ),
+        mCursor( 0 ),
+        mDone( 0 ),
+        mElapsed( 0 ),
+        mError( nullptr ),
+        mErrorMutex(),
+        mWorld( nullptr )
+    {
+        ecs_size_t workersCount( pWorkers );
+        if ( workersCount == ECS_SCHEDULER_AUTO_WORKERS )
+        {
+            const unsigned int hardwareThreads( std::thread::hardware_concurrency() );
+            workersCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+        }
+        else if ( workersCount == ECS_SCHEDULER_NO_WORKERS )
+        {
+            workersCount = 0;
+        }
+
+        mWorkers.reserve( workersCount );
+        for( ecs_size_t i = 0; i < workersCount; i++ )
+            mWorkers.emplace_back( &SystemsScheduler::workerLoop, this );
+    }
+
+    SystemsScheduler::~SystemsScheduler() noexcept
+    {
+        {
+            ecs_UniqueLock lock( mMutex );
+            mStop = true;
+        }
+        mWorkCondition.notify_all();
+
+        for( ecs_thread& worker : mWorkers )
+        {
+            if ( worker.joinable() )
+                worker.join();
+        }
+    }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    bool SystemsScheduler::isConflict( const ecs_ISystem& pA, const ecs_ISystem& pB ) noexcept
+    {
+        if ( pA.isExclusive() || pB.isExclusive() )
+            return true;
+
+        const ecs_Signature& writesA( pA.getWrites() );
+        const ecs_Signature& writesB( pB.getWrites() );
+
+        return writesA.Intersects( writesB ) || writesA.Intersects( pB.getReads() ) || writesB.Intersects( pA.getReads() );
+    }
+
+    void SystemsScheduler::workerLoop() noexcept
+    {
+        std::uint64_t dispatch( 0 );
+        ecs_World* world( nullptr );
+
+        while( true )
+        {
+            {
+                ecs_UniqueLock lock( mMutex );
+                mWorkCondition.wait( lock, [this, dispatch]() { return mStop || mDispatch != dispatch; } );
+
+                if ( mStop )
+                    return;
+
+                dispatch = mDispatch;
+                world = mWorld;
+            }
+
+            {
+                // Systems use managers of World that runs Scheduler.
+                ecs_WorldScope scope( world );
+                runJobs();
+            }
+
+            // Acknowledge dispatch, levels data is not used until next one.
+            {
+                ecs_UniqueLock lock( mMutex );
+                --mPending;
+            }
+            mDoneCondition.notify_all();
+        }
+    }
+
+    void SystemsScheduler::runJobs() noexcept
+    {
+        std::uint64_t cursor( mCursor.load( std::memory_order_acquire ) );
+
+        while( true )
+        {
+            const ecs_uint32_t levelIndex( static_cast<ecs_uint32_t>( cursor >> CURSOR_LEVEL_SHIFT ) );
+            const ecs_uint32_t job( static_cast<ecs_uint32_t>( cursor & CURSOR_JOB_MASK ) );
+
+            if ( levelIndex >= mLevels.size() )
+                return;
+
+            const Level& level( mLevels[levelIndex] );
+            if ( job >= level.mCount )
+                return;
+
+            // Claim job. On failure cursor reloaded by CAS.
+            if ( !mCursor.compare_exchange_weak( cursor, cursor + 1, std::memory_order_acq_rel, std::memory_order_acquire ) )
+                continue;
+
+            try
+            {
+                mSystems[level.mFirst + job]->Update( mElapsed );
+            }
+            catch( ... )
+            {
+                ecs_UniqueLock lock( mErrorMutex );
+                if ( mError == nullptr )
+                    mError = std::current_exception();
+            }
+
+            if ( mDone.fetch_add( 1, std::memory_order_acq_rel ) + 1 == level.mCount )
+            {
+                ecs_UniqueLock lock( mMutex );
+                mDoneCondition.notify_all();
+            }
+
+            cursor = mCursor.load( std::memory_order_acquire );
+        }
+    }
+
+    void SystemsScheduler::runLevel( const ecs_uint32_t pLevel ) noexcept
+    {
+        const Level& level( mLevels[pLevel] );
+
+        mDone.store( 0, std::memory_order_relaxed );
+        mCursor.store( static_cast<std::uint64_t>( pLevel ) << CURSOR_LEVEL_SHIFT, std::memory_order_release );
+
+        {
+            ecs_UniqueLock lock( mMutex );
+            ++mDispatch;
+            mPending = static_cast<ecs_uint32_t>( mWorkers.size() );
+        }
+        mWorkCondition.notify_all();
+
+        runJobs();
+
+        // Each worker acknowledges each dispatch, so none can read levels data after Run.
+        ecs_UniqueLock lock( mMutex );
+        mDoneCondition.wait( lock, [this, &level]() { return mDone.load( std::memory_order_acquire ) >= level.mCount && mPending == 0; } );
+    }
+
+    void SystemsScheduler::Build( const ecs_vec<system_ptr>& pSystems )
+    {
+        const ecs_size_t systemsCount( pSystems.size() );
+
+        // Level of System is 1 + max level of previous conflicting Systems.
+        ecs_vec<ecs_uint32_t> levels( systemsCount, 0 );
+        ecs_uint32_t levelsCount( 0 );
+        for( ecs_size_t i = 0; i < systemsCount; i++ )
+        {
+            ecs_uint32_t level( 0 );
+            for( ecs_size_t j = 0; j < i; j++ )
+            {
+                if ( levels[j] >= level && isConflict( *pSystems[i], *pSystems[j] ) )
+                    level = levels[j] + 1;
+            }
+
+            levels[i] = level;
+            levelsCount = std::max( levelsCount, level + 1 );
+        }
+
+        mSystems.clear();
+        mSystems.reserve( systemsCount );
+        mLevels.clear();
+        mLevels.reserve( levelsCount );
+
+        for( ecs_uint32_t level = 0; level < levelsCount; level++ )
+        {
+            const ecs_uint32_t first( static_cast<ecs_uint32_t>( mSystems.size() ) );
+
+            for( ecs_size_t i = 0; i < systemsCount; i++ )
+            {
+                if ( levels[i] == level )
+                    mSystems.push_back( pSystems[i] );
+            }
+
+            mLevels.push_back( Level{ first, static_cast<ecs_uint32_t>( mSystems.size() ) - first } );
+        }
+    }
+
+    void SystemsScheduler::Run( const ecs_real_t pElapsed )
+    {
+        mElapsed = pElapsed;
+        mError = nullptr;
+
+        {
+            ecs_UniqueLock lock( mMutex );
+            mWorld = ecs_World::getCurrent();
+        }
+
+        const ecs_uint32_t levelsCount( static_cast<ecs_uint32_t>( mLevels.size() ) );
+        for( ecs_uint32_t levelIndex = 0; levelIndex < levelsCount && mError == nullptr; levelIndex++ )
+        {
+            const Level& level( mLevels[levelIndex] );
+
+            // Single System or no workers: no need to wake-up workers.
+            if ( level.mCount == 1 || mWorkers.empty() )
+            {
+                try
+                {
+                    for( ecs_uint32_t i = 0; i < level.mCount; i++ )
+                        mSystems[level.mFirst + i]->Update( pElapsed );
+                }
+                catch( ... )
+                {
+                    mError = std::current_exception();
+                }
+            }
+            else
+            {
+                runLevel( levelIndex );
+            }
+        }
+
+        if ( mError != nullptr )
+            std::rethrow_exception( mError );
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+// -----------------------------------------------------------
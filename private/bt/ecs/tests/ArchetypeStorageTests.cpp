@@ -0,0 +1,223 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../../../../public/bt/ecs/archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include C++ stdexcept
+#include <stdexcept>
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        /** Live objects count of not trivial Component. **/
+        static ecs_int32_t gAlive = 0;
+
+        /** Not trivial Component, constructor throws for negative value. **/
+        struct Health final
+        {
+            ecs_int32_t mValue;
+
+            explicit Health( const ecs_int32_t pValue )
+                : mValue( pValue )
+            {
+                if ( pValue < 0 )
+                    throw std::invalid_argument( "Health - negative value." );
+
+                gAlive++;
+            }
+
+            Health( const Health& pOther ) noexcept
+                : mValue( pOther.mValue )
+            { gAlive++; }
+
+            ~Health()
+            { gAlive--; }
+        };
+
+        /** Trivial Component. **/
+        struct Mass final
+        {
+            float mValue;
+        };
+
+        /** Counts OnAdd / OnSet events. **/
+        static void CountEvents( ecs_ArchetypeStorage&, const ecs_Handle* const, const ecs_size_t pCount, void* const pUser )
+        { *static_cast<ecs_size_t*>( pUser ) += pCount; }
+
+        /**
+         * @brief
+         * Attaches Component with throwing constructor.
+         *
+         * @return - 'true' if constructor has thrown.
+        **/
+        static bool AddThrowing( ecs_ArchetypeStorage& pStorage, const ecs_Handle pEntity )
+        {
+            try
+            {
+                pStorage.addComponent<Health>( pEntity, -1 );
+            }
+            catch( const std::invalid_argument& )
+            {
+                return true;
+            }
+
+            return false;
+        }
+
+        void TestArchetypeStorage()
+        {
+            {
+                ecs_ArchetypeStorage storage;
+                ecs_size_t added = 0;
+                ecs_size_t changed = 0;
+
+                storage.getObservers().Subscribe<Health>( EObserverEvents::OnAdd, &CountEvents, &added );
+                storage.getObservers().Subscribe<Health>( EObserverEvents::OnSet, &CountEvents, &changed );
+
+                const ecs_Handle entity = storage.Create();
+                storage.addComponent<Mass>( entity, Mass{ 2.0f } );
+
+                // Throwing constructor: Entity keeps its Archetype, nothing is recorded.
+                ECS_TEST_CHECK( AddThrowing(storage, entity) );
+                storage.NotifyObservers();
+                ECS_TEST_CHECK( !storage.hasComponent<Health>(entity) && storage.getComponent<Mass>(entity)->mValue == 2.0f );
+                ECS_TEST_CHECK( added == 0 && gAlive == 0 );
+
+                ECS_TEST_CHECK( storage.addComponent<Health>(entity, 10)->mValue == 10 );
+                storage.NotifyObservers();
+                ECS_TEST_CHECK( added == 1 && gAlive == 1 );
+
+                // Attached value survives throwing replacement.
+                ECS_TEST_CHECK( AddThrowing(storage, entity) );
+                storage.NotifyObservers();
+                ECS_TEST_CHECK( storage.getComponent<Health>(entity)->mValue == 10 && changed == 0 && gAlive == 1 );
+
+                ECS_TEST_CHECK( storage.addComponent<Health>(entity, 20)->mValue == 20 );
+                storage.NotifyObservers();
+                ECS_TEST_CHECK( changed == 1 && gAlive == 1 );
+
+                // Stale Handle: value is destroyed.
+                const ecs_Handle other = storage.Create();
+                storage.addComponent<Health>( other, 30 );
+                ECS_TEST_CHECK( storage.Destroy(other) && gAlive == 1 );
+                ECS_TEST_CHECK( storage.addComponent<Health>(other, 40) == nullptr && gAlive == 1 );
+
+                ECS_TEST_CHECK( storage.removeComponent<Health>(entity) && gAlive == 0 );
+                ECS_TEST_CHECK( storage.getComponent<Mass>(entity)->mValue == 2.0f );
+
+                storage.addComponent<Health>( entity, 50 );
+            }
+
+            // Storage destroys attached Components.
+            ECS_TEST_CHECK( gAlive == 0 );
+        }
+
+        void TestDestroyBatch()
+        {
+            const ecs_size_t count = 3000;
+            ecs_ArchetypeStorage storage;
+            ecs_vec<ecs_Handle> entities;
+
+            for ( ecs_size_t i = 0; i < count; i++ )
+            {
+                entities.push_back( storage.Create() );
+                storage.addComponent<Position>( entities.back(), Position{ static_cast<ecs_int32_t>(i) } );
+            }
+
+            // Every third Entity & last rows, first to last, with duplicates & stale Handle.
+            ecs_vec<ecs_Handle> destroyed;
+
+            for ( ecs_size_t i = 0; i < count; i += 3 )
+                destroyed.push_back( entities[i] );
+
+            for ( ecs_size_t i = count - 10; i < count; i++ )
+                destroyed.push_back( entities[i] );
+
+            destroyed.push_back( entities[0] );
+
+            const ecs_Handle stale = storage.Create();
+            storage.Destroy( stale );
+            destroyed.push_back( stale );
+
+            ecs_size_t expected = 0;
+
+            for ( ecs_size_t i = 0; i < count; i++ )
+            {
+                if ( i % 3 == 0 || i >= count - 10 )
+                    expected++;
+            }
+
+            ECS_TEST_CHECK( storage.destroyBatch(destroyed.data(), destroyed.size()) == expected );
+            ECS_TEST_CHECK( storage.Count() == count - expected );
+
+            for ( ecs_size_t i = 0; i < count; i++ )
+            {
+                const bool removed = i % 3 == 0 || i >= count - 10;
+                const Position* const position = storage.getComponent<Position>( entities[i] );
+
+                ECS_TEST_CHECK( storage.isAlive(entities[i]) != removed );
+
+                if ( !removed )
+                    ECS_TEST_CHECK( position != nullptr && position->mValue == static_cast<ecs_int32_t>(i) );
+            }
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
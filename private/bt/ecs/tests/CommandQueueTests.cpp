@@ -0,0 +1,161 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::CommandQueue
+#ifndef ECS_COMMAND_QUEUE_HPP
+#include "../../../../public/bt/ecs/command/CommandQueue.hpp"
+#endif // !ECS_COMMAND_QUEUE_HPP
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../../../../public/bt/ecs/archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include ecs::thread
+#ifndef ECS_THREAD_HPP
+#include "../../../../public/bt/ecs/types/ecs_thread.hpp"
+#endif // !ECS_THREAD_HPP
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        /** Live CommandName objects count. **/
+        static ecs_int32_t gCommandNames = 0;
+
+        /** Not trivial Component. **/
+        struct CommandName final
+        {
+            ecs_int32_t mValue;
+
+            CommandName() noexcept
+                : mValue( 0 )
+            { gCommandNames++; }
+
+            CommandName( const CommandName& pOther ) noexcept
+                : mValue( pOther.mValue )
+            { gCommandNames++; }
+
+            ~CommandName()
+            { gCommandNames--; }
+        };
+
+        void TestCommandQueue()
+        {
+            const ecs_size_t count = 100;
+            ecs_ArchetypeStorage storage;
+            ecs_CommandQueue queue( storage );
+            ecs_vec<ecs_Handle> entities;
+
+            for ( ecs_size_t i = 0; i < count; i++ )
+            {
+                entities.push_back( storage.Create() );
+                storage.addComponent<Position>( entities.back(), Position{ 0 } );
+            }
+
+            ecs_CommandBuffer& buffer = queue.getLocal();
+
+            // Recorded last to first, sorted by location when applied.
+            for ( ecs_size_t i = count; i > 0; i-- )
+            {
+                const ecs_Handle entity = entities[i - 1];
+
+                buffer.addComponent<Position>( entity, Position{ 1 } );
+                buffer.addComponent<Velocity>( entity, Velocity{ 1 } );
+                buffer.removeComponent<Velocity>( entity );
+                buffer.addComponent<Position>( entity, Position{ static_cast<ecs_int32_t>(i - 1) } );
+            }
+
+            // Reserved Handle is usable by following commands.
+            const ecs_Handle created = buffer.Create();
+            buffer.addComponent<Velocity>( created, Velocity{ 5 } );
+
+            // Commands after destruction are ignored.
+            buffer.Destroy( entities[0] );
+            buffer.addComponent<Velocity>( entities[0], Velocity{ 1 } );
+
+            // Other thread records into own buffer.
+            ecs_thread other( [&queue, &entities]()
+            { queue.getLocal().removeComponent<Position>( entities[1] ); } );
+            other.join();
+
+            queue.Apply();
+
+            ECS_TEST_CHECK( buffer.isEmpty() );
+            ECS_TEST_CHECK( !storage.isAlive(entities[0]) );
+            ECS_TEST_CHECK( !storage.hasComponent<Position>(entities[1]) );
+
+            for ( ecs_size_t i = 2; i < count; i++ )
+            {
+                const Position* const position = storage.getComponent<Position>( entities[i] );
+
+                ECS_TEST_CHECK( position != nullptr && position->mValue == static_cast<ecs_int32_t>(i) );
+                ECS_TEST_CHECK( !storage.hasComponent<Velocity>(entities[i]) );
+            }
+
+            // Not attached payload is destroyed.
+            buffer.addComponent<CommandName>( entities[0] );
+            buffer.addComponent<CommandName>( created );
+            queue.Apply();
+
+            ECS_TEST_CHECK( gCommandNames == 1 && storage.hasComponent<CommandName>(created) );
+
+            ECS_TEST_CHECK( storage.isAlive(created) );
+            ECS_TEST_CHECK( storage.hasComponent<Velocity>(created) && storage.getComponent<Velocity>(created)->mValue == 5 );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,188 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../../../../public/bt/ecs/archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include C++ algorithm
+#include <algorithm>
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Observer call.
+        **/
+        struct ObserverCall final
+        {
+            /** Event. **/
+            ecs_EObserverEvents mEvent;
+
+            /** Handles count. **/
+            ecs_size_t mCount;
+        };
+
+        /**
+         * @brief
+         * Observer user data, one per event.
+        **/
+        struct ObserverLog final
+        {
+            /** Observed event. **/
+            ecs_EObserverEvents mEvent;
+
+            /** Calls, shared by events. **/
+            ecs_vec<ObserverCall>* mCalls;
+
+            /** Handles, shared by events. **/
+            ecs_vec<ecs_Handle>* mHandles;
+        };
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Observer, appends call & Handles to log.
+        **/
+        static void LogObserver( ecs_ArchetypeStorage&, const ecs_Handle* const pEntities, const ecs_size_t pCount, void* const pUser )
+        {
+            ObserverLog* const log = static_cast<ObserverLog*>( pUser );
+
+            log->mCalls->push_back( ObserverCall{ log->mEvent, pCount } );
+            log->mHandles->insert( log->mHandles->end(), pEntities, pEntities + pCount );
+        }
+
+        void TestComponentObservers()
+        {
+            ecs_ArchetypeStorage storage;
+            ecs_ComponentObservers& observers = storage.getObservers();
+            ecs_vec<ObserverCall> calls;
+            ecs_vec<ecs_Handle> handles;
+            ObserverLog logs[ecs_ComponentObservers::EVENTS] = {
+                { ecs_EObserverEvents::OnAdd, &calls, &handles },
+                { ecs_EObserverEvents::OnRemove, &calls, &handles },
+                { ecs_EObserverEvents::OnSet, &calls, &handles } };
+
+            for ( ObserverLog& log : logs )
+                observers.Subscribe<Position>( log.mEvent, LogObserver, &log );
+
+            ECS_TEST_CHECK( observers.isObserved(ecs_EObserverEvents::OnAdd, ecs_ComponentType<Position>::getID()) );
+            ECS_TEST_CHECK( !observers.isObserved(ecs_EObserverEvents::OnAdd, ecs_ComponentType<Velocity>::getID()) );
+
+            // Events are recorded, not dispatched, until Notify.
+            ecs_Handle entities[4];
+
+            for ( ecs_size_t i = 0; i < 4; i++ )
+            {
+                entities[i] = storage.Create();
+                storage.addComponent<Position>( entities[i], Position{ static_cast<ecs_int32_t>(i) } );
+            }
+
+            storage.addComponent<Velocity>( entities[0], Velocity{ 1 } );
+            storage.MarkChanged<Position>( entities[1] );
+            storage.MarkChanged<Position>( entities[2] );
+            storage.addComponent<Position>( entities[0], Position{ 10 } );
+            storage.removeComponent<Position>( entities[3] );
+
+            ECS_TEST_CHECK( observers.hasPending() && calls.empty() );
+
+            // One call per run of same event, Handles in order of recording.
+            storage.NotifyObservers();
+
+            const ecs_Handle expected[] = { entities[0], entities[1], entities[2], entities[3],
+                entities[1], entities[2], entities[0], entities[3] };
+
+            ECS_TEST_CHECK( !observers.hasPending() );
+            ECS_TEST_CHECK( calls.size() == 3 && handles.size() == 8 );
+            ECS_TEST_CHECK( calls[0].mEvent == ecs_EObserverEvents::OnAdd && calls[0].mCount == 4 );
+            ECS_TEST_CHECK( calls[1].mEvent == ecs_EObserverEvents::OnSet && calls[1].mCount == 3 );
+            ECS_TEST_CHECK( calls[2].mEvent == ecs_EObserverEvents::OnRemove && calls[2].mCount == 1 );
+            ECS_TEST_CHECK( std::equal(handles.begin(), handles.end(), expected) );
+
+            storage.NotifyObservers();
+            ECS_TEST_CHECK( calls.size() == 3 );
+
+            // Batch spawn notifies on return, with one call.
+            ecs_Signature signature;
+            signature.Set( ecs_ComponentType<Position>::getID() );
+
+            ecs_vec<ecs_Handle> spawned( 100 );
+            calls.clear();
+            handles.clear();
+
+            ECS_TEST_CHECK( storage.spawnBatch(signature, spawned.size(), spawned.data()) );
+            ECS_TEST_CHECK( calls.size() == 1 && calls[0].mEvent == ecs_EObserverEvents::OnAdd && calls[0].mCount == 100 );
+            ECS_TEST_CHECK( handles == spawned );
+
+            // Unsubscribed events are not recorded.
+            observers.Unsubscribe( ecs_EObserverEvents::OnAdd, ecs_ComponentType<Position>::getID(), LogObserver, &logs[0] );
+            storage.addComponent<Position>( storage.Create(), Position{ 0 } );
+
+            ECS_TEST_CHECK( !observers.hasPending() );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,126 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::World
+#ifndef ECS_WORLD_HPP
+#include "../../../../public/bt/ecs/world/World.hpp"
+#endif // !ECS_WORLD_HPP
+
+// Include ecs::ComponentsManager
+#ifndef ECS_COMPONENTS_MANAGER_HPP
+#include "../../../../public/bt/ecs/component/ComponentsManager.hpp"
+#endif // !ECS_COMPONENTS_MANAGER_HPP
+
+// Include C++ stdexcept
+#include <stdexcept>
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        /** Pooled Component. **/
+        struct PoolValue final
+        {
+            ecs_int32_t mValue;
+        };
+
+        /** Pooled Component, same size as PoolValue. **/
+        struct OtherPoolValue final
+        {
+            float mValue;
+        };
+
+        void TestComponentPool()
+        {
+            ecs_ComponentPool<PoolValue> pool( 1 );
+            ecs_Handle handles[4];
+
+            for ( ecs_int32_t i = 0; i < 4; i++ )
+                handles[i] = pool.Create( PoolValue{ i } );
+
+            // Last Component is moved into removed one, Handles stay valid.
+            ECS_TEST_CHECK( pool.Remove(handles[1]) );
+            ECS_TEST_CHECK( !pool.Remove(handles[1]) );
+            ECS_TEST_CHECK( pool.Count() == 3 && pool.Get(handles[1]) == nullptr );
+            ECS_TEST_CHECK( pool.Get(handles[3])->mValue == 3 && pool.Get(handles[0])->mValue == 0 );
+
+            // Reused slot gets new generation.
+            const ecs_Handle reused = pool.Create( PoolValue{ 10 } );
+            ECS_TEST_CHECK( reused.getIndex() == handles[1].getIndex() && !pool.isAlive(handles[1]) );
+            ECS_TEST_CHECK( pool.Get(reused)->mValue == 10 );
+
+            // Pool of Type-ID is bound to its C++ type.
+            ecs_World world;
+            ecs_WorldScope scope( &world );
+
+            const ecs_sptr<ecs_ComponentPool<PoolValue>> shared = ecs_Components::getPool<PoolValue>( ECS_RESERVED_COMPONENT_TYPES - 1 );
+            bool thrown = false;
+
+            try
+            {
+                ecs_Components::getPool<OtherPoolValue>( ECS_RESERVED_COMPONENT_TYPES - 1 );
+            }
+            catch( const std::logic_error& )
+            {
+                thrown = true;
+            }
+
+            ECS_TEST_CHECK( shared != nullptr && thrown );
+            ECS_TEST_CHECK( ecs_Components::getPool<PoolValue>(ECS_RESERVED_COMPONENT_TYPES - 1) == shared );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,141 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::ComponentType
+#ifndef ECS_COMPONENT_TYPE_HPP
+#include "../../../../public/bt/ecs/component/ComponentType.hpp"
+#endif // !ECS_COMPONENT_TYPE_HPP
+
+// Include C++ stdexcept
+#include <stdexcept>
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        /** Component with manual Type-ID. **/
+        struct ManualComponent final
+        {
+            ecs_int32_t mValue;
+        };
+
+        /** Component, which tries to take Type-ID of ManualComponent. **/
+        struct OtherManualComponent final
+        {
+            ecs_int32_t mValue;
+        };
+
+        /** Component with generated Type-ID. **/
+        struct GeneratedComponent final
+        {
+            ecs_int32_t mValue;
+        };
+
+        /**
+         * @brief
+         * Registers manual Type-ID.
+         *
+         * @return - 0 if registered, 1 for std::out_of_range, 2 for std::logic_error.
+        **/
+        template <typename T>
+        static ecs_int32_t RegisterManual( const ecs_TypeID pType )
+        {
+            try
+            {
+                ecs_ComponentType<T>::Register( pType );
+            }
+            catch( const std::out_of_range& )
+            {
+                return 1;
+            }
+            catch( const std::logic_error& )
+            {
+                return 2;
+            }
+
+            return 0;
+        }
+
+        void TestComponentType()
+        {
+            const ecs_TypeID manualType = ECS_RESERVED_COMPONENT_TYPES - 2;
+
+            // Manual Type-IDs can't take generated range.
+            ECS_TEST_CHECK( RegisterManual<ManualComponent>(ECS_RESERVED_COMPONENT_TYPES) == 1 );
+            ECS_TEST_CHECK( RegisterManual<ManualComponent>(manualType) == 0 );
+            ECS_TEST_CHECK( RegisterManual<ManualComponent>(manualType) == 0 );
+            ECS_TEST_CHECK( ecs_ComponentType<ManualComponent>::getID() == manualType );
+            ECS_TEST_CHECK( ecs_ComponentTypeInfo::Get(manualType) == &ecs_ComponentType<ManualComponent>::getInfo() );
+
+            // Type-ID is bound to one type, type is bound to one Type-ID.
+            ECS_TEST_CHECK( RegisterManual<OtherManualComponent>(manualType) == 2 );
+            ECS_TEST_CHECK( RegisterManual<ManualComponent>(manualType - 1) == 2 );
+            ECS_TEST_CHECK( ecs_ComponentType<ManualComponent>::getID() == manualType );
+
+            // Failed registration changes nothing, generated Type-ID is used.
+            const ecs_TypeID generatedType = ecs_ComponentType<OtherManualComponent>::getID();
+            ECS_TEST_CHECK( generatedType >= ECS_RESERVED_COMPONENT_TYPES && generatedType < ECS_MAX_COMPONENT_TYPES );
+            ECS_TEST_CHECK( ecs_ComponentTypeInfo::Get(generatedType) == &ecs_ComponentType<OtherManualComponent>::getInfo() );
+
+            // Generated Type-ID can't be replaced by manual one.
+            const ecs_TypeID type = ecs_ComponentType<GeneratedComponent>::getID();
+            ECS_TEST_CHECK( RegisterManual<GeneratedComponent>(manualType - 1) == 2 );
+            ECS_TEST_CHECK( ecs_ComponentType<GeneratedComponent>::getID() == type && type != generatedType );
+            ECS_TEST_CHECK( ecs_ComponentTypeInfo::Get(manualType - 1) == nullptr );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
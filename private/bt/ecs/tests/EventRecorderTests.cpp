@@ -0,0 +1,191 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::EventRecorder
+#ifndef ECS_EVENT_RECORDER_HPP
+#include "../../../../public/bt/ecs/event/EventRecorder.hpp"
+#endif // !ECS_EVENT_RECORDER_HPP
+
+// Include ecs::EventsManager
+#ifndef ECS_EVENTS_MANAGER_HPP
+#include "../../../../public/bt/ecs/event/EventsManager.hpp"
+#endif // !ECS_EVENTS_MANAGER_HPP
+
+// Include ecs::IEventListener
+#ifndef ECS_I_EVENT_LISTENER_HXX
+#include "../../../../public/bt/ecs/event/IEventListener.hxx"
+#endif // !ECS_I_EVENT_LISTENER_HXX
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Listener, records IDs of sent Events.
+        **/
+        class ReplayListener final : public ecs_IEventListener
+        {
+
+        public:
+
+            /** IDs in order of sending. **/
+            ecs_vec<ecs_ObjectID> mIDs;
+
+            virtual char OnEvent( ecs_sptr<ecs_IEvent> pEvent, const bool pAsync, const unsigned char pThread ) override
+            {
+                (void)pAsync; (void)pThread;
+
+                mIDs.push_back( pEvent->getID() );
+                return 0;
+            }
+
+            virtual void onEventError( ecs_sptr<ecs_IEvent> pEvent, const std::exception& pException, const bool pAsync, const unsigned char pThread ) override
+            {
+                (void)pEvent; (void)pException; (void)pAsync; (void)pThread;
+            }
+
+        };
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Writes Event ID as payload.
+        **/
+        static void WriteTestEvent( const ecs_IEvent& pEvent, ecs_vec<ecs_uint8_t>& pOutput )
+        { pOutput.push_back( static_cast<ecs_uint8_t>(pEvent.getID()) ); }
+
+        /**
+         * @brief
+         * Creates Event with ID from payload.
+        **/
+        static ecs_sptr<ecs_IEvent> ReadTestEvent( const ecs_uint8_t* const pData, const ecs_size_t pSize )
+        { return pSize == 1 ? ecs_Shared<TestEvent>( EVENT_TYPE, pData[0] ) : ecs_sptr<ecs_IEvent>( nullptr ); }
+
+        void TestEventRecorder()
+        {
+            // Type without codec is recorded without payload & skipped on replay.
+            const ecs_TypeID skipped = 9;
+            const ecs_EventCodec codec = { WriteTestEvent, ReadTestEvent };
+
+            ecs_Events::Initialize();
+
+            const ecs_sptr<ReplayListener> replayed = ecs_Shared<ReplayListener>();
+            ecs_sptr<ecs_IEventListener> listener = replayed;
+            const ecs_sptr<ecs_EventRecorder> recorder = ecs_Shared<ecs_EventRecorder>();
+            ecs_sptr<ecs_IEvent> event;
+
+            ecs_Events::Subscribe( EVENT_TYPE, listener );
+            ecs_Events::Subscribe( skipped, listener );
+            recorder->setCodec( EVENT_TYPE, codec );
+            ecs_Events::setRecorder( recorder );
+
+            // Frame 0: sent & queued Events.
+            event = ecs_Shared<TestEvent>( EVENT_TYPE, 1 );
+            ecs_Events::sendEvent( event );
+            event = ecs_Shared<TestEvent>( EVENT_TYPE, 2 );
+            ecs_Events::queueEvent( event );
+            event = ecs_Shared<TestEvent>( skipped, 10 );
+            ecs_Events::queueEvent( event );
+            ecs_Events::Update( 0 );
+            recorder->NextFrame();
+
+            // Frame 1: Event queued into other thread.
+            event = ecs_Shared<TestEvent>( EVENT_TYPE, 3 );
+            ecs_Events::queueEvent( event, 1 );
+            ecs_Events::Update( 1 );
+
+            ecs_Events::setRecorder( nullptr );
+
+            const ecs_vec<ecs_ObjectID> recorded = { 1, 2, 10, 3 };
+
+            ECS_TEST_CHECK( replayed->mIDs == recorded && recorder->Count() == 4 );
+
+            // Loaded log replays same Events, frame by frame.
+            const ecs_vec<ecs_uint8_t>& data = recorder->getData();
+            ecs_EventRecorder replay;
+
+            replay.setCodec( EVENT_TYPE, codec );
+            replayed->mIDs.clear();
+
+            ECS_TEST_CHECK( !replay.Load(data.data(), 3) );
+            ECS_TEST_CHECK( replay.Load(data.data(), data.size()) && replay.hasRecords() );
+            ECS_TEST_CHECK( replay.Replay() == 2 && !replay.hasRecords() );
+
+            const ecs_vec<ecs_ObjectID> expected = { 1, 2, 3 };
+
+            ECS_TEST_CHECK( replayed->mIDs == expected );
+
+            // Rewind replays again.
+            replayed->mIDs.clear();
+            replay.Rewind();
+
+            ECS_TEST_CHECK( replay.ReplayFrame() && replayed->mIDs.size() == 1 );
+            ecs_Events::Update( 0 );
+            ECS_TEST_CHECK( replayed->mIDs.size() == 2 && replay.hasRecords() );
+
+            ecs_Events::Terminate();
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,290 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::EventsManager
+#ifndef ECS_EVENTS_MANAGER_HPP
+#include "../../../../public/bt/ecs/event/EventsManager.hpp"
+#endif // !ECS_EVENTS_MANAGER_HPP
+
+// Include ecs::IEventListener
+#ifndef ECS_I_EVENT_LISTENER_HXX
+#include "../../../../public/bt/ecs/event/IEventListener.hxx"
+#endif // !ECS_I_EVENT_LISTENER_HXX
+
+// Include C++ algorithm
+#include <algorithm>
+
+// Include C++ thread
+#include <thread>
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Listener, counts calls & subscribes other Listener on first call.
+        **/
+        class CountingListener final : public ecs_IEventListener
+        {
+
+        public:
+
+            /** Calls count. **/
+            ecs_atomic<ecs_size_t> mCalls;
+
+            /** Listener to subscribe on first call, or null. **/
+            ecs_sptr<ecs_IEventListener> mSubscribe;
+
+            CountingListener()
+                : mCalls( 0 ),
+                mSubscribe()
+            {
+            }
+
+            virtual char OnEvent( ecs_sptr<ecs_IEvent> pEvent, const bool pAsync, const unsigned char pThread ) override
+            {
+                (void)pAsync; (void)pThread;
+
+                mCalls.fetch_add( 1, std::memory_order_relaxed );
+
+                if ( mSubscribe != nullptr )
+                {
+                    ecs_Events::Subscribe( pEvent->getTypeID(), mSubscribe );
+                    mSubscribe = nullptr;
+                }
+
+                return 0;
+            }
+
+            virtual void onEventError( ecs_sptr<ecs_IEvent> pEvent, const std::exception& pException, const bool pAsync, const unsigned char pThread ) override
+            {
+                (void)pEvent; (void)pException; (void)pAsync; (void)pThread;
+            }
+
+        };
+
+        /**
+         * @brief
+         * Listener, records Type-IDs of sent Events.
+        **/
+        class OrderListener final : public ecs_IEventListener
+        {
+
+        public:
+
+            /** Type-IDs in order of sending. **/
+            ecs_vec<ecs_TypeID> mTypes;
+
+            virtual char OnEvent( ecs_sptr<ecs_IEvent> pEvent, const bool pAsync, const unsigned char pThread ) override
+            {
+                (void)pAsync; (void)pThread;
+
+                mTypes.push_back( pEvent->getTypeID() );
+                return 0;
+            }
+
+            virtual void onEventError( ecs_sptr<ecs_IEvent> pEvent, const std::exception& pException, const bool pAsync, const unsigned char pThread ) override
+            {
+                (void)pEvent; (void)pException; (void)pAsync; (void)pThread;
+            }
+
+        };
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        void TestEventListeners()
+        {
+            const ecs_TypeID type = 3;
+            const ecs_size_t threads = 4;
+            const ecs_size_t sends = 1000;
+
+            ecs_Events::Initialize();
+
+            const ecs_sptr<CountingListener> first = ecs_Shared<CountingListener>();
+            const ecs_sptr<CountingListener> second = ecs_Shared<CountingListener>();
+            const ecs_sptr<CountingListener> third = ecs_Shared<CountingListener>();
+            ecs_sptr<ecs_IEventListener> firstListener = first;
+            ecs_sptr<ecs_IEventListener> secondListener = second;
+            ecs_sptr<ecs_IEventListener> thirdListener = third;
+            ecs_sptr<ecs_IEvent> event = ecs_Shared<TestEvent>( type, 0 );
+
+            // Listener, subscribed while handling, gets next Event.
+            first->mSubscribe = secondListener;
+            ecs_Events::Subscribe( type, firstListener );
+
+            ecs_Events::sendEvent( event );
+            ECS_TEST_CHECK( first->mCalls == 1 && second->mCalls == 0 );
+
+            ecs_Events::sendEvent( event );
+            ECS_TEST_CHECK( first->mCalls == 2 && second->mCalls == 1 );
+
+            ecs_Events::Unsubscribe( type, firstListener );
+            ecs_Events::sendEvent( event );
+            ECS_TEST_CHECK( first->mCalls == 2 && second->mCalls == 2 );
+
+            // Senders keep using snapshots, while Listeners are replaced & retired.
+            ecs_vec<std::thread> senders;
+
+            for ( ecs_size_t i = 0; i < threads; i++ )
+            {
+                senders.emplace_back( [type, sends]()
+                {
+                    ecs_sptr<ecs_IEvent> sent = ecs_Shared<TestEvent>( type, 0 );
+
+                    for ( ecs_size_t j = 0; j < sends; j++ )
+                        ecs_Events::sendEvent( sent );
+                } );
+            }
+
+            for ( ecs_size_t i = 0; i < sends; i++ )
+            {
+                ecs_Events::Subscribe( type, thirdListener );
+                ecs_Events::Unsubscribe( type, thirdListener );
+            }
+
+            for ( std::thread& sender : senders )
+                sender.join();
+
+            ECS_TEST_CHECK( second->mCalls == 2 + threads * sends );
+            ECS_TEST_CHECK( third->mCalls <= threads * sends );
+
+            // Retired Listeners are freed by Update, when no sender is active.
+            ecs_Events::Update( 0 );
+            ecs_Events::Unsubscribe( type, secondListener );
+            ecs_Events::sendEvent( event );
+            ECS_TEST_CHECK( second->mCalls == 2 + threads * sends );
+
+            ecs_Events::Terminate();
+        }
+
+        void TestEventLanes()
+        {
+            const ecs_TypeID high = 4;
+            const ecs_TypeID low = 5;
+            const ecs_uint8_t lowLane = ECS_EVENT_LANES - 1;
+
+            ecs_Events::Initialize();
+
+            const ecs_sptr<OrderListener> order = ecs_Shared<OrderListener>();
+            ecs_sptr<ecs_IEventListener> listener = order;
+            ecs_sptr<ecs_IEvent> event;
+
+            ecs_Events::Subscribe( high, listener );
+            ecs_Events::Subscribe( low, listener );
+            ecs_Events::setEventPriority( high, 0 );
+            ecs_Events::setEventPriority( low, lowLane );
+
+            ECS_TEST_CHECK( ecs_Events::getEventPriority(high) == 0 && ecs_Events::getEventPriority(low) == lowLane );
+
+            // Higher lane is sent first, regardless of queuing order.
+            event = ecs_Shared<TestEvent>( low, 0 );
+            ecs_Events::queueEvent( event );
+            event = ecs_Shared<TestEvent>( high, 0 );
+            ecs_Events::queueEvent( event );
+
+            ECS_TEST_CHECK( ecs_Events::Update(0) == 0 );
+            ECS_TEST_CHECK( order->mTypes.size() == 2 && order->mTypes[0] == high && order->mTypes[1] == low );
+
+            // Lane budget limits Events, sent from lane per Update.
+            order->mTypes.clear();
+            ecs_Events::setLaneBudget( 0, 0, 2 );
+
+            for ( ecs_size_t i = 0; i < 5; i++ )
+            {
+                event = ecs_Shared<TestEvent>( high, 0 );
+                ecs_Events::queueEvent( event );
+            }
+
+            ECS_TEST_CHECK( ecs_Events::Update(0) == 3 && order->mTypes.size() == 2 );
+            ECS_TEST_CHECK( ecs_Events::Update(0) == 1 && order->mTypes.size() == 4 );
+            ECS_TEST_CHECK( ecs_Events::Update(0) == 0 && order->mTypes.size() == 5 );
+
+            ecs_Events::setLaneBudget( 0, 0, 0 );
+
+            // Lower lane, starved by Updates budget, is sent first after ECS_EVENT_STARVATION_UPDATES.
+            order->mTypes.clear();
+            event = ecs_Shared<TestEvent>( low, 0 );
+            ecs_Events::queueEvent( event );
+
+            for ( ecs_size_t i = 0; i <= ECS_EVENT_STARVATION_UPDATES; i++ )
+            {
+                event = ecs_Shared<TestEvent>( high, 0 );
+                ecs_Events::queueEvent( event );
+                ecs_Events::Update( 0, 1 );
+            }
+
+            ECS_TEST_CHECK( order->mTypes.size() == ECS_EVENT_STARVATION_UPDATES + 1 );
+            ECS_TEST_CHECK( std::count(order->mTypes.begin(), order->mTypes.end() - 1, high) == ECS_EVENT_STARVATION_UPDATES );
+            ECS_TEST_CHECK( order->mTypes.back() == low );
+
+            // Starved lane is not first anymore.
+            ecs_Events::Update( 0, 1 );
+            ECS_TEST_CHECK( order->mTypes.back() == high && ecs_Events::Update(0) == 0 );
+
+            ecs_Events::setEventPriority( high, ECS_EVENT_DEFAULT_LANE );
+            ecs_Events::setEventPriority( low, ECS_EVENT_DEFAULT_LANE );
+            ecs_Events::Terminate();
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
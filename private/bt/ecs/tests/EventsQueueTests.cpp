@@ -0,0 +1,157 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::EventsQueue
+#ifndef ECS_EVENTS_QUEUE_HPP
+#include "../../../../public/bt/ecs/event/EventsQueue.hpp"
+#endif // !ECS_EVENTS_QUEUE_HPP
+
+// Include ecs::thread
+#ifndef ECS_THREAD_HPP
+#include "../../../../public/bt/ecs/types/ecs_thread.hpp"
+#endif // !ECS_THREAD_HPP
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        void TestEventsQueue()
+        {
+            const ecs_size_t perThread = 20000;
+            ecs_EventsQueue queue;
+            ecs_atomic<bool> start( false );
+            ecs_vec<ecs_thread> producers;
+
+            for ( ecs_size_t thread = 0; thread < ECS_TESTS_THREADS; thread++ )
+            {
+                producers.emplace_back( [&queue, &start, perThread, thread]()
+                {
+                    while ( !start.load(std::memory_order_acquire) )
+                        std::this_thread::yield();
+
+                    for ( ecs_size_t i = 0; i < perThread; i++ )
+                        queue.Push( ecs_Shared<TestEvent>(EVENT_TYPE, static_cast<ecs_ObjectID>(thread * perThread + i)) );
+                } );
+            }
+
+            ecs_size_t next[ECS_TESTS_THREADS] = {};
+            ecs_size_t received = 0;
+
+            start.store( true, std::memory_order_release );
+
+            while ( received < perThread * ECS_TESTS_THREADS )
+            {
+                queue.Drain();
+
+                ecs_EventsQueue::event_ptr event;
+
+                while ( (event = queue.getNext()) != nullptr )
+                {
+                    const ecs_size_t id = static_cast<ecs_size_t>( event->getID() );
+                    const ecs_size_t thread = id / perThread;
+
+                    ECS_TEST_CHECK( thread < ECS_TESTS_THREADS && id % perThread == next[thread] );
+
+                    if ( thread < ECS_TESTS_THREADS )
+                        next[thread] = id % perThread + 1;
+
+                    received++;
+                }
+            }
+
+            for ( ecs_thread& producer : producers )
+                producer.join();
+
+            ECS_TEST_CHECK( queue.Drain() == 0 && queue.getNext() == nullptr );
+
+            for ( ecs_size_t thread = 0; thread < ECS_TESTS_THREADS; thread++ )
+                ECS_TEST_CHECK( next[thread] == perThread );
+        }
+
+        void TestEventsCoalescing()
+        {
+            const ecs_EventsQueue::coalescing_key key = 7;
+            const ecs_time_point now = ecs_clock::now();
+            ecs_EventsQueue queue;
+            ecs_vec<ecs_TypeID> dropped;
+
+            // Keyed Event replaces pending one in its place, removal applies to Events queued before it.
+            queue.Push( ecs_Shared<TestEvent>(EVENT_TYPE, 1), key, now );
+            queue.Push( ecs_Shared<TestEvent>(EVENT_TYPE, 2), 0, now );
+            queue.Push( ecs_Shared<TestEvent>(EVENT_TYPE, 3), key, now );
+            queue.Remove( EVENT_TYPE, 2 );
+            queue.Push( ecs_Shared<TestEvent>(EVENT_TYPE, 2), 0, now );
+
+            ECS_TEST_CHECK( queue.Drain(&dropped) == 2 );
+            ECS_TEST_CHECK( dropped.size() == 2 && dropped[0] == EVENT_TYPE && dropped[1] == EVENT_TYPE );
+
+            // Keys stay valid after removal.
+            queue.Push( ecs_Shared<TestEvent>(EVENT_TYPE, 4), key, now );
+
+            ECS_TEST_CHECK( queue.Drain(&dropped) == 2 && dropped.size() == 3 );
+            ECS_TEST_CHECK( queue.getNext()->getID() == 4 );
+
+            // Sent Event is not replaced, keyed Event is appended.
+            queue.Push( ecs_Shared<TestEvent>(EVENT_TYPE, 5), key, now );
+
+            ECS_TEST_CHECK( queue.Drain(&dropped) == 2 && dropped.size() == 3 );
+            ECS_TEST_CHECK( queue.getNext()->getID() == 2 );
+            ECS_TEST_CHECK( queue.getNext()->getID() == 5 );
+            ECS_TEST_CHECK( queue.getNext() == nullptr );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
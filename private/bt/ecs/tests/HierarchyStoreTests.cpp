@@ -0,0 +1,124 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::HierarchyStore
+#ifndef ECS_HIERARCHY_STORE_HPP
+#include "../../../../public/bt/ecs/hierarchy/HierarchyStore.hpp"
+#endif // !ECS_HIERARCHY_STORE_HPP
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../../../../public/bt/ecs/archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        void TestHierarchyStore()
+        {
+            ecs_ArchetypeStorage storage;
+            const ecs_sptr<ecs_HierarchyStore> hierarchy = ecs_Shared<ecs_HierarchyStore>();
+            ecs_Handle entities[5];
+
+            storage.setHierarchy( hierarchy );
+
+            for ( ecs_int32_t i = 0; i < 5; i++ )
+            {
+                entities[i] = storage.Create();
+                storage.addComponent<Position>( entities[i], Position{ i + 1 } );
+            }
+
+            // 0 -> 1 -> 2, 0 -> 3, 4 is root.
+            ECS_TEST_CHECK( hierarchy->Attach(entities[1], entities[0]) && hierarchy->Attach(entities[2], entities[1]) );
+            ECS_TEST_CHECK( hierarchy->Attach(entities[3], entities[0]) );
+            hierarchy->Attach( entities[4], entities[0] );
+            hierarchy->Detach( entities[4] );
+
+            // Cycle is rejected.
+            ECS_TEST_CHECK( !hierarchy->Attach(entities[0], entities[2]) && !hierarchy->Attach(entities[0], entities[0]) );
+
+            // Getters update dirty hierarchy.
+            ECS_TEST_CHECK( hierarchy->isDirty() && hierarchy->getDepth(entities[2]) == 2 && !hierarchy->isDirty() );
+            ECS_TEST_CHECK( hierarchy->getChildrenCount(entities[0]) == 2 && hierarchy->getChildrenCount(entities[4]) == 0 );
+            ECS_TEST_CHECK( hierarchy->getChild(entities[0], 0) == entities[1] && hierarchy->getChild(entities[0], 1) == entities[3] );
+            ECS_TEST_CHECK( !hierarchy->getChild(entities[0], 2).isValid() && hierarchy->getParent(entities[4]) == ecs_Handle() );
+
+            // Parents are before children.
+            const ecs_vec<ecs_uint32_t>& parents = hierarchy->getParents();
+
+            for ( ecs_size_t node = 0; node < parents.size(); node++ )
+                ECS_TEST_CHECK( parents[node] == ecs_HierarchyStore::NO_INDEX || parents[node] < node );
+
+            // Positions are summed from root: 1, 1+2, 1+2+3, 1+4, 5.
+            hierarchy->Propagate<Position>( storage, []( Position& pChild, const Position* const pParent )
+            {
+                if ( pParent != nullptr )
+                    pChild.mValue += pParent->mValue;
+            } );
+
+            ECS_TEST_CHECK( storage.getComponent<Position>(entities[2])->mValue == 6 && storage.getComponent<Position>(entities[3])->mValue == 5 );
+            ECS_TEST_CHECK( storage.getComponent<Position>(entities[4])->mValue == 5 );
+
+            // Destroyed Entity leaves hierarchy, its children become roots.
+            ECS_TEST_CHECK( storage.Destroy(entities[1]) );
+            ECS_TEST_CHECK( hierarchy->getChildrenCount(entities[0]) == 1 && hierarchy->getDepth(entities[2]) == 0 );
+            ECS_TEST_CHECK( hierarchy->getNode(entities[1]) == ecs_HierarchyStore::NO_INDEX && hierarchy->getDepth(entities[1]) == 0 );
+            ECS_TEST_CHECK( hierarchy->getChild(entities[0], 0) == entities[3] && !hierarchy->getParent(entities[2]).isValid() );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,135 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::Query
+#ifndef ECS_QUERY_HPP
+#include "../../../../public/bt/ecs/query/Query.hpp"
+#endif // !ECS_QUERY_HPP
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        /** Queried Component. **/
+        struct QueryPosition final
+        {
+            ecs_int32_t mValue;
+        };
+
+        /** Queried Component. **/
+        struct QueryVelocity final
+        {
+            ecs_int32_t mValue;
+        };
+
+        /** Excluded tag. **/
+        struct QueryFrozen final
+        {
+        };
+
+        void TestQuery()
+        {
+            ecs_ArchetypeStorage storage;
+            ecs_Handle entities[4];
+
+            for ( ecs_int32_t i = 0; i < 4; i++ )
+            {
+                entities[i] = storage.Create();
+                storage.addComponent<QueryPosition>( entities[i], QueryPosition{ i } );
+            }
+
+            storage.addTag<QueryFrozen>( entities[3] );
+
+            ecs_Query<ecs::Read<QueryPosition>, ecs::Without<QueryFrozen>> positions( storage );
+            ecs_Query<ecs::Changed<QueryPosition>, ecs::Read<QueryPosition>> changed( storage );
+            ecs_Query<ecs::Write<QueryPosition>, ecs::Read<QueryVelocity>> moving( storage );
+            ecs_int32_t sum = 0;
+
+            ECS_TEST_CHECK( positions.Count() == 3 );
+
+            // Archetype created after Query is matched incrementally.
+            storage.addComponent<QueryVelocity>( entities[0], QueryVelocity{ 5 } );
+            ECS_TEST_CHECK( positions.Count() == 3 && moving.Count() == 1 );
+
+            // First run reports all Components, next one nothing.
+            changed.forEach( [&sum]( const QueryPosition& pPosition ) { sum += pPosition.mValue + 1; } );
+            ECS_TEST_CHECK( sum == 10 );
+
+            sum = 0;
+            changed.forEach( [&sum]( const QueryPosition& pPosition ) { sum += pPosition.mValue + 1; } );
+            ECS_TEST_CHECK( sum == 0 );
+
+            // Only marked row is reported.
+            ECS_TEST_CHECK( storage.MarkChanged<QueryPosition>(entities[2]) );
+            changed.forEach( [&sum]( const QueryPosition& pPosition ) { sum += pPosition.mValue + 1; } );
+            ECS_TEST_CHECK( sum == 3 );
+
+            // Write<T> iteration marks written Components changed.
+            moving.forEach( []( QueryPosition& pPosition, const QueryVelocity& pVelocity ) { pPosition.mValue += pVelocity.mValue; } );
+            ECS_TEST_CHECK( storage.getComponent<QueryPosition>(entities[0])->mValue == 5 );
+
+            sum = 0;
+            changed.forEachChunk( [&sum]( const ecs_Handle* const, const ecs_size_t pCount, const QueryPosition* const pPositions )
+            {
+                for ( ecs_size_t i = 0; i < pCount; i++ )
+                    sum += pPositions[i].mValue + 1;
+            } );
+
+            ECS_TEST_CHECK( sum == 6 );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
@@ -0,0 +1,168 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::SnapshotRing
+#ifndef ECS_SNAPSHOT_RING_HPP
+#include "../../../../public/bt/ecs/snapshot/SnapshotRing.hpp"
+#endif // !ECS_SNAPSHOT_RING_HPP
+
+// Include ecs::EntityRegistry
+#ifndef ECS_ENTITY_REGISTRY_HPP
+#include "../../../../public/bt/ecs/entity/EntityRegistry.hpp"
+#endif // !ECS_ENTITY_REGISTRY_HPP
+
+// Include ecs::HierarchyStore
+#ifndef ECS_HIERARCHY_STORE_HPP
+#include "../../../../public/bt/ecs/hierarchy/HierarchyStore.hpp"
+#endif // !ECS_HIERARCHY_STORE_HPP
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        void TestSnapshot()
+        {
+            ecs_ArchetypeStorage storage;
+            ecs_Handle moving[4];
+            ecs_Handle resting[4];
+
+            for ( ecs_size_t i = 0; i < 4; i++ )
+            {
+                moving[i] = storage.Create();
+                storage.addComponent<Position>( moving[i], Position{ static_cast<ecs_int32_t>(i) } );
+                storage.addComponent<Velocity>( moving[i], Velocity{ 1 } );
+
+                resting[i] = storage.Create();
+                storage.addComponent<Position>( resting[i], Position{ static_cast<ecs_int32_t>(i) } );
+            }
+
+            const ecs_uint32_t movingArchetype = storage.getArchetypeOf( moving[0] )->getIndex();
+            const ecs_uint32_t restingArchetype = storage.getArchetypeOf( resting[0] )->getIndex();
+
+            ecs_StorageSnapshot first;
+            ecs_StorageSnapshot second;
+
+            ECS_TEST_CHECK( storage.Capture(first, nullptr) );
+
+            storage.getComponent<Position>( moving[1] )->mValue = 100;
+            storage.MarkChanged<Position>( moving[1] );
+
+            ECS_TEST_CHECK( storage.Capture(second, &first) );
+            ECS_TEST_CHECK( second.mChunks[restingArchetype][0].mPage == first.mChunks[restingArchetype][0].mPage );
+            ECS_TEST_CHECK( second.mChunks[movingArchetype][0].mPage != first.mChunks[movingArchetype][0].mPage );
+
+            // Changes after first snapshot are undone.
+            const ecs_Handle created = storage.Create();
+            storage.Destroy( resting[2] );
+            storage.getComponent<Position>( moving[3] )->mValue = 300;
+            storage.MarkChanged<Position>( moving[3] );
+
+            storage.Restore( first );
+
+            ECS_TEST_CHECK( !storage.isAlive(created) );
+            ECS_TEST_CHECK( storage.isAlive(resting[2]) );
+            ECS_TEST_CHECK( storage.Count() == 8 );
+
+            for ( ecs_size_t i = 0; i < 4; i++ )
+            {
+                ECS_TEST_CHECK( storage.getComponent<Position>(moving[i])->mValue == static_cast<ecs_int32_t>(i) );
+                ECS_TEST_CHECK( storage.getComponent<Position>(resting[i])->mValue == static_cast<ecs_int32_t>(i) );
+            }
+
+            // Ring discards newer frames on Restore.
+            ecs_SnapshotRing ring( storage, 2 );
+
+            ECS_TEST_CHECK( ring.Capture(1) );
+            storage.getComponent<Position>( resting[0] )->mValue = 10;
+            storage.MarkChanged<Position>( resting[0] );
+            ECS_TEST_CHECK( ring.Capture(2) );
+            storage.getComponent<Position>( resting[0] )->mValue = 20;
+            storage.MarkChanged<Position>( resting[0] );
+            ECS_TEST_CHECK( ring.Capture(3) );
+
+            ECS_TEST_CHECK( !ring.hasFrame(1) && ring.getOldestFrame() == 2 );
+            ECS_TEST_CHECK( ring.Restore(2) );
+            ECS_TEST_CHECK( storage.getComponent<Position>(resting[0])->mValue == 10 );
+            ECS_TEST_CHECK( !ring.hasFrame(3) && ring.getNewestFrame() == 2 );
+
+            // Registry & hierarchy are restored with storage.
+            const ecs_sptr<ecs_ArchetypeStorage> shared = ecs_Shared<ecs_ArchetypeStorage>();
+            const ecs_sptr<ecs_HierarchyStore> hierarchy = ecs_Shared<ecs_HierarchyStore>();
+            ecs_EntityRegistry registry( shared );
+            ecs_StorageSnapshot third;
+
+            shared->setHierarchy( hierarchy );
+
+            const ecs_Handle parent = registry.Create();
+            const ecs_Handle child = registry.Create();
+            registry.setComponent( child, 3, true );
+            hierarchy->Attach( child, parent );
+
+            ECS_TEST_CHECK( shared->Capture(third, nullptr) );
+
+            registry.Destroy( parent );
+            const ecs_Handle other = registry.Create();
+            hierarchy->Attach( other, child );
+
+            shared->Restore( third );
+
+            ECS_TEST_CHECK( registry.isAlive(parent) && registry.isAlive(child) && !registry.isAlive(other) && registry.Count() == 2 );
+            ECS_TEST_CHECK( registry.hasComponent(child, 3) && !registry.hasComponent(parent, 3) );
+            ECS_TEST_CHECK( hierarchy->getParent(child) == parent && hierarchy->Count() == 2 && !hierarchy->Contains(other) );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
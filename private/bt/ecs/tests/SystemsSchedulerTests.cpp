@@ -0,0 +1,211 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::SystemsScheduler
+#ifndef ECS_SYSTEMS_SCHEDULER_HPP
+#include "../../../../public/bt/ecs/system/SystemsScheduler.hpp"
+#endif // !ECS_SYSTEMS_SCHEDULER_HPP
+
+// Include C++ stdexcept
+#include <stdexcept>
+
+// Include C++ thread
+#include <thread>
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        /** Scheduled System, records order of update begin & end. **/
+        class ScheduledSystem final : public ecs_ISystem
+        {
+
+        public:
+
+            ecs_Signature mReads;
+            ecs_Signature mWrites;
+            bool mExclusive;
+            bool mThrow;
+            ecs_atomic<ecs_uint32_t>& mSequence;
+            ecs_uint32_t mBegin;
+            ecs_uint32_t mEnd;
+
+            explicit ScheduledSystem( ecs_atomic<ecs_uint32_t>& pSequence, const bool pExclusive = false ) noexcept
+                : mReads(),
+                  mWrites(),
+                  mExclusive( pExclusive ),
+                  mThrow( false ),
+                  mSequence( pSequence ),
+                  mBegin( 0 ),
+                  mEnd( 0 )
+            {
+            }
+
+            virtual ecs_TypeID getTypeID() const BT_NOEXCEPT final
+            { return 0; }
+
+            virtual ecs_ObjectID getID() const BT_NOEXCEPT final
+            { return 0; }
+
+            virtual bool isPaused() const noexcept final
+            { return false; }
+
+            virtual bool isStarted() const noexcept final
+            { return true; }
+
+            virtual const ecs_Signature& getReads() const noexcept final
+            { return mReads; }
+
+            virtual const ecs_Signature& getWrites() const noexcept final
+            { return mWrites; }
+
+            virtual bool isExclusive() const noexcept final
+            { return mExclusive; }
+
+            virtual bool Start() final
+            { return true; }
+
+            virtual void Pause() final
+            {
+            }
+
+            virtual void Stop() final
+            {
+            }
+
+            virtual void Update( const ecs_real_t ) final
+            {
+                mBegin = mSequence.fetch_add( 1, std::memory_order_acq_rel );
+
+                // Gives Systems of same level time to overlap.
+                for ( ecs_uint32_t i = 0; i < 1000; i++ )
+                    std::this_thread::yield();
+
+                if ( mThrow )
+                    throw std::runtime_error( "ScheduledSystem - update failed." );
+
+                mEnd = mSequence.fetch_add( 1, std::memory_order_acq_rel );
+            }
+
+        };
+
+        /**
+         * @brief
+         * Returns 'true' if pFirst finished before pSecond started.
+        **/
+        static bool isBefore( const ScheduledSystem& pFirst, const ScheduledSystem& pSecond ) noexcept
+        { return pFirst.mEnd < pSecond.mBegin; }
+
+        void TestSystemsScheduler()
+        {
+            ecs_atomic<ecs_uint32_t> sequence( 0 );
+            ecs_vec<ecs_sptr<ScheduledSystem>> systems;
+
+            for ( ecs_uint32_t i = 0; i < 6; i++ )
+                systems.push_back( ecs_Shared<ScheduledSystem>(sequence, i == 4) );
+
+            // 0 writes 1, 1 reads 2: no conflict, level 0.
+            systems[0]->mWrites.Set( 1 );
+            systems[1]->mReads.Set( 2 );
+            // 2 reads 1 after 0 writes it, 3 writes 2 after 1 reads it: level 1.
+            systems[2]->mReads.Set( 1 );
+            systems[3]->mWrites.Set( 2 );
+            // 4 is exclusive: level 2, 5 conflicts with it: level 3.
+            systems[5]->mWrites.Set( 3 );
+
+            ecs_vec<ecs_sptr<ecs_ISystem>> scheduled( systems.begin(), systems.end() );
+            ecs_SystemsScheduler scheduler( ECS_TESTS_THREADS - 1 );
+
+            scheduler.Build( scheduled );
+            ECS_TEST_CHECK( scheduler.getLevelsCount() == 4 );
+
+            for ( ecs_uint32_t frame = 0; frame < 10; frame++ )
+            {
+                scheduler.Run( 0.0f );
+
+                // Barriers: conflicting Systems run in declared order.
+                ECS_TEST_CHECK( isBefore(*systems[0], *systems[2]) && isBefore(*systems[1], *systems[3]) );
+                ECS_TEST_CHECK( isBefore(*systems[2], *systems[4]) && isBefore(*systems[3], *systems[4]) );
+                ECS_TEST_CHECK( isBefore(*systems[4], *systems[5]) );
+            }
+
+            // Reversed order reverses dependencies.
+            ecs_vec<ecs_sptr<ecs_ISystem>> reversed( scheduled.rbegin(), scheduled.rend() );
+            scheduler.Build( reversed );
+            scheduler.Run( 0.0f );
+
+            ECS_TEST_CHECK( scheduler.getLevelsCount() == 4 );
+            ECS_TEST_CHECK( isBefore(*systems[2], *systems[0]) && isBefore(*systems[3], *systems[1]) );
+            ECS_TEST_CHECK( isBefore(*systems[5], *systems[4]) && isBefore(*systems[4], *systems[2]) );
+
+            // Exception is rethrown after level finished.
+            systems[1]->mThrow = true;
+            bool thrown = false;
+
+            try
+            {
+                scheduler.Run( 0.0f );
+            }
+            catch( const std::runtime_error& )
+            {
+                thrown = true;
+            }
+
+            ECS_TEST_CHECK( thrown );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
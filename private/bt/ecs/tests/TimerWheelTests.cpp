@@ -0,0 +1,150 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::tests
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include ecs::TimerWheel
+#ifndef ECS_TIMER_WHEEL_HPP
+#include "../../../../public/bt/ecs/event/TimerWheel.hpp"
+#endif // !ECS_TIMER_WHEEL_HPP
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        void TestTimerWheel()
+        {
+            static constexpr const ecs_uint64_t LEVEL_1 = 256;
+            static constexpr const ecs_uint64_t LEVEL_2 = LEVEL_1 * 256;
+            static constexpr const ecs_uint64_t LEVEL_3 = LEVEL_2 * 256;
+
+            const ecs_uint64_t dues[] = { 1, LEVEL_1 - 1, LEVEL_1, LEVEL_1 + 1, LEVEL_1 * 2, LEVEL_2 - 1, LEVEL_2, LEVEL_2 + 1,
+                                          LEVEL_2 + LEVEL_1, LEVEL_3 - 1, LEVEL_3, LEVEL_3 + 1, LEVEL_3 + LEVEL_2 + LEVEL_1 + 1 };
+            const ecs_size_t count = sizeof( dues ) / sizeof( dues[0] );
+
+            ecs_TimerWheel wheel;
+            ecs_vec<ecs_TimerWheel::Fired> fired;
+            ecs_uint64_t firedAt[count] = {};
+
+            // Thread-Type is used as timer index.
+            for ( ecs_size_t i = 0; i < count; i++ )
+                wheel.Schedule( ecs_Shared<TestEvent>(EVENT_TYPE, i), static_cast<ecs_uint8_t>(i), dues[i], 0 );
+
+            for ( ecs_uint64_t tick = 1; tick <= dues[count - 1]; tick++ )
+            {
+                wheel.Advance( tick, fired );
+
+                for ( const ecs_TimerWheel::Fired& timer : fired )
+                {
+                    ECS_TEST_CHECK( firedAt[timer.mThread] == 0 );
+                    firedAt[timer.mThread] = tick;
+                }
+
+                fired.clear();
+            }
+
+            for ( ecs_size_t i = 0; i < count; i++ )
+                ECS_TEST_CHECK( firedAt[i] == dues[i] );
+
+            ECS_TEST_CHECK( wheel.Count() == 0 );
+
+            // Periodic timers, across level 2 boundary.
+            const ecs_uint64_t start = wheel.getNow();
+            const ecs_uint64_t periods[] = { 1, 100, 300, LEVEL_1 };
+            const ecs_size_t periodic = sizeof( periods ) / sizeof( periods[0] );
+            ecs_TimerID timers[periodic];
+            ecs_size_t calls[periodic] = {};
+
+            for ( ecs_size_t i = 0; i < periodic; i++ )
+                timers[i] = wheel.Schedule( ecs_Shared<TestEvent>(EVENT_TYPE, i), static_cast<ecs_uint8_t>(i), start + periods[i], periods[i] );
+
+            const ecs_uint64_t end = start + LEVEL_2 + LEVEL_1 * 3;
+
+            for ( ecs_uint64_t tick = start + 1; tick <= end; tick++ )
+            {
+                wheel.Advance( tick, fired );
+
+                for ( const ecs_TimerWheel::Fired& timer : fired )
+                {
+                    calls[timer.mThread]++;
+                    ECS_TEST_CHECK( tick - start == periods[timer.mThread] * calls[timer.mThread] );
+                }
+
+                fired.clear();
+            }
+
+            for ( ecs_size_t i = 0; i < periodic; i++ )
+                ECS_TEST_CHECK( calls[i] == (end - start) / periods[i] );
+
+            ECS_TEST_CHECK( wheel.Count() == periodic );
+            ECS_TEST_CHECK( wheel.Cancel(timers[1]) );
+            ECS_TEST_CHECK( !wheel.Cancel(timers[1]) );
+
+            wheel.Advance( end + LEVEL_1 * 2, fired );
+
+            for ( const ecs_TimerWheel::Fired& timer : fired )
+                ECS_TEST_CHECK( timer.mThread != 1 );
+
+            fired.clear();
+
+            // Past due tick fires on next tick.
+            wheel.Clear();
+            wheel.Schedule( ecs_Shared<TestEvent>(EVENT_TYPE, 0), 0, 0, 0 );
+            wheel.Advance( wheel.getNow() + 1, fired );
+
+            ECS_TEST_CHECK( fired.size() == 1 && wheel.Count() == 0 );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
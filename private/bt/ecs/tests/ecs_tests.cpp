@@ -0,0 +1,159 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_TESTS_HPP
+#include "ecs_tests.hpp"
+#endif // !ECS_TESTS_HPP
+
+// Include C++ cstdio
+#include <cstdio>
+
+// Include C++ cstring
+#include <cstring>
+
+// ===========================================================
+// ecs::tests
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Test - named test function.
+        **/
+        struct Test final
+        {
+            /** Test name, used as ctest argument. **/
+            const char* mName;
+
+            /** Test function. **/
+            void (*mFunction)();
+        };
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Tests. **/
+        static const Test TESTS[] = {
+            { "events_queue", TestEventsQueue },
+            { "component_pool", TestComponentPool },
+            { "archetype_storage", TestArchetypeStorage },
+            { "query", TestQuery },
+            { "component_type", TestComponentType },
+            { "systems_scheduler", TestSystemsScheduler },
+            { "command_queue", TestCommandQueue },
+            { "hierarchy_store", TestHierarchyStore },
+            { "destroy_batch", TestDestroyBatch },
+            { "snapshot", TestSnapshot },
+            { "component_observers", TestComponentObservers },
+            { "event_listeners", TestEventListeners },
+            { "event_lanes", TestEventLanes },
+            { "timer_wheel", TestTimerWheel },
+            { "events_coalescing", TestEventsCoalescing },
+            { "event_recorder", TestEventRecorder } };
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Failed checks count. **/
+        static ecs_size_t gFailed = 0;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        void Check( const bool pCondition, const char* const pExpression, const char* const pFile, const int pLine )
+        {
+            if ( pCondition )
+                return;
+
+            gFailed++;
+            std::fprintf( stderr, "%s:%d: check failed: %s\n", pFile, pLine, pExpression );
+        }
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// ===========================================================
+// MAIN
+// ===========================================================
+
+int main( int argc, char** argv )
+{
+    const char* const name = argc > 1 ? argv[1] : nullptr;
+    bool found = false;
+
+    for ( const ecs::tests::Test& test : ecs::tests::TESTS )
+    {
+        if ( name != nullptr && std::strcmp(name, test.mName) != 0 )
+            continue;
+
+        const ecs_size_t failed = ecs::tests::gFailed;
+
+        test.mFunction();
+        found = true;
+
+        std::fprintf( stderr, "%-20s %s\n", test.mName, ecs::tests::gFailed == failed ? "passed" : "FAILED" );
+    }
+
+    if ( !found )
+    {
+        std::fprintf( stderr, "btEngine_ECS_tests: unknown test %s\n", name );
+        return 1;
+    }
+
+    return ecs::tests::gFailed == 0 ? 0 : 1;
+}
+
+// -----------------------------------------------------------
@@ -0,0 +1,269 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_TESTS_HPP
+#define ECS_TESTS_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::IEvent
+#ifndef ECS_I_EVENT_HXX
+#include "../../../../public/bt/ecs/event/IEvent.hxx"
+#endif // !ECS_I_EVENT_HXX
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "../../../../public/bt/ecs/types/ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Producer threads of concurrent tests. **/
+#ifndef ECS_TESTS_THREADS
+#define ECS_TESTS_THREADS 4
+#endif // !ECS_TESTS_THREADS
+
+/** Checks condition, failure is reported & counted. **/
+#define ECS_TEST_CHECK( pCondition ) ecs::tests::Check( (pCondition), #pCondition, __FILE__, __LINE__ )
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    namespace tests
+    {
+
+        // -----------------------------------------------------------
+
+        /** Event, ID is set by test. **/
+        class TestEvent final : public ecs_IEvent
+        {
+
+        private:
+
+            const ecs_TypeID mTypeID;
+
+            const ecs_ObjectID mID;
+
+            const bool mRepeat;
+
+        public:
+
+            explicit TestEvent( const ecs_TypeID pType, const ecs_ObjectID pID, const bool pRepeat = false )
+                : mTypeID( pType ),
+                  mID( pID ),
+                  mRepeat( pRepeat )
+            {
+            }
+
+            virtual ecs_TypeID getTypeID() const ECS_NOEXCEPT override
+            { return mTypeID; }
+
+            virtual ecs_ObjectID getID() const ECS_NOEXCEPT override
+            { return mID; }
+
+            virtual bool isHandled() const ECS_NOEXCEPT override
+            { return false; }
+
+            virtual bool isRepeatable() const ECS_NOEXCEPT override
+            { return mRepeat; }
+
+            virtual void onError( ecs_sptr<ecs_IEvent>& pEvent, const std::exception& pException, const bool pAsync, const unsigned pThread ) override
+            {
+                (void)pEvent; (void)pException; (void)pAsync; (void)pThread;
+            }
+
+            virtual void onSend( ecs_sptr<ecs_IEvent>& pEvent, const bool pAsync, const unsigned pThread ) override
+            {
+                (void)pEvent; (void)pAsync; (void)pThread;
+            }
+
+        };
+
+        /** Component. **/
+        struct Position final
+        {
+            ecs_int32_t mValue;
+        };
+
+        /** Component. **/
+        struct Velocity final
+        {
+            ecs_int32_t mValue;
+        };
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Event Type-ID. **/
+        static constexpr const ecs_TypeID EVENT_TYPE = 1;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Counts & reports failed check.
+         *
+         * @param pCondition - checked condition.
+         * @param pExpression - condition source.
+         * @param pFile - source file.
+         * @param pLine - source line.
+        **/
+        void Check( const bool pCondition, const char* const pExpression, const char* const pFile, const int pLine );
+
+        /**
+         * @brief
+         * Producers push Events at once, consumer drains them concurrently.
+         * Every Event is received once, Events of one producer keep order.
+        **/
+        void TestEventsQueue();
+
+        /**
+         * @brief
+         * Pool keeps Handles valid on removal & is bound to its C++ type.
+        **/
+        void TestComponentPool();
+
+        /**
+         * @brief
+         * Checks ArchetypeStorage Attach: throwing constructor leaves Entity & observers unchanged.
+        **/
+        void TestArchetypeStorage();
+
+        /**
+         * @brief
+         * Checks Query matching & Changed<T> filtering.
+        **/
+        void TestQuery();
+
+        /**
+         * @brief
+         * Checks ComponentType manual & generated Type-IDs.
+        **/
+        void TestComponentType();
+
+        /**
+         * @brief
+         * Checks SystemsScheduler levels, barriers & exceptions.
+        **/
+        void TestSystemsScheduler();
+
+        /**
+         * @brief
+         * Commands of one Entity are applied in recorded order,
+         * commands of stale Handles are ignored, not attached payload is destroyed.
+        **/
+        void TestCommandQueue();
+
+        /**
+         * @brief
+         * Checks HierarchyStore Attach, Remove, getters & Propagate.
+        **/
+        void TestHierarchyStore();
+
+        /**
+         * @brief
+         * Batch destruction, in any order & with duplicates,
+         * keeps Components of surviving Entities.
+        **/
+        void TestDestroyBatch();
+
+        /**
+         * @brief
+         * Not changed Chunks share snapshot pages, Restore brings back
+         * Components, Handles, registry & hierarchy of captured frame.
+        **/
+        void TestSnapshot();
+
+        /**
+         * @brief
+         * Observers receive recorded events on Notify,
+         * once per run of same event, Handles in order of recording.
+        **/
+        void TestComponentObservers();
+
+        /**
+         * @brief
+         * Listeners, changed while Events are sent, apply to next Events,
+         * senders keep using published snapshots.
+        **/
+        void TestEventListeners();
+
+        /**
+         * @brief
+         * Higher priority lanes are sent first, within lane budgets,
+         * starved lanes are sent first after ECS_EVENT_STARVATION_UPDATES.
+        **/
+        void TestEventLanes();
+
+        /**
+         * @brief
+         * Timers fire exactly at due tick across levels boundaries,
+         * periodic timers are scheduled again until cancelled.
+        **/
+        void TestTimerWheel();
+
+        /**
+         * @brief
+         * Keyed Events replace pending ones in their place,
+         * removals apply only to Events, queued before them.
+        **/
+        void TestEventsCoalescing();
+
+        /**
+         * @brief
+         * Recorded log, loaded into other recorder, replays
+         * same Events frame by frame.
+        **/
+        void TestEventRecorder();
+
+        // -----------------------------------------------------------
+
+    } /// ecs::tests
+
+} /// ecs
+
+// -----------------------------------------------------------
+
+#endif // !ECS_TESTS_HPP
@@ -0,0 +1,104 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// HEADER
+#ifndef ECS_TYPE_ID_HPP
+#include "../../../../public/bt/ecs/types/ecs_type_id.hpp"
+#endif // !ECS_TYPE_ID_HPP
+
+// Include ecs::atomic
+#ifndef ECS_ATOMIC_HPP
+#include "../../../../public/bt/ecs/types/ecs_atomic.hpp"
+#endif // !ECS_ATOMIC_HPP
+
+// DEBUG
+#if defined( DEBUG ) || defined( BT_DEBUG )
+
+// Include ecs::assert
+#ifndef ECS_ASSERT_HPP
+#include "../../../../public/bt/ecs/types/ecs_assert.hpp"
+#endif // !ECS_ASSERT_HPP
+
+#endif
+// DEBUG
+
+// ===========================================================
+// ecs::TypeIdCounter
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    // ===========================================================
+    // FIELDS
+    // ===========================================================
+
+    /** Generated Type-IDs count, per family. **/
+    static ecs_atomic<ecs_TypeID> gTypeIdCounters[ECS_MAX_TYPE_FAMILIES];
+
+    // ===========================================================
+    // GETTERS & SETTERS
+    // ===========================================================
+
+    ecs_TypeID TypeIdCounter::Count( const ecs_uint8_t pFamily ) noexcept
+    { return gTypeIdCounters[pFamily].load(); }
+
+    // ===========================================================
+    // METHODS
+    // ===========================================================
+
+    ecs_TypeID TypeIdCounter::Next( const ecs_uint8_t pFamily, const ecs_TypeID pFirst ) noexcept
+    {
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+        ecs_assert( pFamily < ECS_MAX_TYPE_FAMILIES && "TypeIdCounter::Next - family index out of range." );
+#endif // DEBUG
+
+        const ecs_TypeID typeID = static_cast<ecs_TypeID>( pFirst + gTypeIdCounters[pFamily]++ );
+
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+        ecs_assert( typeID < ECS_INVALID_TYPE_ID && "TypeIdCounter::Next - out of Type-IDs." );
+#endif // DEBUG
+
+        return typeID;
+    }
+
+    // -----------------------------------------------------------
+
+} /// ecs
@@ -62,6 +62,12 @@
 template <typename K, typename V>
 using bt_map = std::map<K, V>;
 
+// Include C++ unordered_map
+#include <unordered_map>
+
+template <typename K, typename V>
+using bt_hash_map = std::unordered_map<K, V>;
+
 #else
 #error "bt_map.hpp - configuration required."
 #endif
@@ -98,6 +98,28 @@ namespace bt
 
 using bt_EThreadTypes = bt::core::EThreadTypes;
 
+// PLATFORM
+#if defined( ANDROID ) || defined( BT_ANDROID ) || defined( BT_LINUX ) || defined( BT_WINDOWS )
+
+// Include C++ thread
+#include <thread>
+
+// Include C++ mutex
+#include <mutex>
+
+// Include C++ condition_variable
+#include <condition_variable>
+
+using bt_thread = std::thread;
+using bt_StdMutex = std::mutex;
+using bt_UniqueLock = std::unique_lock<std::mutex>;
+using bt_ConditionVariable = std::condition_variable;
+
+#else
+#error "bt_threads.hpp - platform not detected, configuration required."
+#endif
+// PLATFORM
+
 // -----------------------------------------------------------
 
 #endif // !BT_CFG_THREADS_HPP
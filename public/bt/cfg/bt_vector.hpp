@@ -50,8 +50,8 @@
 // Include STL (C++) vector
 #include <vector>
 
-template <typename T>
-using bt_vector = std::vector<T>;
+template <typename T, typename A = std::allocator<T>>
+using bt_vector = std::vector<T, A>;
 
 // -----------------------------------------------------------
 
@@ -0,0 +1,270 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef BT_CORE_SLAB_ALLOCATOR_HPP
+#define BT_CORE_SLAB_ALLOCATOR_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include bt::core::VirtualMemory
+#ifndef BT_CORE_VIRTUAL_MEMORY_HPP
+#include "VirtualMemory.hpp"
+#endif // !BT_CORE_VIRTUAL_MEMORY_HPP
+
+// Include bt::vector
+#ifndef BT_CFG_VECTOR_HPP
+#include "../../cfg/bt_vector.hpp"
+#endif // !BT_CFG_VECTOR_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace bt
+{
+
+    namespace core
+    {
+
+        // -----------------------------------------------------------
+
+        /**
+         * @brief
+         * SlabAllocator - fixed-size blocks allocator over single reserved address range.
+         *
+         * Range is reserved once (no physical memory used), pages are committed
+         * on demand in #getCommitStep increments. Released blocks are reused first,
+         * they stay committed, so allocation & release make no system calls.
+         * #Trim returns pages of released blocks to OS.
+         *
+         * (?) Not thread-safe, use one allocator per thread or external lock.
+         *
+         * @version 0.1
+        **/
+        class BT_API SlabAllocator final
+        {
+
+            // -----------------------------------------------------------
+
+            // ===========================================================
+            // META
+            // ===========================================================
+
+            BT_CLASS
+
+            // -----------------------------------------------------------
+
+        private:
+
+            // -----------------------------------------------------------
+
+            // ===========================================================
+            // FIELDS
+            // ===========================================================
+
+            /** Pages type. **/
+            const EPageTypes mPages;
+
+            /** Block size (bytes). **/
+            const bt_size_t mBlockSize;
+
+            /** Reserved size (bytes). **/
+            const bt_size_t mCapacity;
+
+            /** Commit granularity (bytes). **/
+            const bt_size_t mCommitStep;
+
+            /** 'true' if released blocks cover whole pages & can be purged by #Trim. **/
+            const bool mPurgeBlocks;
+
+            /** Reserved range. **/
+            unsigned char* const mAddress;
+
+            /** Committed size (bytes). **/
+            bt_size_t mCommitted;
+
+            /** Used size (bytes), bump-pointer offset. **/
+            bt_size_t mUsed;
+
+            /** Allocated blocks count. **/
+            bt_size_t mAllocated;
+
+            /** Released blocks. **/
+            bt_vector<void*> mFreeBlocks;
+
+            // ===========================================================
+            // DELETED
+            // ===========================================================
+
+            SlabAllocator(const SlabAllocator&) = delete;
+            SlabAllocator& operator=(const SlabAllocator&) = delete;
+            SlabAllocator(SlabAllocator&&) = delete;
+            SlabAllocator& operator=(SlabAllocator&&) = delete;
+
+            // -----------------------------------------------------------
+
+        public:
+
+            // -----------------------------------------------------------
+
+            // ===========================================================
+            // CONSTRUCTOR & DESTRUCTOR
+            // ===========================================================
+
+            /**
+             * @brief
+             * SlabAllocator constructor.
+             *
+             * @param pBlockSize - block size (bytes), rounded up to pointer alignment.
+             * @param pCapacity - max size (bytes) to reserve.
+             * @param pPages - pages type.
+             * @throws - std::bad_alloc, if range can't be reserved.
+            **/
+            explicit SlabAllocator( const bt_size_t pBlockSize, const bt_size_t pCapacity, const EPageTypes pPages = EPageTypes::Default );
+
+            /**
+             * @brief
+             * SlabAllocator destructor.
+             *
+             * Releases whole range, allocated blocks become invalid.
+             *
+             * @throws - no exceptions.
+            **/
+            ~SlabAllocator() BT_NOEXCEPT;
+
+            // ===========================================================
+            // GETTERS & SETTERS
+            // ===========================================================
+
+            /**
+             * @brief
+             * Returns block size (bytes).
+             *
+             * @thread_safety - not thread-safe.
+             * @throws - no exceptions.
+            **/
+            bt_size_t getBlockSize() const BT_NOEXCEPT;
+
+            /**
+             * @brief
+             * Returns commit granularity (bytes).
+             *
+             * @thread_safety - not thread-safe.
+             * @throws - no exceptions.
+            **/
+            bt_size_t getCommitStep() const BT_NOEXCEPT;
+
+            /**
+             * @brief
+             * Returns committed size (bytes).
+             *
+             * @thread_safety - not thread-safe.
+             * @throws - no exceptions.
+            **/
+            bt_size_t getCommitted() const BT_NOEXCEPT;
+
+            /**
+             * @brief
+             * Returns allocated blocks count.
+             *
+             * @thread_safety - not thread-safe.
+             * @throws - no exceptions.
+            **/
+            bt_size_t Count() const BT_NOEXCEPT;
+
+            /**
+             * @brief
+             * Check if address belongs to this allocator.
+             *
+             * @thread_safety - not thread-safe.
+             * @param pAddress - address.
+             * @throws - no exceptions.
+            **/
+            bool Owns( const void* const pAddress ) const BT_NOEXCEPT;
+
+            // ===========================================================
+            // METHODS
+            // ===========================================================
+
+            /**
+             * @brief
+             * Allocates block.
+             *
+             * @thread_safety - not thread-safe.
+             * @return - block, or null if capacity reached or commit failed.
+             * @throws - can throw exception (free-list).
+            **/
+            void* Allocate();
+
+            /**
+             * @brief
+             * Releases block, returned by #Allocate.
+             *
+             * @thread_safety - not thread-safe.
+             * @param pBlock - block.
+             * @throws - can throw exception (free-list).
+            **/
+            void Deallocate( void* const pBlock );
+
+            /**
+             * @brief
+             * Returns all committed pages to OS, if no blocks allocated.
+             * Otherwise pages of released blocks are purged, if blocks cover whole pages.
+             *
+             * (?) Not for hot path, one system call per released block.
+             *
+             * @thread_safety - not thread-safe.
+             * @return - 'true' if some pages returned.
+             * @throws - no exceptions.
+            **/
+            bool Trim() BT_NOEXCEPT;
+
+            // -----------------------------------------------------------
+
+        }; /// bt::core::SlabAllocator
+
+        // -----------------------------------------------------------
+
+    } /// bt::core
+
+} /// bt
+
+using bt_SlabAllocator = bt::core::SlabAllocator;
+#define BT_CORE_SLAB_ALLOCATOR_DECL
+
+// -----------------------------------------------------------
+
+#endif // !BT_CORE_SLAB_ALLOCATOR_HPP
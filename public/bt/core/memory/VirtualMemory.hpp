@@ -0,0 +1,258 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef BT_CORE_VIRTUAL_MEMORY_HPP
+#define BT_CORE_VIRTUAL_MEMORY_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include bt::api
+#ifndef BT_CFG_API_HPP
+#include "../../cfg/bt_api.hpp"
+#endif // !BT_CFG_API_HPP
+
+// Include bt::numeric
+#ifndef BT_CFG_NUMERIC_HPP
+#include "../../cfg/bt_numeric.hpp"
+#endif // !BT_CFG_NUMERIC_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace bt
+{
+
+    namespace core
+    {
+
+        // -----------------------------------------------------------
+
+        /**
+         * @brief
+         * EPageTypes - pages backing reserved range.
+         *
+         * @version 0.1
+        **/
+        BT_ENUM_TYPE BT_API EPageTypes : bt_uint8_t
+        {
+
+            // -----------------------------------------------------------
+
+            // ===========================================================
+            // META
+            // ===========================================================
+
+            BT_ENUM
+
+            // ===========================================================
+            // CONSTANTS
+            // ===========================================================
+
+            /** Regular OS pages. **/
+            Default = 0,
+            /** Transparent huge pages (madvise hint), range aligned to huge page size. **/
+            Transparent = 1,
+            /** Explicit huge pages (MAP_HUGETLB, MEM_LARGE_PAGES), falls back to Transparent. **/
+            Huge = 2
+
+            // -----------------------------------------------------------
+
+        }; /// bt::core::EPageTypes
+
+        // -----------------------------------------------------------
+
+        /**
+         * @brief
+         * VirtualMemory - utility-class to reserve, commit & release address ranges
+         * directly from OS, bypassing general heap.
+         *
+         * (?) Reserved range is not accessible until committed.
+         * (?) Decommitted pages are returned to OS, range stays reserved.
+         *
+         * @thread_safety - thread-safe (no state).
+         * @version 0.1
+        **/
+        class BT_API VirtualMemory final
+        {
+
+            // -----------------------------------------------------------
+
+            // ===========================================================
+            // META
+            // ===========================================================
+
+            BT_CLASS
+
+            // -----------------------------------------------------------
+
+        private:
+
+            // -----------------------------------------------------------
+
+            // ===========================================================
+            // DELETED
+            // ===========================================================
+
+            VirtualMemory() = delete;
+            VirtualMemory(const VirtualMemory&) = delete;
+            VirtualMemory& operator=(const VirtualMemory&) = delete;
+            VirtualMemory(VirtualMemory&&) = delete;
+            VirtualMemory& operator=(VirtualMemory&&) = delete;
+
+            // -----------------------------------------------------------
+
+        public:
+
+            // -----------------------------------------------------------
+
+            // ===========================================================
+            // CONSTANTS
+            // ===========================================================
+
+            /** Huge page size (x86-64 & ARM64 default). **/
+            static constexpr const bt_size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+            // ===========================================================
+            // GETTERS & SETTERS
+            // ===========================================================
+
+            /**
+             * @brief
+             * Returns OS page size (commit granularity).
+             *
+             * @thread_safety - thread-safe.
+             * @throws - no exceptions.
+            **/
+            static bt_size_t getPageSize() BT_NOEXCEPT;
+
+            /**
+             * @brief
+             * Rounds size up to alignment.
+             *
+             * @thread_safety - thread-safe.
+             * @param pSize - size in bytes.
+             * @param pAlignment - power of two.
+             * @throws - no exceptions.
+            **/
+            static constexpr bt_size_t RoundUp( const bt_size_t pSize, const bt_size_t pAlignment ) BT_NOEXCEPT
+            { return (pSize + pAlignment - 1) & ~(pAlignment - 1); }
+
+            // ===========================================================
+            // METHODS
+            // ===========================================================
+
+            /**
+             * @brief
+             * Reserves address range without committing physical memory.
+             *
+             * (?) Explicit huge pages are committed on reserve.
+             *
+             * @thread_safety - thread-safe.
+             * @param pSize - size in bytes, rounded up to page (or huge page) size.
+             * @param pPages - pages type.
+             * @return - range start, or null if failed.
+             * @throws - no exceptions.
+            **/
+            static void* Reserve( const bt_size_t pSize, const EPageTypes pPages = EPageTypes::Default ) BT_NOEXCEPT;
+
+            /**
+             * @brief
+             * Commits pages inside reserved range, making them readable & writable.
+             *
+             * @thread_safety - thread-safe.
+             * @param pAddress - page-aligned address.
+             * @param pSize - size in bytes.
+             * @return - 'true' if committed.
+             * @throws - no exceptions.
+            **/
+            static bool Commit( void* const pAddress, const bt_size_t pSize ) BT_NOEXCEPT;
+
+            /**
+             * @brief
+             * Returns pages to OS (madvise), range stays reserved but not accessible.
+             *
+             * @thread_safety - thread-safe.
+             * @param pAddress - page-aligned address.
+             * @param pSize - size in bytes.
+             * @throws - no exceptions.
+            **/
+            static void Decommit( void* const pAddress, const bt_size_t pSize ) BT_NOEXCEPT;
+
+            /**
+             * @brief
+             * Returns pages to OS, range stays committed, readable & writable.
+             * Protection is not changed, so range is not split by OS.
+             *
+             * (?) Pages content is undefined after purge.
+             * (?) Explicit huge pages are purged only as whole huge pages.
+             *
+             * @thread_safety - thread-safe.
+             * @param pAddress - page-aligned address.
+             * @param pSize - size in bytes.
+             * @throws - no exceptions.
+            **/
+            static void Purge( void* const pAddress, const bt_size_t pSize ) BT_NOEXCEPT;
+
+            /**
+             * @brief
+             * Releases whole range, returned by #Reserve.
+             *
+             * @thread_safety - thread-safe.
+             * @param pAddress - range start.
+             * @param pSize - size passed to #Reserve.
+             * @param pPages - pages type passed to #Reserve.
+             * @throws - no exceptions.
+            **/
+            static void Release( void* const pAddress, const bt_size_t pSize, const EPageTypes pPages = EPageTypes::Default ) BT_NOEXCEPT;
+
+            // -----------------------------------------------------------
+
+        }; /// bt::core::VirtualMemory
+
+        // -----------------------------------------------------------
+
+    } /// bt::core
+
+} /// bt
+
+using bt_EPageTypes = bt::core::EPageTypes;
+using bt_VirtualMemory = bt::core::VirtualMemory;
+#define BT_CORE_VIRTUAL_MEMORY_DECL
+
+// -----------------------------------------------------------
+
+#endif // !BT_CORE_VIRTUAL_MEMORY_HPP
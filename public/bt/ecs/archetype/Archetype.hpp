@@ -0,0 +1,747 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_ARCHETYPE_HPP
+#define ECS_ARCHETYPE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::Signature
+#ifndef ECS_SIGNATURE_HPP
+#include "Signature.hpp"
+#endif // !ECS_SIGNATURE_HPP
+
+// Include ecs::handle
+#ifndef ECS_HANDLE_HPP
+#include "../types/ecs_handle.hpp"
+#endif // !ECS_HANDLE_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// Include ecs::map
+#ifndef ECS_MAP_HPP
+#include "../types/ecs_map.hpp"
+#endif // !ECS_MAP_HPP
+
+// Include ecs::atomic
+#ifndef ECS_ATOMIC_HPP
+#include "../types/ecs_atomic.hpp"
+#endif // !ECS_ATOMIC_HPP
+
+// Include bt::core::SlabAllocator
+#ifndef BT_CORE_SLAB_ALLOCATOR_HPP
+#include "../../core/memory/SlabAllocator.hpp"
+#endif // !BT_CORE_SLAB_ALLOCATOR_HPP
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Archetype Chunk size (bytes). **/
+#ifndef ECS_ARCHETYPE_CHUNK_SIZE
+#define ECS_ARCHETYPE_CHUNK_SIZE 16384
+#endif // !ECS_ARCHETYPE_CHUNK_SIZE
+
+/** Columns alignment inside Chunk (bytes). **/
+#ifndef ECS_ARCHETYPE_COLUMN_ALIGN
+#define ECS_ARCHETYPE_COLUMN_ALIGN 64
+#endif // !ECS_ARCHETYPE_COLUMN_ALIGN
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * ArchetypeChunk - fixed-size memory block with Archetype rows.
+     *
+     * Layout (SoA): Entity Handles column, then one column per Component type.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API ArchetypeChunk final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_STRUCT
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Memory (ECS_ARCHETYPE_CHUNK_SIZE bytes). **/
+        unsigned char* mData;
+
+        /** Rows count. **/
+        ecs_uint32_t mCount;
+
+        /** Tick of last rows allocation, removal or restore. **/
+        ecs_uint32_t mVersion;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::ArchetypeChunk
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * ArchetypeRow - Entity location inside Archetype.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API ArchetypeRow final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_STRUCT
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Chunk index. **/
+        ecs_uint32_t mChunk;
+
+        /** Row index inside Chunk. **/
+        ecs_uint32_t mRow;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::ArchetypeRow
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * Archetype - storage for Entities with same set of Component types.
+     *
+     * Entities are packed into Chunks without holes: removed row
+     * is replaced by last row of last Chunk.
+     *
+     * Tag (empty) Component types are only Signature bits, without columns,
+     * so Entities with different tags have same row size.
+     *
+     * Changes are tracked per Chunk column: version is tick of last change,
+     * dirty-rows bitset marks rows changed at that tick. Rows, changed before it,
+     * are reported by previous version (conservative: whole Chunk column).
+     *
+     * @thread_safety - not thread-safe, structural changes must be synchronized.
+     * @version 0.1
+    **/
+    class ECS_API Archetype final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Missing column index. **/
+        static constexpr const ecs_int16_t NO_COLUMN = -1;
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Chunk column change versions.
+        **/
+        struct ColumnVersion final
+        {
+            /** Tick of last change. **/
+            ecs_uint32_t mVersion;
+
+            /** Changes before this tick are not tracked per row. **/
+            ecs_uint32_t mPrevVersion;
+        };
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Index in Archetypes storage. **/
+        const ecs_uint32_t mIndex;
+
+        /** Storage change tick. **/
+        const ecs_atomic<ecs_uint32_t>& mTick;
+
+        /** Component types set. **/
+        const ecs_Signature mSignature;
+
+        /** Chunks memory allocator. **/
+        bt_SlabAllocator& mAllocator;
+
+        /** Columns types, sorted by Type-ID. **/
+        ecs_vec<const ecs_ComponentTypeInfo*> mTypes;
+
+        /** Columns offsets inside Chunk. **/
+        ecs_vec<ecs_uint32_t> mOffsets;
+
+        /** Column index for each Type-ID, or NO_COLUMN. **/
+        ecs_int16_t mColumns[ECS_MAX_COMPONENT_TYPES];
+
+        /** Rows per Chunk. **/
+        ecs_uint32_t mChunkCapacity;
+
+        /** Chunks. **/
+        ecs_vec<ArchetypeChunk> mChunks;
+
+        /** Rows count. **/
+        ecs_size_t mCount;
+
+        /** Versions, [Chunk * columns + column]. **/
+        ecs_vec<ColumnVersion> mVersions;
+
+        /** 64-bit words of dirty-rows bitset. **/
+        ecs_uint32_t mDirtyWords;
+
+        /** Dirty rows, [(Chunk * columns + column) * mDirtyWords + word]. **/
+        ecs_vec<ecs_uint64_t> mDirtyRows;
+
+        /** Cached transitions: Archetype with added Type-ID. **/
+        ecs_map<ecs_TypeID, Archetype*> mAddEdges;
+
+        /** Cached transitions: Archetype with removed Type-ID. **/
+        ecs_map<ecs_TypeID, Archetype*> mRemoveEdges;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Merges change state of moved row into destination row.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pDst - destination row.
+         * @param pSrc - source row, its dirty bit is cleared.
+         * @param pColumn - column index.
+         * @throws - no exceptions.
+        **/
+        void MergeChanges( const ArchetypeRow& pDst, const ArchetypeRow& pSrc, const ecs_size_t pColumn ) noexcept;
+
+        /**
+         * @brief
+         * Appends empty Chunk.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - std::bad_alloc.
+        **/
+        void AddChunk();
+
+        /**
+         * @brief
+         * Destroys Components of rows, not trivial types only.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pChunk - Chunk.
+         * @param pFirst - first row.
+         * @param pCount - rows count.
+         * @param pColumns - columns count, from first column.
+         * @throws - no exceptions.
+        **/
+        void DestroyRows( ArchetypeChunk& pChunk, const ecs_uint32_t pFirst, const ecs_uint32_t pCount, const ecs_size_t pColumns ) noexcept;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        Archetype(const Archetype&) = delete;
+        Archetype& operator=(const Archetype&) = delete;
+        Archetype(Archetype&&) = delete;
+        Archetype& operator=(Archetype&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * Archetype constructor.
+         *
+         * @param pIndex - index in Archetypes storage.
+         * @param pSignature - Component types, all must be registered.
+         * @param pAllocator - Chunks allocator (ECS_ARCHETYPE_CHUNK_SIZE blocks).
+         * @param pTick - storage change tick.
+         * @throws - can throw exception.
+        **/
+        explicit Archetype( const ecs_uint32_t pIndex, const ecs_Signature& pSignature, bt_SlabAllocator& pAllocator, const ecs_atomic<ecs_uint32_t>& pTick );
+
+        /**
+         * @brief
+         * Archetype destructor.
+         *
+         * Destroys all Components & releases Chunks.
+         *
+         * @throws - no exceptions.
+        **/
+        ~Archetype() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns index in Archetypes storage.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        ecs_uint32_t getIndex() const noexcept
+        { return mIndex; }
+
+        /**
+         * @brief
+         * Returns Component types set.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        const ecs_Signature& getSignature() const noexcept
+        { return mSignature; }
+
+        /**
+         * @brief
+         * Returns Entities count.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t Count() const noexcept
+        { return mCount; }
+
+        /**
+         * @brief
+         * Returns rows per Chunk.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        ecs_uint32_t getChunkCapacity() const noexcept
+        { return mChunkCapacity; }
+
+        /**
+         * @brief
+         * Returns Chunks count.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t getChunksCount() const noexcept
+        { return mChunks.size(); }
+
+        /**
+         * @brief
+         * Returns Chunk.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pChunk - Chunk index.
+         * @throws - no exceptions.
+        **/
+        const ArchetypeChunk& getChunk( const ecs_size_t pChunk ) const noexcept
+        { return mChunks[pChunk]; }
+
+        /**
+         * @brief
+         * Returns columns count (without Entities column).
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t getColumnsCount() const noexcept
+        { return mTypes.size(); }
+
+        /**
+         * @brief
+         * Returns column type info.
+         *
+         * @thread_safety - not required.
+         * @param pColumn - column index.
+         * @throws - no exceptions.
+        **/
+        const ecs_ComponentTypeInfo& getColumnType( const ecs_size_t pColumn ) const noexcept
+        { return *mTypes[pColumn]; }
+
+        /**
+         * @brief
+         * Returns 'true' if Archetype has Component type, including tags.
+         *
+         * @thread_safety - not required.
+         * @param pType - Type-ID.
+         * @throws - no exceptions.
+        **/
+        bool hasType( const ecs_TypeID pType ) const noexcept
+        { return pType < ECS_MAX_COMPONENT_TYPES && mSignature.Test( pType ); }
+
+        /**
+         * @brief
+         * Returns column index for Type-ID.
+         *
+         * @thread_safety - not required.
+         * @param pType - Type-ID.
+         * @return - column index, or NO_COLUMN (also for tags).
+         * @throws - no exceptions.
+        **/
+        ecs_int16_t getColumnIndex( const ecs_TypeID pType ) const noexcept
+        { return pType < ECS_MAX_COMPONENT_TYPES ? mColumns[pType] : NO_COLUMN; }
+
+        /**
+         * @brief
+         * Returns Entities column of Chunk.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pChunk - Chunk.
+         * @throws - no exceptions.
+        **/
+        ecs_Handle* getEntities( const ArchetypeChunk& pChunk ) const noexcept
+        { return reinterpret_cast<ecs_Handle*>( pChunk.mData ); }
+
+        /**
+         * @brief
+         * Returns Components column of Chunk.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pChunk - Chunk.
+         * @param pColumn - column index.
+         * @throws - no exceptions.
+        **/
+        void* getColumn( const ArchetypeChunk& pChunk, const ecs_size_t pColumn ) const noexcept
+        { return pChunk.mData + mOffsets[pColumn]; }
+
+        /**
+         * @brief
+         * Returns Component.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pRow - Entity location.
+         * @param pColumn - column index.
+         * @throws - no exceptions.
+        **/
+        void* getComponent( const ArchetypeRow& pRow, const ecs_size_t pColumn ) const noexcept
+        { return mChunks[pRow.mChunk].mData + mOffsets[pColumn] + mTypes[pColumn]->mSize * pRow.mRow; }
+
+        /**
+         * @brief
+         * Returns cached Archetype with added Type-ID.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pType - Type-ID.
+         * @return - Archetype, or null if not cached.
+         * @throws - no exceptions.
+        **/
+        Archetype* getAddEdge( const ecs_TypeID pType ) const noexcept;
+
+        /**
+         * @brief
+         * Returns cached Archetype with removed Type-ID.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pType - Type-ID.
+         * @return - Archetype, or null if not cached.
+         * @throws - no exceptions.
+        **/
+        Archetype* getRemoveEdge( const ecs_TypeID pType ) const noexcept;
+
+        /**
+         * @brief
+         * Caches Archetype transitions by Type-ID in both directions.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pType - Type-ID.
+         * @param pWith - Archetype with pType added.
+         * @throws - can throw exception.
+        **/
+        void setEdge( const ecs_TypeID pType, Archetype* const pWith );
+
+        /**
+         * @brief
+         * Returns tick of last change of Chunk column, 0 if never changed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pChunk - Chunk index.
+         * @param pColumn - column index.
+         * @throws - no exceptions.
+        **/
+        ecs_uint32_t getVersion( const ecs_size_t pChunk, const ecs_size_t pColumn ) const noexcept
+        { return mVersions[pChunk * mTypes.size() + pColumn].mVersion; }
+
+        /**
+         * @brief
+         * Returns dirty-rows bitset of Chunk column (rows changed at #getVersion tick).
+         *
+         * @thread_safety - not thread-safe.
+         * @param pChunk - Chunk index.
+         * @param pColumn - column index.
+         * @throws - no exceptions.
+        **/
+        const ecs_uint64_t* getDirtyRows( const ecs_size_t pChunk, const ecs_size_t pColumn ) const noexcept
+        { return mDirtyRows.data() + ( pChunk * mTypes.size() + pColumn ) * mDirtyWords; }
+
+        /**
+         * @brief
+         * Returns 'true' if any row of Chunk column changed after tick.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pChunk - Chunk index.
+         * @param pColumn - column index.
+         * @param pSince - tick.
+         * @throws - no exceptions.
+        **/
+        bool isChanged( const ecs_size_t pChunk, const ecs_size_t pColumn, const ecs_uint32_t pSince ) const noexcept
+        { return getVersion( pChunk, pColumn ) > pSince; }
+
+        /**
+         * @brief
+         * Returns 'true' if row Component changed after tick.
+         * Can report unchanged row, if Chunk column changed before it was tracked per row.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pRow - Entity location.
+         * @param pColumn - column index.
+         * @param pSince - tick.
+         * @throws - no exceptions.
+        **/
+        bool isChanged( const ArchetypeRow& pRow, const ecs_size_t pColumn, const ecs_uint32_t pSince ) const noexcept
+        {
+            const ColumnVersion& version = mVersions[pRow.mChunk * mTypes.size() + pColumn];
+
+            if ( version.mVersion <= pSince )
+                return false;
+
+            if ( version.mPrevVersion > pSince )
+                return true;
+
+            return ( getDirtyRows(pRow.mChunk, pColumn)[pRow.mRow >> 6] >> (pRow.mRow & 63) ) & 1u;
+        }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Appends row for Entity. Components memory is not initialized.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - Entity location.
+         * @throws - std::bad_alloc.
+        **/
+        ArchetypeRow Allocate( const ecs_Handle pEntity );
+
+        /**
+         * @brief
+         * Appends rows for Entities, filling each column with copies of one value.
+         * Rows are filled per Chunk: value is copied once, then copied rows
+         * are doubled with memcpy for trivially copyable types.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntities - Entities Handles.
+         * @param pCount - Entities count.
+         * @param pValues - value per column, null (or null entry) to fill with zeros (trivial types only).
+         * @param pRows - Entities locations (output, pCount elements).
+         * @throws - std::bad_alloc, Components copy exceptions. Archetype is not changed on throw.
+        **/
+        void AllocateBatch( const ecs_Handle* const pEntities, const ecs_size_t pCount, const void* const* const pValues, ArchetypeRow* const pRows );
+
+        /**
+         * @brief
+         * Removes row, last row is moved into its place.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pRow - Entity location.
+         * @param pDestroy - 'true' to destroy Components, 'false' if already moved out.
+         * @return - Handle of Entity moved into pRow, or invalid Handle.
+         * @throws - no exceptions.
+        **/
+        ecs_Handle Remove( const ArchetypeRow& pRow, const bool pDestroy ) noexcept;
+
+        /**
+         * @brief
+         * Moves Entity row to another Archetype.
+         * Shared Components are moved, missing in destination are destroyed,
+         * new in destination are not initialized.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pRow - Entity location.
+         * @param pDst - destination Archetype.
+         * @param pMoved - Handle of Entity moved into pRow, or invalid Handle.
+         * @return - Entity location in pDst.
+         * @throws - std::bad_alloc.
+        **/
+        ArchetypeRow MoveTo( const ArchetypeRow& pRow, Archetype& pDst, ecs_Handle& pMoved );
+
+        /**
+         * @brief
+         * Marks all rows of Chunk column changed at current tick.
+         *
+         * @thread_safety - not thread-safe, one writer per column.
+         * @param pChunk - Chunk index.
+         * @param pColumn - column index.
+         * @throws - no exceptions.
+        **/
+        void MarkChanged( const ecs_size_t pChunk, const ecs_size_t pColumn ) noexcept
+        {
+            ColumnVersion& version = mVersions[pChunk * mTypes.size() + pColumn];
+            version.mVersion = mTick.load( std::memory_order_relaxed );
+            version.mPrevVersion = version.mVersion;
+        }
+
+        /**
+         * @brief
+         * Marks row Component changed at current tick.
+         *
+         * @thread_safety - not thread-safe, one writer per column.
+         * @param pRow - Entity location.
+         * @param pColumn - column index.
+         * @throws - no exceptions.
+        **/
+        void MarkChanged( const ArchetypeRow& pRow, const ecs_size_t pColumn ) noexcept;
+
+        /**
+         * @brief
+         * Destroys all Components & releases Chunks.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Clear() noexcept;
+
+        /**
+         * @brief
+         * Returns 'true' if all Components can be copied with memcpy.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        bool isTrivial() const noexcept;
+
+        /**
+         * @brief
+         * Returns last tick when Chunk rows or Components were changed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pChunk - Chunk index.
+         * @throws - no exceptions.
+        **/
+        ecs_uint32_t getChunkVersion( const ecs_size_t pChunk ) const noexcept;
+
+        /**
+         * @brief
+         * Allocates or releases Chunks at end, so Archetype has given Chunks count.
+         * Released Chunks Components are not destroyed, only for trivial Archetypes.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pCount - Chunks count.
+         * @throws - std::bad_alloc.
+        **/
+        void ResizeChunks( const ecs_size_t pCount );
+
+        /**
+         * @brief
+         * Overwrites Chunk memory & rows count, all columns are marked as changed.
+         * Only for trivial Archetypes, replaced Components are not destroyed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pChunk - Chunk index.
+         * @param pData - Chunk memory copy (ECS_ARCHETYPE_CHUNK_SIZE bytes).
+         * @param pCount - rows count.
+         * @throws - no exceptions.
+        **/
+        void RestoreChunk( const ecs_size_t pChunk, const void* const pData, const ecs_uint32_t pCount ) noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::Archetype
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_ArchetypeChunk = ecs::ArchetypeChunk;
+using ecs_ArchetypeRow = ecs::ArchetypeRow;
+using ecs_Archetype = ecs::Archetype;
+#define ECS_ARCHETYPE_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_ARCHETYPE_HPP
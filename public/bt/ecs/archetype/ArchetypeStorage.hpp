@@ -0,0 +1,749 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#define ECS_ARCHETYPE_STORAGE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::Archetype
+#ifndef ECS_ARCHETYPE_HPP
+#include "Archetype.hpp"
+#endif // !ECS_ARCHETYPE_HPP
+
+// Include ecs::ComponentObservers
+#ifndef ECS_COMPONENT_OBSERVERS_HPP
+#include "ComponentObservers.hpp"
+#endif // !ECS_COMPONENT_OBSERVERS_HPP
+
+// Include ecs::StorageSnapshot
+#ifndef ECS_STORAGE_SNAPSHOT_HPP
+#include "../snapshot/StorageSnapshot.hpp"
+#endif // !ECS_STORAGE_SNAPSHOT_HPP
+
+// Include ecs::memory
+#ifndef ECS_MEMORY_HPP
+#include "../types/ecs_memory.hpp"
+#endif // !ECS_MEMORY_HPP
+
+// Include ecs::atomic
+#ifndef ECS_ATOMIC_HPP
+#include "../types/ecs_atomic.hpp"
+#endif // !ECS_ATOMIC_HPP
+
+// DEBUG
+#if defined( DEBUG ) || defined( BT_DEBUG )
+
+// Include ecs::assert
+#ifndef ECS_ASSERT_HPP
+#include "../types/ecs_assert.hpp"
+#endif // !ECS_ASSERT_HPP
+
+#endif
+// DEBUG
+
+// ===========================================================
+// FORWARD-DECLARATIONS
+// ===========================================================
+
+// Forward-Declare ecs::HierarchyStore
+#ifndef ECS_HIERARCHY_STORE_DECL
+#define ECS_HIERARCHY_STORE_DECL
+namespace ecs { class HierarchyStore; }
+using ecs_HierarchyStore = ecs::HierarchyStore;
+#endif // !ECS_HIERARCHY_STORE_DECL
+
+// Forward-Declare ecs::EntityRegistry
+#ifndef ECS_ENTITY_REGISTRY_DECL
+#define ECS_ENTITY_REGISTRY_DECL
+namespace ecs { class EntityRegistry; }
+using ecs_EntityRegistry = ecs::EntityRegistry;
+#endif // !ECS_ENTITY_REGISTRY_DECL
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Address range (bytes) reserved for Chunks, physical memory committed on demand. **/
+#ifndef ECS_ARCHETYPE_RESERVE_SIZE
+#define ECS_ARCHETYPE_RESERVE_SIZE ( (sizeof(void*) > 4 ? ecs_size_t(4096) : ecs_size_t(256)) * 1024 * 1024 )
+#endif // !ECS_ARCHETYPE_RESERVE_SIZE
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * ArchetypeStorage - Entities & Components, grouped by Archetypes.
+     *
+     * Adding or removing Component moves Entity to another Archetype,
+     * transitions are cached, so Archetypes lookup by Signature happens once.
+     *
+     * Changes of observed Component types are recorded (see ecs::ComponentObservers)
+     * & reported in batches by #NotifyObservers, batch operations notify on return.
+     *
+     * @thread_safety - not thread-safe, structural changes must be synchronized.
+     * @version 0.1
+    **/
+    class ECS_API ArchetypeStorage final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Entity location.
+        **/
+        struct EntityLocation final
+        {
+            /** Archetype, null if slot released. **/
+            ecs_Archetype* mArchetype;
+
+            /** Row in Archetype. **/
+            ecs_ArchetypeRow mRow;
+        };
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** End of free-slots list. **/
+        static constexpr const ecs_uint32_t NO_SLOT = ecs_Handle::INDEX_MASK;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Chunks allocator. **/
+        bt_SlabAllocator mChunkAllocator;
+
+        /** Change tick, Components changes are versioned by it. **/
+        ecs_atomic<ecs_uint32_t> mTick;
+
+        /** Archetypes. **/
+        ecs_vec<ecs_sptr<ecs_Archetype>> mArchetypes;
+
+        /** Archetypes by Signature. **/
+        ecs_map<ecs_Signature, ecs_Archetype*> mSignatures;
+
+        /** Archetype without Components. **/
+        ecs_Archetype* mRoot;
+
+        /** Entities locations, indexed by Handle index. **/
+        ecs_vec<EntityLocation> mLocations;
+
+        /** Entities generations, indexed by Handle index. **/
+        ecs_vec<ecs_uint8_t> mGenerations;
+
+        /** Released slots. **/
+        ecs_vec<ecs_uint32_t> mFreeSlots;
+
+        /** Alive Entities count. **/
+        ecs_size_t mCount;
+
+        /** Handles reserved after last slot, see #Reserve. **/
+        ecs_atomic<ecs_uint32_t> mReserved;
+
+        /** Components lifecycle observers. **/
+        ecs_ComponentObservers mObservers;
+
+        /** Parent-child relations, destroyed Entities are removed from it. Can be null. **/
+        ecs_sptr<ecs_HierarchyStore> mHierarchy;
+
+        /** Registry of handle-only Entities, captured & restored with storage. Can be null. **/
+        ecs_EntityRegistry* mRegistry;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns Archetype with added or removed Type-ID.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pSrc - source Archetype.
+         * @param pType - Type-ID.
+         * @param pAdd - 'true' to add, 'false' to remove.
+         * @throws - can throw exception.
+        **/
+        ecs_Archetype* getEdge( ecs_Archetype* const pSrc, const ecs_TypeID pType, const bool pAdd );
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Moves Entity to another Archetype & updates locations.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pLocation - Entity location.
+         * @param pDst - destination Archetype.
+         * @throws - std::bad_alloc.
+        **/
+        void Move( EntityLocation& pLocation, ecs_Archetype* const pDst );
+
+        /**
+         * @brief
+         * Allocates slots for Entities & fills Archetype rows.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pArchetype - Archetype.
+         * @param pCount - Entities count.
+         * @param pValues - value per column, or null.
+         * @param pEntities - Entities Handles (output, pCount elements).
+         * @throws - std::bad_alloc.
+        **/
+        void SpawnInto( ecs_Archetype* const pArchetype, const ecs_size_t pCount, const void* const* const pValues, ecs_Handle* const pEntities );
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        ArchetypeStorage(const ArchetypeStorage&) = delete;
+        ArchetypeStorage& operator=(const ArchetypeStorage&) = delete;
+        ArchetypeStorage(ArchetypeStorage&&) = delete;
+        ArchetypeStorage& operator=(ArchetypeStorage&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * ArchetypeStorage constructor.
+         *
+         * @param pReserve - address range (bytes) to reserve for Chunks.
+         * @throws - std::bad_alloc.
+        **/
+        explicit ArchetypeStorage( const ecs_size_t pReserve = ECS_ARCHETYPE_RESERVE_SIZE );
+
+        /**
+         * @brief
+         * ArchetypeStorage destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~ArchetypeStorage() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns alive Entities count.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t Count() const noexcept
+        { return mCount; }
+
+        /**
+         * @brief
+         * Returns Archetypes count.
+         * Archetypes are never removed, so new ones are appended.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t getArchetypesCount() const noexcept
+        { return mArchetypes.size(); }
+
+        /**
+         * @brief
+         * Returns Archetype.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pIndex - Archetype index.
+         * @throws - no exceptions.
+        **/
+        ecs_Archetype* getArchetype( const ecs_size_t pIndex ) const noexcept
+        { return mArchetypes[pIndex].get(); }
+
+        /**
+         * @brief
+         * Returns Archetype for Signature, creates it if not exists.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pSignature - Component types.
+         * @throws - can throw exception.
+        **/
+        ecs_Archetype* getArchetype( const ecs_Signature& pSignature );
+
+        /**
+         * @brief
+         * Returns 'true' if Entity Handle is alive.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @throws - no exceptions.
+        **/
+        bool isAlive( const ecs_Handle pEntity ) const noexcept
+        {
+            const ecs_uint32_t slot = pEntity.getIndex();
+            return slot < mGenerations.size() && mGenerations[slot] == pEntity.getGeneration() && mLocations[slot].mArchetype != nullptr;
+        }
+
+        /**
+         * @brief
+         * Returns Entity Archetype.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - Archetype, or null if Handle is stale.
+         * @throws - no exceptions.
+        **/
+        ecs_Archetype* getArchetypeOf( const ecs_Handle pEntity ) const noexcept
+        { return isAlive( pEntity ) ? mLocations[pEntity.getIndex()].mArchetype : nullptr; }
+
+        /**
+         * @brief
+         * Returns current change tick.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @throws - no exceptions.
+        **/
+        ecs_uint32_t getTick() const noexcept
+        { return mTick.load( std::memory_order_relaxed ); }
+
+        /**
+         * @brief
+         * Returns Components lifecycle observers.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_ComponentObservers& getObservers() noexcept
+        { return mObservers; }
+
+        /**
+         * @brief
+         * Returns parent-child relations of Entities.
+         *
+         * @thread_safety - not thread-safe.
+         * @return - hierarchy, or null if not set.
+         * @throws - no exceptions.
+        **/
+        const ecs_sptr<ecs_HierarchyStore>& getHierarchy() const noexcept
+        { return mHierarchy; }
+
+        /**
+         * @brief
+         * Sets parent-child relations of Entities, destroyed Entities are removed from it.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pHierarchy - hierarchy, or null.
+         * @throws - no exceptions.
+        **/
+        void setHierarchy( const ecs_sptr<ecs_HierarchyStore>& pHierarchy ) noexcept
+        { mHierarchy = pHierarchy; }
+
+        /**
+         * @brief
+         * Returns registry of handle-only Entities.
+         *
+         * @thread_safety - not thread-safe.
+         * @return - registry, or null if not set.
+         * @throws - no exceptions.
+        **/
+        ecs_EntityRegistry* getRegistry() const noexcept
+        { return mRegistry; }
+
+        /**
+         * @brief
+         * Sets registry of handle-only Entities, called by ecs::EntityRegistry.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pRegistry - registry, must outlive storage or be reset, or null.
+         * @throws - no exceptions.
+        **/
+        void setRegistry( ecs_EntityRegistry* const pRegistry ) noexcept
+        { mRegistry = pRegistry; }
+
+        /**
+         * @brief
+         * Returns Entity row in its Archetype.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - alive Entity Handle.
+         * @throws - no exceptions.
+        **/
+        const ecs_ArchetypeRow& getRowOf( const ecs_Handle pEntity ) const noexcept
+        { return mLocations[pEntity.getIndex()].mRow; }
+
+        /**
+         * @brief
+         * Returns 'true' if Entity has Component or tag.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @param pType - Component Type-ID.
+         * @throws - no exceptions.
+        **/
+        bool hasComponent( const ecs_Handle pEntity, const ecs_TypeID pType ) const noexcept
+        { return isAlive( pEntity ) && mLocations[pEntity.getIndex()].mArchetype->hasType( pType ); }
+
+        /**
+         * @brief
+         * Returns 'true' if Entity has Component or tag.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @throws - std::out_of_range, if Component Type-IDs exhausted (see ecs::ComponentType::getID).
+        **/
+        template <typename T>
+        bool hasComponent( const ecs_Handle pEntity ) const
+        { return hasComponent( pEntity, ecs_ComponentType<T>::getID() ); }
+
+        /**
+         * @brief
+         * Returns Component memory.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @param pType - Component Type-ID.
+         * @return - Component, or null if not attached or tag.
+         * @throws - no exceptions.
+        **/
+        void* getComponent( const ecs_Handle pEntity, const ecs_TypeID pType ) const noexcept;
+
+        /**
+         * @brief
+         * Returns Component.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - Component, or null if not attached.
+         * @throws - std::out_of_range, if Component Type-IDs exhausted (see ecs::ComponentType::getID).
+        **/
+        template <typename T>
+        T* getComponent( const ecs_Handle pEntity ) const
+        { return static_cast<T*>( getComponent(pEntity, ecs_ComponentType<T>::getID()) ); }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Creates Entity without Components.
+         *
+         * @thread_safety - not thread-safe.
+         * @return - Entity Handle.
+         * @throws - std::bad_alloc.
+        **/
+        ecs_Handle Create();
+
+        /**
+         * @brief
+         * Reserves Handle for Entity, created by #FlushReserved.
+         * Used to create Entities while storage is read by other threads.
+         *
+         * @thread_safety - thread-safe (atomic), if no structural changes at the same time.
+         * @return - Entity Handle, not alive until #FlushReserved.
+         * @throws - no exceptions.
+        **/
+        ecs_Handle Reserve() noexcept;
+
+        /**
+         * @brief
+         * Creates Entities without Components for reserved Handles.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - std::bad_alloc.
+        **/
+        void FlushReserved();
+
+        /**
+         * @brief
+         * Destroys Entity & its Components.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - 'false' if Handle is stale.
+         * @throws - std::bad_alloc, if OnRemove observed.
+        **/
+        bool Destroy( const ecs_Handle pEntity );
+
+        /**
+         * @brief
+         * Creates Entities copying Components of prefab Entity.
+         * Slots & Chunks rows are allocated at once, columns are filled per Chunk.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pPrefab - prefab Entity Handle.
+         * @param pCount - Entities count.
+         * @param pEntities - Entities Handles (output, pCount elements).
+         * @return - 'false' if prefab Handle is stale or prefab has not copyable Component.
+         * @throws - std::bad_alloc, or exception from Component copy-constructor.
+        **/
+        bool spawnBatch( const ecs_Handle pPrefab, const ecs_size_t pCount, ecs_Handle* const pEntities );
+
+        /**
+         * @brief
+         * Creates Entities with zero-filled Components.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pSignature - Components types.
+         * @param pCount - Entities count.
+         * @param pEntities - Entities Handles (output, pCount elements).
+         * @return - 'false' if Signature has not trivially copyable Component.
+         * @throws - std::bad_alloc.
+        **/
+        bool spawnBatch( const ecs_Signature& pSignature, const ecs_size_t pCount, ecs_Handle* const pEntities );
+
+        /**
+         * @brief
+         * Destroys Entities & their Components.
+         * Rows are removed from last to first, so removed rows are not moved by swap-remove.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntities - Entities Handles.
+         * @param pCount - Entities count.
+         * @return - destroyed Entities count, stale Handles are skipped.
+         * @throws - std::bad_alloc.
+        **/
+        ecs_size_t destroyBatch( const ecs_Handle* const pEntities, const ecs_size_t pCount );
+
+        /**
+         * @brief
+         * Moves constructed Component to Entity & returns Component memory.
+         * If Component already attached, it is replaced.
+         * Storage & observers are changed only after Component is constructed, so throwing constructor leaves Entity as is.
+         *
+         * (?) Value of registered type is always consumed: moved to column (source destroyed), or destroyed if not attached.
+         * (?) For tags only Archetype changes, returned memory is shared placeholder.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @param pType - Component Type-ID, from ecs::ComponentType.
+         * @param pValue - constructed Component, or null for tag.
+         * @return - Component memory, or null if Handle is stale or Type-ID not registered.
+         * @throws - std::bad_alloc, Entity is not changed.
+        **/
+        void* Attach( const ecs_Handle pEntity, const ecs_TypeID pType, void* const pValue );
+
+        /**
+         * @brief
+         * Destroys Component & moves Entity to Archetype without it.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @param pType - Component Type-ID.
+         * @return - 'false' if Handle is stale or Component not attached.
+         * @throws - std::bad_alloc.
+        **/
+        bool Detach( const ecs_Handle pEntity, const ecs_TypeID pType );
+
+        /**
+         * @brief
+         * Attaches Component to Entity.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @param pArgs - Component constructor arguments.
+         * @return - Component, or null if Handle is stale.
+         * @throws - can throw exception.
+        **/
+        template <typename T, typename... _Types>
+        T* addComponent( const ecs_Handle pEntity, _Types&&... pArgs )
+        {
+            // Constructed before Attach, so throwing constructor leaves Entity & attached Component untouched.
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type value;
+            new( &value ) T( std::forward<_Types>(pArgs)... );
+
+            return static_cast<T*>( Attach(pEntity, ecs_ComponentType<T>::getID(), &value) );
+        }
+
+        /**
+         * @brief
+         * Attaches tag to Entity. Tag takes no memory, Entity moves to Archetype with tag bit.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - 'false' if Handle is stale.
+         * @throws - std::bad_alloc.
+        **/
+        template <typename T>
+        bool addTag( const ecs_Handle pEntity )
+        {
+            static_assert( ecs_ComponentType<T>::isTag(), "ArchetypeStorage::addTag - type is not empty." );
+            return Attach( pEntity, ecs_ComponentType<T>::getID(), nullptr ) != nullptr;
+        }
+
+        /**
+         * @brief
+         * Detaches Component (or tag) from Entity.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - 'false' if Handle is stale or Component not attached.
+         * @throws - can throw exception.
+        **/
+        template <typename T>
+        bool removeComponent( const ecs_Handle pEntity )
+        { return Detach( pEntity, ecs_ComponentType<T>::getID() ); }
+
+        /**
+         * @brief
+         * Advances change tick. Changes made after call are newer than returned tick.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @return - previous tick.
+         * @throws - no exceptions.
+        **/
+        ecs_uint32_t AdvanceTick() noexcept
+        { return mTick.fetch_add( 1, std::memory_order_relaxed ); }
+
+        /**
+         * @brief
+         * Marks Entity Component changed at current tick.
+         * Required after writes through #getComponent.
+         *
+         * @thread_safety - not thread-safe, one writer per Component type.
+         * @param pEntity - Entity Handle.
+         * @param pType - Component Type-ID.
+         * @return - 'false' if Handle is stale or Component not attached.
+         * @throws - std::bad_alloc, if OnSet observed.
+        **/
+        bool MarkChanged( const ecs_Handle pEntity, const ecs_TypeID pType );
+
+        template <typename T>
+        bool MarkChanged( const ecs_Handle pEntity )
+        { return MarkChanged( pEntity, ecs_ComponentType<T>::getID() ); }
+
+        /**
+         * @brief
+         * Invokes Components observers for changes, recorded since last call.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - can throw exception from observer.
+        **/
+        void NotifyObservers()
+        { mObservers.Notify( *this ); }
+
+        /**
+         * @brief
+         * Copies storage state to snapshot & advances change tick.
+         * Hierarchy & registry (if set) are captured too.
+         * Chunks not changed since previous snapshot share its pages,
+         * so Components writes must be marked (ecs::Write, #MarkChanged).
+         *
+         * @thread_safety - not thread-safe.
+         * @param pDst - snapshot to overwrite, not pPrev.
+         * @param pPrev - previous snapshot of this storage, or null.
+         * @return - 'false' if some Entity has not trivially copyable Component.
+         * @throws - std::bad_alloc.
+        **/
+        bool Capture( ecs_StorageSnapshot& pDst, const ecs_StorageSnapshot* const pPrev );
+
+        /**
+         * @brief
+         * Restores storage state from snapshot, with hierarchy & registry (if set).
+         * Handles created after snapshot become stale, reserved Handles are discarded.
+         * Restored Components are marked changed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pSrc - snapshot of this storage.
+         * @throws - std::bad_alloc.
+        **/
+        void Restore( const ecs_StorageSnapshot& pSrc );
+
+        /**
+         * @brief
+         * Returns memory of released Chunks to OS.
+         * Released Chunks are kept for reuse otherwise, call at load points, not per frame.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Trim() noexcept
+        { mChunkAllocator.Trim(); }
+
+        /**
+         * @brief
+         * Destroys all Entities & Components. Archetypes are kept, Chunks memory is returned to OS.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Clear() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::ArchetypeStorage
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_ArchetypeStorage = ecs::ArchetypeStorage;
+#define ECS_ARCHETYPE_STORAGE_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
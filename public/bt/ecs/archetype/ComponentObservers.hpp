@@ -0,0 +1,452 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_COMPONENT_OBSERVERS_HPP
+#define ECS_COMPONENT_OBSERVERS_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::Signature
+#ifndef ECS_SIGNATURE_HPP
+#include "Signature.hpp"
+#endif // !ECS_SIGNATURE_HPP
+
+// Include ecs::handle
+#ifndef ECS_HANDLE_HPP
+#include "../types/ecs_handle.hpp"
+#endif // !ECS_HANDLE_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// Include ecs::ComponentType
+#ifndef ECS_COMPONENT_TYPE_HPP
+#include "../component/ComponentType.hpp"
+#endif // !ECS_COMPONENT_TYPE_HPP
+
+// ===========================================================
+// FORWARD-DECLARATIONS
+// ===========================================================
+
+// Forward-Declare ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_DECL
+#define ECS_ARCHETYPE_STORAGE_DECL
+namespace ecs { class ArchetypeStorage; }
+using ecs_ArchetypeStorage = ecs::ArchetypeStorage;
+#endif // !ECS_ARCHETYPE_STORAGE_DECL
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EObserverEvents - Component lifecycle events.
+     *
+     * @version 0.1
+    **/
+    BT_ENUM_TYPE ECS_API EObserverEvents : ecs_uint8_t
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_ENUM
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Component (or tag) attached. **/
+        OnAdd = 0,
+        /** Component (or tag) detached, or Entity destroyed. **/
+        OnRemove = 1,
+        /** Attached Component replaced, or marked changed by ecs::ArchetypeStorage::MarkChanged. **/
+        OnSet = 2
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::EObserverEvents
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * ComponentObservers - per Component type hooks for lifecycle events.
+     *
+     * Storage records events of observed types only (one bit test otherwise),
+     * observers are invoked by #Notify once per run of same event,
+     * with contiguous array of Entities Handles, in order of recording.
+     *
+     * (?) Observers are called after changes: OnRemove Handles can be destroyed,
+     * Entity can be changed again before #Notify, check storage state if needed.
+     * (?) Events recorded by observers are reported on next #Notify.
+     *
+     * @thread_safety - not thread-safe, owned by ecs::ArchetypeStorage.
+     * @version 0.1
+    **/
+    class ECS_API ComponentObservers final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Events count. **/
+        static constexpr const ecs_size_t EVENTS = 3;
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * Observer function.
+         * pStorage - storage, pEntities - Entities Handles, pCount - Handles count, pUser - user data.
+        **/
+        using observer_fn = void(*)( ecs_ArchetypeStorage& pStorage, const ecs_Handle* const pEntities, const ecs_size_t pCount, void* const pUser );
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Registered observer.
+        **/
+        struct Observer final
+        {
+            /** Function. **/
+            observer_fn mFunction;
+
+            /** User data. **/
+            void* mUser;
+        };
+
+        /**
+         * @brief
+         * Run of same event in recorded Handles.
+        **/
+        struct Run final
+        {
+            /** Event. **/
+            EObserverEvents mEvent;
+
+            /** End of run in Handles. **/
+            ecs_uint32_t mEnd;
+        };
+
+        /**
+         * @brief
+         * Observers & recorded events of Component type.
+        **/
+        struct TypeObservers final
+        {
+            /** Observers per event. **/
+            ecs_vec<Observer> mObservers[EVENTS];
+
+            /** Recorded Handles. **/
+            ecs_vec<ecs_Handle> mHandles;
+
+            /** Recorded runs. **/
+            ecs_vec<Run> mRuns;
+        };
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Observed types per event. **/
+        ecs_Signature mObserved[EVENTS];
+
+        /** Observers & recorded events, indexed by Type-ID. **/
+        ecs_vec<TypeObservers> mTypes;
+
+        /** Types with recorded events. **/
+        ecs_vec<ecs_TypeID> mPending;
+
+        /** #Notify scratch: pending types. **/
+        ecs_vec<ecs_TypeID> mNotifyTypes;
+
+        /** #Notify scratch: Handles. **/
+        ecs_vec<ecs_Handle> mNotifyHandles;
+
+        /** #Notify scratch: runs. **/
+        ecs_vec<Run> mNotifyRuns;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Appends Handles to type records.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEvent - event.
+         * @param pType - observed Type-ID.
+         * @param pEntities - Entities Handles.
+         * @param pCount - Handles count.
+         * @throws - std::bad_alloc.
+        **/
+        void Append( const EObserverEvents pEvent, const ecs_TypeID pType, const ecs_Handle* const pEntities, const ecs_size_t pCount );
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        ComponentObservers(const ComponentObservers&) = delete;
+        ComponentObservers& operator=(const ComponentObservers&) = delete;
+        ComponentObservers(ComponentObservers&&) = delete;
+        ComponentObservers& operator=(ComponentObservers&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * ComponentObservers constructor.
+         *
+         * @throws - no exceptions.
+        **/
+        explicit ComponentObservers() noexcept;
+
+        /**
+         * @brief
+         * ComponentObservers destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~ComponentObservers() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns 'true' if event of Component type is observed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEvent - event.
+         * @param pType - Type-ID.
+         * @throws - no exceptions.
+        **/
+        bool isObserved( const EObserverEvents pEvent, const ecs_TypeID pType ) const noexcept
+        { return pType < ECS_MAX_COMPONENT_TYPES && mObserved[static_cast<ecs_size_t>(pEvent)].Test( pType ); }
+
+        /**
+         * @brief
+         * Returns 'true' if any type of Signature is observed for event.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEvent - event.
+         * @param pSignature - Component types.
+         * @throws - no exceptions.
+        **/
+        bool isObserved( const EObserverEvents pEvent, const ecs_Signature& pSignature ) const noexcept
+        { return mObserved[static_cast<ecs_size_t>(pEvent)].Intersects( pSignature ); }
+
+        /**
+         * @brief
+         * Returns 'true' if events recorded & not notified yet.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        bool hasPending() const noexcept
+        { return !mPending.empty(); }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Registers observer for Component type event.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEvent - event.
+         * @param pType - Component Type-ID.
+         * @param pFunction - observer function.
+         * @param pUser - user data, passed to function.
+         * @throws - std::bad_alloc.
+        **/
+        void Subscribe( const EObserverEvents pEvent, const ecs_TypeID pType, const observer_fn pFunction, void* const pUser = nullptr );
+
+        /**
+         * @brief
+         * Registers observer for Component type event.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEvent - event.
+         * @param pFunction - observer function.
+         * @param pUser - user data, passed to function.
+         * @throws - std::bad_alloc.
+        **/
+        template <typename T>
+        void Subscribe( const EObserverEvents pEvent, const observer_fn pFunction, void* const pUser = nullptr )
+        { Subscribe( pEvent, ecs_ComponentType<T>::getID(), pFunction, pUser ); }
+
+        /**
+         * @brief
+         * Removes observer, registered with same function & user data.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEvent - event.
+         * @param pType - Component Type-ID.
+         * @param pFunction - observer function.
+         * @param pUser - user data.
+         * @throws - no exceptions.
+        **/
+        void Unsubscribe( const EObserverEvents pEvent, const ecs_TypeID pType, const observer_fn pFunction, void* const pUser = nullptr ) noexcept;
+
+        /**
+         * @brief
+         * Records event for Entity, if Component type is observed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEvent - event.
+         * @param pType - Component Type-ID.
+         * @param pEntity - Entity Handle.
+         * @throws - std::bad_alloc.
+        **/
+        void Record( const EObserverEvents pEvent, const ecs_TypeID pType, const ecs_Handle pEntity )
+        {
+            if ( isObserved(pEvent, pType) )
+                Append( pEvent, pType, &pEntity, 1 );
+        }
+
+        /**
+         * @brief
+         * Records event for Entities, if Component type is observed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEvent - event.
+         * @param pType - Component Type-ID.
+         * @param pEntities - Entities Handles.
+         * @param pCount - Handles count.
+         * @throws - std::bad_alloc.
+        **/
+        void Record( const EObserverEvents pEvent, const ecs_TypeID pType, const ecs_Handle* const pEntities, const ecs_size_t pCount )
+        {
+            if ( pCount > 0 && isObserved(pEvent, pType) )
+                Append( pEvent, pType, pEntities, pCount );
+        }
+
+        /**
+         * @brief
+         * Records event for Entities for each observed type of Signature.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEvent - event.
+         * @param pSignature - Component types.
+         * @param pEntities - Entities Handles.
+         * @param pCount - Handles count.
+         * @throws - std::bad_alloc.
+        **/
+        void Record( const EObserverEvents pEvent, const ecs_Signature& pSignature, const ecs_Handle* const pEntities, const ecs_size_t pCount );
+
+        /**
+         * @brief
+         * Invokes observers for recorded events & clears records.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pStorage - storage, passed to observers.
+         * @throws - can throw exception from observer, records of its type are dropped, other types are kept.
+        **/
+        void Notify( ecs_ArchetypeStorage& pStorage );
+
+        /**
+         * @brief
+         * Drops recorded events, observers are kept.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Clear() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::ComponentObservers
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_EObserverEvents = ecs::EObserverEvents;
+using ecs_ComponentObservers = ecs::ComponentObservers;
+#define ECS_COMPONENT_OBSERVERS_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_COMPONENT_OBSERVERS_HPP
@@ -0,0 +1,275 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_SIGNATURE_HPP
+#define ECS_SIGNATURE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::ComponentType
+#ifndef ECS_COMPONENT_TYPE_HPP
+#include "../component/ComponentType.hpp"
+#endif // !ECS_COMPONENT_TYPE_HPP
+
+// Include C++ cstdint
+#include <cstdint>
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * Signature - set of Component Type-IDs, one bit per type.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API Signature final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_STRUCT
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        using word_t = std::uint64_t;
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        static constexpr const ecs_size_t WORD_BITS = 64;
+        static constexpr const ecs_size_t WORDS = (ECS_MAX_COMPONENT_TYPES + WORD_BITS - 1) / WORD_BITS;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Bits. **/
+        word_t mWords[WORDS];
+
+        // ===========================================================
+        // CONSTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * Signature constructor.
+         *
+         * @throws - no exceptions.
+        **/
+        Signature() noexcept
+            : mWords{ 0 }
+        {
+        }
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns 'true' if Type-ID is in this set.
+         *
+         * @param pType - Type-ID.
+         * @return - 'false' if Type-ID is out of range.
+         * @throws - no exceptions.
+        **/
+        bool Test( const ecs_TypeID pType ) const noexcept
+        { return pType < ECS_MAX_COMPONENT_TYPES && (mWords[pType / WORD_BITS] & (word_t(1) << (pType % WORD_BITS))) != 0; }
+
+        /**
+         * @brief
+         * Returns 'true' if all bits of pOther are set in this set.
+         *
+         * @param pOther - Signature.
+         * @throws - no exceptions.
+        **/
+        bool Contains( const Signature& pOther ) const noexcept
+        {
+            for ( ecs_size_t i = 0; i < WORDS; i++ )
+            {
+                if ( (mWords[i] & pOther.mWords[i]) != pOther.mWords[i] )
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief
+         * Returns 'true' if any bit of pOther is set in this set.
+         *
+         * @param pOther - Signature.
+         * @throws - no exceptions.
+        **/
+        bool Intersects( const Signature& pOther ) const noexcept
+        {
+            for ( ecs_size_t i = 0; i < WORDS; i++ )
+            {
+                if ( (mWords[i] & pOther.mWords[i]) != 0 )
+                    return true;
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief
+         * Returns 'true' if no bits set.
+         *
+         * @throws - no exceptions.
+        **/
+        bool isEmpty() const noexcept
+        {
+            for ( ecs_size_t i = 0; i < WORDS; i++ )
+            {
+                if ( mWords[i] != 0 )
+                    return false;
+            }
+
+            return true;
+        }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Adds Type-ID to this set.
+         *
+         * @param pType - Type-ID.
+         * @return - 'false' if Type-ID is out of range, set is not changed.
+         * @throws - no exceptions.
+        **/
+        bool Set( const ecs_TypeID pType ) noexcept
+        {
+            if ( pType >= ECS_MAX_COMPONENT_TYPES )
+                return false;
+
+            mWords[pType / WORD_BITS] |= word_t(1) << (pType % WORD_BITS);
+
+            return true;
+        }
+
+        /**
+         * @brief
+         * Removes Type-ID from this set.
+         *
+         * @param pType - Type-ID.
+         * @throws - no exceptions.
+        **/
+        void Reset( const ecs_TypeID pType ) noexcept
+        {
+            if ( pType < ECS_MAX_COMPONENT_TYPES )
+                mWords[pType / WORD_BITS] &= ~(word_t(1) << (pType % WORD_BITS));
+        }
+
+        /**
+         * @brief
+         * Calls function for each Type-ID in this set, in ascending order.
+         *
+         * @param pFunc - callable with (ecs_TypeID) signature.
+         * @throws - can throw exception.
+        **/
+        template <typename F>
+        void forEach( F&& pFunc ) const
+        {
+            for ( ecs_size_t i = 0; i < WORDS; i++ )
+            {
+                if ( mWords[i] == 0 )
+                    continue;
+
+                for ( ecs_size_t bit = 0; bit < WORD_BITS; bit++ )
+                {
+                    if ( (mWords[i] & (word_t(1) << bit)) != 0 )
+                        pFunc( static_cast<ecs_TypeID>(i * WORD_BITS + bit) );
+                }
+            }
+        }
+
+        bool operator==( const Signature& pOther ) const noexcept
+        {
+            for ( ecs_size_t i = 0; i < WORDS; i++ )
+            {
+                if ( mWords[i] != pOther.mWords[i] )
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool operator!=( const Signature& pOther ) const noexcept
+        { return !(*this == pOther); }
+
+        bool operator<( const Signature& pOther ) const noexcept
+        {
+            for ( ecs_size_t i = 0; i < WORDS; i++ )
+            {
+                if ( mWords[i] != pOther.mWords[i] )
+                    return mWords[i] < pOther.mWords[i];
+            }
+
+            return false;
+        }
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::Signature
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_Signature = ecs::Signature;
+#define ECS_SIGNATURE_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_SIGNATURE_HPP
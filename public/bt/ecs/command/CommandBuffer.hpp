@@ -0,0 +1,509 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_COMMAND_BUFFER_HPP
+#define ECS_COMMAND_BUFFER_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include ecs::memory
+#ifndef ECS_MEMORY_HPP
+#include "../types/ecs_memory.hpp"
+#endif // !ECS_MEMORY_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// ===========================================================
+// FORWARD-DECLARATIONS
+// ===========================================================
+
+// Forward-Declare ecs::Component
+#ifndef ECS_COMPONENT_DECL
+#define ECS_COMPONENT_DECL
+namespace ecs { struct Component; }
+using ecs_Component = ecs::Component;
+#endif // !ECS_COMPONENT_DECL
+
+// Forward-Declare ecs::IEntity
+#ifndef ECS_I_ENTITY_DECL
+#define ECS_I_ENTITY_DECL
+namespace ecs { class IEntity; }
+using ecs_IEntity = ecs::IEntity;
+#endif // !ECS_I_ENTITY_DECL
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Components payload block size (bytes). **/
+#ifndef ECS_COMMAND_BLOCK_SIZE
+#define ECS_COMMAND_BLOCK_SIZE 16384
+#endif // !ECS_COMMAND_BLOCK_SIZE
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * ECommandTypes - deferred structural changes.
+     *
+     * @version 0.1
+    **/
+    BT_ENUM_TYPE ECS_API ECommandTypes : ecs_uint8_t
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_ENUM
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Destroy Entity, see ecs::ArchetypeStorage::Destroy. **/
+        Destroy = 0,
+        /** Attach Component, see ecs::ArchetypeStorage::Attach. **/
+        Attach = 1,
+        /** Detach Component, see ecs::ArchetypeStorage::Detach. **/
+        Detach = 2,
+        /** ecs::IEntity::attachComponent. **/
+        AttachComponent = 3,
+        /** ecs::IEntity::detachComponent. **/
+        DetachComponent = 4,
+        /** ecs::EntitiesManager::registerEntity. **/
+        RegisterEntity = 5,
+        /** ecs::IEntity::Destroy. **/
+        DestroyEntity = 6
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::ECommandTypes
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * CommandBuffer - records structural changes, applied later by ecs::CommandQueue.
+     *
+     * (?) Used by one thread, while storage is iterated by others.
+     * (?) Components are constructed immediately & moved into storage when applied.
+     *
+     * @thread_safety - not thread-safe, one buffer per thread.
+     * @version 0.1
+    **/
+    class ECS_API CommandBuffer final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Storage command.
+        **/
+        struct Command final
+        {
+            /** Command type. **/
+            ECommandTypes mCommand;
+
+            /** Component Type-ID. **/
+            ecs_TypeID mType;
+
+            /** Entity. **/
+            ecs_Handle mEntity;
+
+            /** Constructed Component, for ECommandTypes::Attach. Null, when consumed. **/
+            void* mData;
+        };
+
+        /**
+         * @brief
+         * Legacy Entities command.
+        **/
+        struct EntityCommand final
+        {
+            /** Command type. **/
+            ECommandTypes mCommand;
+
+            /** Entity. **/
+            ecs_sptr<ecs_IEntity> mEntity;
+
+            /** Component, for ECommandTypes::AttachComponent. **/
+            ecs_sptr<ecs_Component> mComponent;
+
+            /** Component Type-ID, for ECommandTypes::DetachComponent. **/
+            ecs_TypeID mType;
+
+            /** Component ID, for ECommandTypes::DetachComponent. **/
+            ecs_ObjectID mID;
+        };
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Components payload block.
+        **/
+        struct Block final
+        {
+            /** Memory. **/
+            ecs_uptr<unsigned char[]> mMemory;
+
+            /** Size (bytes). **/
+            ecs_size_t mSize;
+        };
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Storage. **/
+        ecs_ArchetypeStorage& mStorage;
+
+        /** Storage commands. **/
+        ecs_vec<Command> mCommands;
+
+        /** Legacy Entities commands. **/
+        ecs_vec<EntityCommand> mEntityCommands;
+
+        /** Payload blocks, kept between frames. **/
+        ecs_vec<Block> mBlocks;
+
+        /** Current block. **/
+        ecs_size_t mBlock;
+
+        /** Offset in current block (bytes). **/
+        ecs_size_t mOffset;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Allocates Component memory. Memory is never moved until #Reset.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pSize - size (bytes).
+         * @param pAlign - alignment (bytes).
+         * @throws - std::bad_alloc.
+        **/
+        void* Allocate( const ecs_size_t pSize, const ecs_size_t pAlign );
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+        CommandBuffer(CommandBuffer&&) = delete;
+        CommandBuffer& operator=(CommandBuffer&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * CommandBuffer constructor.
+         *
+         * @param pStorage - storage to apply commands to.
+         * @throws - no exceptions.
+        **/
+        explicit CommandBuffer( ecs_ArchetypeStorage& pStorage ) noexcept;
+
+        /**
+         * @brief
+         * CommandBuffer destructor.
+         * Destroys not applied Components.
+         *
+         * @throws - no exceptions.
+        **/
+        ~CommandBuffer() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns 'true' if no commands recorded.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        bool isEmpty() const noexcept
+        { return mCommands.empty() && mEntityCommands.empty(); }
+
+        /**
+         * @brief
+         * Returns storage commands.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        const ecs_vec<Command>& getCommands() const noexcept
+        { return mCommands; }
+
+        /**
+         * @brief
+         * Returns legacy Entities commands.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        const ecs_vec<EntityCommand>& getEntityCommands() const noexcept
+        { return mEntityCommands; }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Reserves Entity Handle, Entity is created at sync point.
+         * Handle can be used by following commands immediately.
+         *
+         * @thread_safety - thread-safe (atomic), see ecs::ArchetypeStorage::Reserve.
+         * @return - Entity Handle.
+         * @throws - no exceptions.
+        **/
+        ecs_Handle Create() noexcept
+        { return mStorage.Reserve(); }
+
+        /**
+         * @brief
+         * Records Entity destruction.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @throws - std::bad_alloc.
+        **/
+        void Destroy( const ecs_Handle pEntity );
+
+        /**
+         * @brief
+         * Records Component attachment.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @param pArgs - Component constructor arguments.
+         * @throws - can throw exception.
+        **/
+        template <typename T, typename... _Types>
+        void addComponent( const ecs_Handle pEntity, _Types&&... pArgs )
+        {
+            void* const memory = Allocate( sizeof(T), alignof(T) );
+
+            // Command is added before Component, so constructed Component is never lost.
+            mCommands.push_back( Command{ ECommandTypes::Attach, ecs_ComponentType<T>::getID(), pEntity, nullptr } );
+
+            try
+            {
+                new( memory ) T( std::forward<_Types>(pArgs)... );
+            }
+            catch( ... )
+            {
+                mCommands.pop_back();
+                throw;
+            }
+
+            mCommands.back().mData = memory;
+        }
+
+        /**
+         * @brief
+         * Records Component detachment.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @param pType - Component Type-ID.
+         * @throws - std::bad_alloc.
+        **/
+        void Detach( const ecs_Handle pEntity, const ecs_TypeID pType );
+
+        template <typename T>
+        void removeComponent( const ecs_Handle pEntity )
+        { Detach( pEntity, ecs_ComponentType<T>::getID() ); }
+
+        /**
+         * @brief
+         * Records ecs::IEntity::attachComponent call.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity.
+         * @param pComponent - Component.
+         * @throws - std::bad_alloc.
+        **/
+        void attachComponent( ecs_sptr<ecs_IEntity> pEntity, ecs_sptr<ecs_Component> pComponent );
+
+        /**
+         * @brief
+         * Records ecs::IEntity::detachComponent call.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity.
+         * @param pType - Component Type-ID.
+         * @param pID - Component ID.
+         * @throws - std::bad_alloc.
+        **/
+        void detachComponent( ecs_sptr<ecs_IEntity> pEntity, const ecs_TypeID pType, const ecs_ObjectID pID );
+
+        /**
+         * @brief
+         * Records ecs::EntitiesManager::registerEntity call.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity.
+         * @throws - std::bad_alloc.
+        **/
+        void registerEntity( ecs_sptr<ecs_IEntity> pEntity );
+
+        /**
+         * @brief
+         * Records ecs::IEntity::Destroy call.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity.
+         * @throws - std::bad_alloc.
+        **/
+        void destroyEntity( ecs_sptr<ecs_IEntity> pEntity );
+
+        /**
+         * @brief
+         * Forgets commands after they applied. Payload blocks are kept.
+         *
+         * (?) Components of Attach commands must be already moved or destroyed.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Reset() noexcept;
+
+        /**
+         * @brief
+         * Moves recorded commands to the end of given lists.
+         * Payload blocks are kept, until #Rewind or #Reset.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pCommands - storage commands (output).
+         * @param pEntityCommands - legacy Entities commands (output).
+         * @throws - std::bad_alloc, nothing is moved on exception.
+        **/
+        void Take( ecs_vec<Command>& pCommands, ecs_vec<EntityCommand>& pEntityCommands );
+
+        /**
+         * @brief
+         * Reuses payload blocks, if no storage commands are recorded.
+         *
+         * (?) Components of taken Attach commands must be already moved or destroyed.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Rewind() noexcept;
+
+        /**
+         * @brief
+         * Destroys recorded Components & forgets commands without applying.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Discard() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::CommandBuffer
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_ECommandTypes = ecs::ECommandTypes;
+using ecs_CommandBuffer = ecs::CommandBuffer;
+#define ECS_COMMAND_BUFFER_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_COMMAND_BUFFER_HPP
@@ -0,0 +1,273 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_COMMAND_QUEUE_HPP
+#define ECS_COMMAND_QUEUE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::CommandBuffer
+#ifndef ECS_COMMAND_BUFFER_HPP
+#include "CommandBuffer.hpp"
+#endif // !ECS_COMMAND_BUFFER_HPP
+
+// Include ecs::mutex
+#ifndef ECS_MUTEX_HPP
+#include "../types/ecs_mutex.hpp"
+#endif // !ECS_MUTEX_HPP
+
+// Include ecs::thread
+#ifndef ECS_THREAD_HPP
+#include "../types/ecs_thread.hpp"
+#endif // !ECS_THREAD_HPP
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Queues buffers, cached by each thread. **/
+#ifndef ECS_COMMAND_QUEUE_LOCAL_CACHE
+#define ECS_COMMAND_QUEUE_LOCAL_CACHE 4
+#endif // !ECS_COMMAND_QUEUE_LOCAL_CACHE
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * CommandQueue - per-thread CommandBuffers of one storage.
+     *
+     * Threads record structural changes without locks into own CommandBuffer,
+     * all buffers are applied at sync point (see ecs::SystemsManager::Update).
+     * Storage commands are sorted by Entity location (Archetype, Chunk, row),
+     * commands of one Entity keep recorded order.
+     *
+     * @version 0.1
+    **/
+    class ECS_API CommandQueue final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Thread buffer.
+        **/
+        struct ThreadBuffer final
+        {
+            /** Owner thread. **/
+            ecs_thread::id mThread;
+
+            /** Buffer. **/
+            ecs_sptr<ecs_CommandBuffer> mBuffer;
+        };
+
+        /**
+         * @brief
+         * Sorted command.
+        **/
+        struct SortedCommand final
+        {
+            /** Entity location key. **/
+            ecs_uint64_t mKey;
+
+            /** Command. **/
+            ecs_CommandBuffer::Command* mCommand;
+        };
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Queue ID, used by threads to cache own buffer. **/
+        const ecs_uint64_t mID;
+
+        /** Storage. **/
+        ecs_ArchetypeStorage& mStorage;
+
+        /** Buffers. **/
+        ecs_vec<ThreadBuffer> mBuffers;
+
+        /** Buffers Mutex. **/
+        ecs_Mutex mBuffersMutex;
+
+        /** Storage commands taken from buffers, kept between frames. **/
+        ecs_vec<ecs_CommandBuffer::Command> mCommands;
+
+        /** Legacy Entities commands taken from buffers, kept between frames. **/
+        ecs_vec<ecs_CommandBuffer::EntityCommand> mEntityCommands;
+
+        /** Sorted commands, kept between frames. **/
+        ecs_vec<SortedCommand> mSorted;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns Entity location key: Archetype, Chunk & row.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @throws - no exceptions.
+        **/
+        ecs_uint64_t getKey( const ecs_Handle pEntity ) const noexcept;
+
+        /**
+         * @brief
+         * Destroys Components of not applied taken commands, forgets taken commands
+         * & rewinds buffers payload.
+         *
+         * @thread_safety - sync point only.
+         * @throws - no exceptions.
+        **/
+        void Release() noexcept;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        CommandQueue(const CommandQueue&) = delete;
+        CommandQueue& operator=(const CommandQueue&) = delete;
+        CommandQueue(CommandQueue&&) = delete;
+        CommandQueue& operator=(CommandQueue&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * CommandQueue constructor.
+         *
+         * @param pStorage - storage to apply commands to, must outlive queue.
+         * @throws - no exceptions.
+        **/
+        explicit CommandQueue( ecs_ArchetypeStorage& pStorage ) noexcept;
+
+        /**
+         * @brief
+         * CommandQueue destructor.
+         * Not applied commands are discarded.
+         *
+         * @throws - no exceptions.
+        **/
+        ~CommandQueue() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns CommandBuffer of calling thread.
+         * Lock is taken only when thread uses queue first time, or queue left thread cache.
+         *
+         * @thread_safety - thread-safe.
+         * @throws - std::bad_alloc.
+        **/
+        ecs_CommandBuffer& getLocal();
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Applies all buffers to storage & resets them.
+         * Storage commands applied first, then legacy Entities commands,
+         * then Components observers are notified (see ecs::ArchetypeStorage::NotifyObservers).
+         *
+         * (?) Commands are taken out of buffers before applied, so commands
+         * can record new commands, they're applied by next call.
+         *
+         * @thread_safety - sync point only, no threads recording or iterating storage.
+         * @throws - can throw exception, not applied commands are discarded.
+        **/
+        void Apply();
+
+        /**
+         * @brief
+         * Discards all buffers.
+         *
+         * @thread_safety - sync point only.
+         * @throws - no exceptions.
+        **/
+        void Discard() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::CommandQueue
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_CommandQueue = ecs::CommandQueue;
+#define ECS_COMMAND_QUEUE_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_COMMAND_QUEUE_HPP
@@ -0,0 +1,453 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_COMPONENT_POOL_HPP
+#define ECS_COMPONENT_POOL_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::IComponentPool
+#ifndef ECS_I_COMPONENT_POOL_HXX
+#include "IComponentPool.hxx"
+#endif // !ECS_I_COMPONENT_POOL_HXX
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// Include ecs::type_id
+#ifndef ECS_TYPE_ID_HPP
+#include "../types/ecs_type_id.hpp"
+#endif // !ECS_TYPE_ID_HPP
+
+// Include C++ utility
+#include <utility>
+
+// DEBUG
+#if defined( DEBUG ) || defined( BT_DEBUG )
+
+// Include ecs::assert
+#ifndef ECS_ASSERT_HPP
+#include "../types/ecs_assert.hpp"
+#endif // !ECS_ASSERT_HPP
+
+#endif
+// DEBUG
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * ComponentPool - stores Components of a single type by value,
+     * in a densely packed array.
+     *
+     * (?) Handles points to slots, slots points to dense index.
+     * Removal swaps last Component into the hole, so dense array never has gaps
+     * and iteration is a plain linear walk over contiguous memory.
+     *
+     * @thread_safety - not thread-safe, external synchronization required.
+     * @version 0.1
+    **/
+    template <typename T>
+    class ECS_API ComponentPool final : public ecs_IComponentPool
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** End of free-slots list. **/
+        static constexpr const ecs_uint32_t NO_SLOT = ecs_Handle::INDEX_MASK;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Type-ID. **/
+        const ecs_TypeID mTypeID;
+
+        /** Components (dense). **/
+        ecs_vec<T> mComponents;
+
+        /** Slot index for each dense Component. **/
+        ecs_vec<ecs_uint32_t> mDenseSlots;
+
+        /** Dense index for each slot, or next free slot if slot released. **/
+        ecs_vec<ecs_uint32_t> mSlots;
+
+        /** Slots generations. **/
+        ecs_vec<ecs_uint8_t> mGenerations;
+
+        /** First free slot. **/
+        ecs_uint32_t mFreeSlot;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        ComponentPool(const ComponentPool&) = delete;
+        ComponentPool& operator=(const ComponentPool&) = delete;
+        ComponentPool(ComponentPool&&) = delete;
+        ComponentPool& operator=(ComponentPool&&) = delete;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns free slot index.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - can throw exception.
+        **/
+        ecs_uint32_t acquireSlot()
+        {
+            if ( mFreeSlot != NO_SLOT )
+            {
+                const ecs_uint32_t slot = mFreeSlot;
+                mFreeSlot = mSlots[slot];
+                return slot;
+            }
+
+            const ecs_uint32_t slot = static_cast<ecs_uint32_t>( mSlots.size() );
+
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+            ecs_assert( slot < NO_SLOT && "ComponentPool::acquireSlot - out of Handles." );
+#endif // DEBUG
+
+            mSlots.push_back( NO_SLOT );
+            mGenerations.push_back( 0 );
+            return slot;
+        }
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * ComponentPool constructor.
+         *
+         * @param pType - Components Type-ID.
+         * @param pCapacity - initial capacity, 0 for default.
+         * @throws - can throw exception.
+        **/
+        explicit ComponentPool( const ecs_TypeID pType, const ecs_size_t pCapacity = 0 )
+            : mTypeID( pType ),
+              mComponents(),
+              mDenseSlots(),
+              mSlots(),
+              mGenerations(),
+              mFreeSlot( NO_SLOT )
+        {
+            if ( pCapacity > 0 )
+                Reserve( pCapacity );
+        }
+
+        /**
+         * @brief
+         * ComponentPool destructor.
+         *
+         * @throws - can throw exception.
+        **/
+        virtual ~ComponentPool() = default;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns Component, or null if Handle is stale.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pHandle - Component Handle.
+         * @throws - no exceptions.
+        **/
+        T* Get( const ecs_Handle pHandle ) noexcept
+        {
+            if ( !isAlive(pHandle) )
+                return nullptr;
+
+            return &mComponents[mSlots[pHandle.getIndex()]];
+        }
+
+        /**
+         * @brief
+         * Returns Component, or null if Handle is stale.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pHandle - Component Handle.
+         * @throws - no exceptions.
+        **/
+        const T* Get( const ecs_Handle pHandle ) const noexcept
+        {
+            if ( !isAlive(pHandle) )
+                return nullptr;
+
+            return &mComponents[mSlots[pHandle.getIndex()]];
+        }
+
+        /**
+         * @brief
+         * Returns Handle of the Component at dense index.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pIdx - dense index, less than #Count.
+         * @throws - no exceptions.
+        **/
+        ecs_Handle getHandle( const ecs_size_t pIdx ) const noexcept
+        {
+            const ecs_uint32_t slot = mDenseSlots[pIdx];
+            return ecs_Handle::Make( slot, mGenerations[slot] );
+        }
+
+        /**
+         * @brief
+         * Returns dense Components array.
+         *
+         * (!) Invalidated by #Create, #Remove & #Reserve.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        T* Data() noexcept
+        { return mComponents.data(); }
+
+        /**
+         * @brief
+         * Returns dense Components array.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        const T* Data() const noexcept
+        { return mComponents.data(); }
+
+        // ===========================================================
+        // ecs::IComponentPool
+        // ===========================================================
+
+        virtual ecs_TypeID getTypeID() const noexcept final
+        { return mTypeID; }
+
+        virtual ecs_size_t getComponentSize() const noexcept final
+        { return sizeof( T ); }
+
+        virtual ecs_TypeID getValueTypeID() const noexcept final
+        { return TypeIdOf<T>(); }
+
+        virtual ecs_size_t Count() const noexcept final
+        { return mComponents.size(); }
+
+        virtual bool isAlive( const ecs_Handle pHandle ) const noexcept final
+        {
+            const ecs_uint32_t slot = pHandle.getIndex();
+            return pHandle.isValid() && slot < mSlots.size() && mGenerations[slot] == pHandle.getGeneration() && mSlots[slot] < mComponents.size() && mDenseSlots[mSlots[slot]] == slot;
+        }
+
+        virtual bool Remove( const ecs_Handle pHandle ) final
+        {
+            if ( !isAlive(pHandle) )
+                return false;
+
+            const ecs_uint32_t slot = pHandle.getIndex();
+            const ecs_uint32_t denseIdx = mSlots[slot];
+            const ecs_uint32_t lastIdx = static_cast<ecs_uint32_t>( mComponents.size() - 1 );
+
+            // Swap last into the hole.
+            if ( denseIdx != lastIdx )
+            {
+                mComponents[denseIdx] = std::move( mComponents[lastIdx] );
+                mDenseSlots[denseIdx] = mDenseSlots[lastIdx];
+                mSlots[mDenseSlots[denseIdx]] = denseIdx;
+            }
+
+            mComponents.pop_back();
+            mDenseSlots.pop_back();
+
+            // Release slot.
+            mGenerations[slot] = static_cast<ecs_uint8_t>( mGenerations[slot] + 1 );
+            mSlots[slot] = mFreeSlot;
+            mFreeSlot = slot;
+
+            return true;
+        }
+
+        virtual void Clear() final
+        {
+            const ecs_size_t componentsCount = mComponents.size();
+            for( ecs_size_t denseIdx = 0; denseIdx < componentsCount; denseIdx++ )
+            {
+                const ecs_uint32_t slot = mDenseSlots[denseIdx];
+                mGenerations[slot] = static_cast<ecs_uint8_t>( mGenerations[slot] + 1 );
+                mSlots[slot] = mFreeSlot;
+                mFreeSlot = slot;
+            }
+
+            mComponents.clear();
+            mDenseSlots.clear();
+        }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Reserve storage.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pCapacity - Components count.
+         * @throws - can throw exception.
+        **/
+        void Reserve( const ecs_size_t pCapacity )
+        {
+            mComponents.reserve( pCapacity );
+            mDenseSlots.reserve( pCapacity );
+            mSlots.reserve( pCapacity );
+            mGenerations.reserve( pCapacity );
+        }
+
+        /**
+         * @brief
+         * Constructs new Component in-place.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pArgs - Component constructor arguments.
+         * @return - Component Handle.
+         * @throws - can throw exception.
+        **/
+        template <typename... _Types>
+        ecs_Handle Create( _Types&& ... pArgs )
+        {
+            const ecs_uint32_t slot = acquireSlot();
+            const ecs_uint32_t denseIdx = static_cast<ecs_uint32_t>( mComponents.size() );
+
+            mComponents.emplace_back( std::forward<_Types>(pArgs)... );
+            mDenseSlots.push_back( slot );
+            mSlots[slot] = denseIdx;
+
+            return ecs_Handle::Make( slot, mGenerations[slot] );
+        }
+
+        /**
+         * @brief
+         * Calls function for each Component.
+         *
+         * (?) Straight linear walk, no Handles resolving.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pFunc - callable with (T&) signature.
+         * @throws - can throw exception.
+        **/
+        template <typename F>
+        void forEach( F&& pFunc )
+        {
+            T* pos = mComponents.data();
+            T* const end = pos + mComponents.size();
+
+            for( ; pos != end; ++pos )
+                pFunc( *pos );
+        }
+
+        /**
+         * @brief
+         * Calls function for each Component with it's Handle.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pFunc - callable with (ecs_Handle, T&) signature.
+         * @throws - can throw exception.
+        **/
+        template <typename F>
+        void forEachWithHandle( F&& pFunc )
+        {
+            T* const components = mComponents.data();
+            const ecs_uint32_t* const slots = mDenseSlots.data();
+            const ecs_uint8_t* const generations = mGenerations.data();
+            const ecs_size_t componentsCount = mComponents.size();
+
+            for( ecs_size_t denseIdx = 0; denseIdx < componentsCount; denseIdx++ )
+                pFunc( ecs_Handle::Make(slots[denseIdx], generations[slots[denseIdx]]), components[denseIdx] );
+        }
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::ComponentPool
+
+    template <typename T>
+    constexpr const ecs_uint32_t ComponentPool<T>::NO_SLOT;
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+template <typename T>
+using ecs_ComponentPool = ecs::ComponentPool<T>;
+#define ECS_COMPONENT_POOL_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_COMPONENT_POOL_HPP
@@ -0,0 +1,424 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_COMPONENT_TYPE_HPP
+#define ECS_COMPONENT_TYPE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::api
+#ifndef ECS_API_HPP
+#include "../types/ecs_api.hpp"
+#endif // !ECS_API_HPP
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "../types/ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// Include ecs::type_id
+#ifndef ECS_TYPE_ID_HPP
+#include "../types/ecs_type_id.hpp"
+#endif // !ECS_TYPE_ID_HPP
+
+// Include ecs::atomic
+#ifndef ECS_ATOMIC_HPP
+#include "../types/ecs_atomic.hpp"
+#endif // !ECS_ATOMIC_HPP
+
+// Include C++ type_traits
+#include <type_traits>
+
+// Include C++ new
+#include <new>
+
+// Include C++ utility
+#include <utility>
+
+// Include C++ stdexcept
+#include <stdexcept>
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Max Component types, stored in Archetypes. Type-IDs must be less. **/
+#ifndef ECS_MAX_COMPONENT_TYPES
+#define ECS_MAX_COMPONENT_TYPES 256
+#endif // !ECS_MAX_COMPONENT_TYPES
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * ComponentTypeInfo - type-erased description of Component type,
+     * used by Archetypes to manage columns without knowing C++ type.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API ComponentTypeInfo final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_STRUCT
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /** Move-construct pDst from pSrc, then destroy pSrc. **/
+        using move_fn = void(*)( void* const pDst, void* const pSrc );
+
+        /** Copy-construct pDst from pSrc. **/
+        using copy_fn = void(*)( void* const pDst, const void* const pSrc );
+
+        /** Destroy object. **/
+        using destroy_fn = void(*)( void* const pObject );
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Type-ID. **/
+        ecs_TypeID mTypeID;
+
+        /** Size (bytes). **/
+        ecs_size_t mSize;
+
+        /** Alignment (bytes). **/
+        ecs_size_t mAlign;
+
+        /** 'true' if trivially copyable, columns can be moved with memcpy. **/
+        bool mTrivial;
+
+        /** 'true' for tag (empty) type: stored only as Signature bit, without column. **/
+        bool mTag;
+
+        /** Move function. **/
+        move_fn mMove;
+
+        /** Copy function, null if type is not copy-constructible. **/
+        copy_fn mCopy;
+
+        /** Destroy function. **/
+        destroy_fn mDestroy;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Registers type info by its Type-ID.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pInfo - type info, must outlive ECS.
+         * @throws - std::out_of_range, if Type-ID isn't less than ECS_MAX_COMPONENT_TYPES,
+         * std::logic_error, if Type-ID is already used by another Component type.
+        **/
+        static void Register( const ComponentTypeInfo* const pInfo );
+
+        /**
+         * @brief
+         * Returns registered type info.
+         *
+         * @thread_safety - thread-safe (registered infos never removed).
+         * @param pType - Type-ID.
+         * @return - type info, or null if not registered.
+         * @throws - no exceptions.
+        **/
+        static const ComponentTypeInfo* Get( const ecs_TypeID pType ) noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::ComponentTypeInfo
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * ComponentType - binds C++ Component type to Type-ID.
+     *
+     * @version 0.1
+    **/
+    template <typename T>
+    class ECS_API ComponentType final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns Type-ID storage.
+         *
+         * @thread_safety - atomic.
+         * @throws - no exceptions.
+        **/
+        static ecs_atomic<ecs_TypeID>& getIDStorage() noexcept
+        {
+            static ecs_atomic<ecs_TypeID> typeID( ECS_INVALID_TYPE_ID );
+            return typeID;
+        }
+
+        /**
+         * @brief
+         * Returns type info storage.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        static ComponentTypeInfo& getInfoStorage() noexcept
+        {
+            static ComponentTypeInfo info{ getIDStorage().load(std::memory_order_relaxed), sizeof(T), alignof(T),
+                                           std::is_trivially_copyable<T>::value,
+                                           isTag(),
+                                           &ComponentType<T>::Move,
+                                           getCopyFn( std::is_copy_constructible<T>() ),
+                                           &ComponentType<T>::Destroy };
+            return info;
+        }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        static void Move( void* const pDst, void* const pSrc )
+        {
+            T* const src = static_cast<T*>( pSrc );
+            new( pDst ) T( std::move(*src) );
+            src->~T();
+        }
+
+        static void Copy( void* const pDst, const void* const pSrc )
+        { new( pDst ) T( *static_cast<const T*>(pSrc) ); }
+
+        static void Destroy( void* const pObject )
+        { static_cast<T*>( pObject )->~T(); }
+
+        static ComponentTypeInfo::copy_fn getCopyFn( std::true_type ) noexcept
+        { return &ComponentType<T>::Copy; }
+
+        static ComponentTypeInfo::copy_fn getCopyFn( std::false_type ) noexcept
+        { return nullptr; }
+
+        /**
+         * @brief
+         * Registers type info with validated Type-ID & publishes it.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pType - Type-ID, less than ECS_MAX_COMPONENT_TYPES.
+         * @throws - std::logic_error (see ecs::ComponentTypeInfo::Register), Type-ID is not changed.
+        **/
+        static void Bind( const ecs_TypeID pType )
+        {
+            const ecs_TypeID prevType = getInfoStorage().mTypeID;
+            getInfoStorage().mTypeID = pType;
+
+            try
+            {
+                ComponentTypeInfo::Register( &getInfoStorage() );
+            }
+            catch( ... )
+            {
+                getInfoStorage().mTypeID = prevType;
+                throw;
+            }
+
+            getIDStorage().store( pType, std::memory_order_release );
+        }
+
+        /**
+         * @brief
+         * Registers type with generated Type-ID.
+         * Generated Type-IDs start from ECS_RESERVED_COMPONENT_TYPES, so they never collide with manual ones.
+         *
+         * @thread_safety - thread-lock used.
+         * @throws - std::out_of_range, if generated Type-IDs exceed ECS_MAX_COMPONENT_TYPES.
+        **/
+        static void BindGenerated()
+        {
+            const ecs_TypeID typeID = TypeIdOf<T, ComponentFamily>();
+
+            if ( typeID >= ECS_MAX_COMPONENT_TYPES )
+                throw std::out_of_range( "ComponentType::getID - generated Type-IDs exhausted, increase ECS_MAX_COMPONENT_TYPES." );
+
+            Bind( typeID );
+        }
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        ComponentType() = delete;
+        ComponentType(const ComponentType&) = delete;
+        ComponentType& operator=(const ComponentType&) = delete;
+        ComponentType(ComponentType&&) = delete;
+        ComponentType& operator=(ComponentType&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns Type-ID.
+         * If type is not registered, it is registered with dense ecs::TypeIdOf value.
+         *
+         * @thread_safety - thread-safe, generated Type-ID is registered once.
+         * @throws - std::out_of_range, if generated Type-IDs exceed ECS_MAX_COMPONENT_TYPES,
+         * every next call throws again.
+        **/
+        static ecs_TypeID getID()
+        {
+            const ecs_TypeID typeID = getIDStorage().load( std::memory_order_acquire );
+
+            if ( typeID != ECS_INVALID_TYPE_ID )
+                return typeID;
+
+            // Function-local static: concurrent first calls (e.g. from different Worlds) wait for one registration.
+            // If registration throws, static is not initialized & next call retries.
+            static const bool registered = ( BindGenerated(), true );
+            (void)registered;
+
+            return getIDStorage().load( std::memory_order_acquire );
+        }
+
+        /**
+         * @brief
+         * Returns 'true' if type is tag: empty type, which takes no storage.
+         * Over-aligned empty types are stored as regular Components.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        static constexpr bool isTag() noexcept
+        { return std::is_empty<T>::value && sizeof( T ) == 1; }
+
+        /**
+         * @brief
+         * Returns type info.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        static const ComponentTypeInfo& getInfo() noexcept
+        { return getInfoStorage(); }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Binds Component type to Type-ID.
+         * Optional, to use manual Type-IDs instead of generated ones, must be called before #getID.
+         *
+         * (?) Manual Type-IDs are less than ECS_RESERVED_COMPONENT_TYPES,
+         * generated ones start after, so they never collide.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pType - Type-ID, less than ECS_RESERVED_COMPONENT_TYPES.
+         * @throws - std::out_of_range, if Type-ID isn't less than ECS_RESERVED_COMPONENT_TYPES,
+         * std::logic_error, if type already bound to another Type-ID, or Type-ID used by another type.
+         * Type-ID is not changed.
+        **/
+        static void Register( const ecs_TypeID pType )
+        {
+            // Validated before Type-ID is changed.
+            if ( pType >= ECS_RESERVED_COMPONENT_TYPES )
+                throw std::out_of_range( "ComponentType::Register - manual Type-ID must be less than ECS_RESERVED_COMPONENT_TYPES." );
+
+            const ecs_TypeID typeID = getIDStorage().load( std::memory_order_acquire );
+
+            // Archetypes & pools already use bound Type-ID.
+            if ( typeID != ECS_INVALID_TYPE_ID && typeID != pType )
+                throw std::logic_error( "ComponentType::Register - type already bound to another Type-ID." );
+
+            Bind( pType );
+        }
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::ComponentType
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_ComponentTypeInfo = ecs::ComponentTypeInfo;
+
+template <typename T>
+using ecs_ComponentType = ecs::ComponentType<T>;
+
+#define ECS_COMPONENT_TYPE_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_COMPONENT_TYPE_HPP
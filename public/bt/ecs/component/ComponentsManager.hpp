@@ -69,6 +69,29 @@
 #include "../types/ecs_map.hpp"
 #endif // !ECS_MAP_HPP
 
+// Include ecs::ComponentPool
+#ifndef ECS_COMPONENT_POOL_HPP
+#include "ComponentPool.hpp"
+#endif // !ECS_COMPONENT_POOL_HPP
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include ecs::CommandQueue
+#ifndef ECS_COMMAND_QUEUE_HPP
+#include "../command/CommandQueue.hpp"
+#endif // !ECS_COMMAND_QUEUE_HPP
+
+// Include ecs::HierarchyStore
+#ifndef ECS_HIERARCHY_STORE_HPP
+#include "../hierarchy/HierarchyStore.hpp"
+#endif // !ECS_HIERARCHY_STORE_HPP
+
+// Include C++ stdexcept
+#include <stdexcept>
+
 // ===========================================================
 // FORWARD-DECLARATION
 // ===========================================================
@@ -128,6 +151,12 @@ namespace ecs
         /** Components type-map. **/
         using components_types_map = ecs_map<ecs_TypeID, components_map_storage>;
 
+        /** Components Pool pointer. **/
+        using pool_ptr = ecs_sptr<ecs_IComponentPool>;
+
+        /** Components Pools, indexed by Type-ID. **/
+        using pools_vec = ecs_vec<pool_ptr>;
+
         // -----------------------------------------------------------
 
     private:
@@ -153,6 +182,21 @@ namespace ecs
         /** IDs Mutex. **/
         ecs_Mutex mIDMutex;
 
+        /** Typed Components Pools. **/
+        pools_vec mPools;
+
+        /** Pools Mutex. **/
+        ecs_Mutex mPoolsMutex;
+
+        /** Archetypes storage. **/
+        ecs_sptr<ecs_ArchetypeStorage> mArchetypes;
+
+        /** Deferred structural changes of Archetypes storage. **/
+        ecs_sptr<ecs_CommandQueue> mCommands;
+
+        /** Parent-child relations of Archetypes storage Entities. **/
+        ecs_sptr<ecs_HierarchyStore> mHierarchy;
+
         // ===========================================================
         // DELETED
         // ===========================================================
@@ -241,6 +285,99 @@ namespace ecs
         **/
         static ECS_API ecs_comp_ptr getAnyComponent(const ecs_TypeID pType, const bool pRemove = false) ECS_NOEXCEPT;
 
+        /**
+         * @brief
+         * Returns Archetypes storage.
+         *
+         * (?) Storage is not thread-safe, structural changes must be synchronized.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @return - storage, or null if ComponentsManager not initialized.
+         * @throws - can throw exception.
+        **/
+        static ECS_API ecs_sptr<ecs_ArchetypeStorage> getArchetypes();
+
+        /**
+         * @brief
+         * Returns CommandBuffer of calling thread,
+         * to record structural changes while storage iterated.
+         *
+         * @thread_safety - thread-safe.
+         * @return - CommandBuffer, or null if ComponentsManager not initialized.
+         * @throws - can throw exception.
+        **/
+        static ECS_API ecs_CommandBuffer* getCommands();
+
+        /**
+         * @brief
+         * Returns Entities hierarchy.
+         *
+         * (?) Hierarchy is not thread-safe, changes must be synchronized.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @return - hierarchy, or null if ComponentsManager not initialized.
+         * @throws - can throw exception.
+        **/
+        static ECS_API ecs_sptr<ecs_HierarchyStore> getHierarchy();
+
+        /**
+         * @brief
+         * Applies recorded commands of all threads.
+         *
+         * @thread_safety - sync point only (main thread, no Systems running).
+         * @throws - can throw exception.
+        **/
+        static ECS_API void ApplyCommands();
+
+        /**
+         * @brief
+         * Returns Components Pool for the given type, creates it if not exists.
+         *
+         * (?) Pool stores Components by value, unlike #addComponent.
+         * Pool itself is not thread-safe.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pType - Type-ID.
+         * @return - Pool, or null if ComponentsManager not initialized.
+         * @throws - std::logic_error, if Pool of Type-ID stores another type.
+        **/
+        template <typename T>
+        static ecs_sptr<ecs_ComponentPool<T>> getPool( const ecs_TypeID pType )
+        {
+            auto instance = getInstance();
+
+            if ( instance == nullptr )
+                return ecs_sptr<ecs_ComponentPool<T>>( nullptr );
+
+            ecs_SpinLock lock( &instance->mPoolsMutex );
+
+            if ( instance->mPools.size() <= pType )
+                instance->mPools.resize( static_cast<ecs_size_t>(pType) + 1 );
+
+            pool_ptr& pool = instance->mPools[pType];
+
+            if ( pool == nullptr )
+                pool = ecs_Shared<ecs_ComponentPool<T>>( pType );
+
+            // Same-sized types can't be told by size, checked in all builds.
+            if ( pool->getValueTypeID() != TypeIdOf<T>() )
+                throw std::logic_error( "ComponentsManager::getPool - Type-ID used for another Component type." );
+
+            return ecs_Memory::StaticCast<ecs_ComponentPool<T>, ecs_IComponentPool>( pool );
+        }
+
+        /**
+         * @brief
+         * Returns Components Pool for the given type, using generated Type-ID.
+         *
+         * @thread_safety - thread-lock used.
+         * @return - Pool, or null if ComponentsManager not initialized.
+         * @throws - can throw exception.
+        **/
+        template <typename T>
+        static ecs_sptr<ecs_ComponentPool<T>> getPool()
+        { return getPool<T>( ecs_ComponentType<T>::getID() ); }
+
         // ===========================================================
         // METHODS
         // ===========================================================
@@ -275,6 +412,46 @@ namespace ecs
         **/
         static ECS_API void removeComponent(ecs_comp_ptr& pComponent) ECS_NOEXCEPT;
 
+        /**
+         * @brief
+         * Removes Components Pool with all stored Components.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pType - Type-ID.
+         * @throws - can throw exception.
+        **/
+        static ECS_API void removePool( const ecs_TypeID pType );
+
+        /**
+         * @brief
+         * Calls function for each Component in the typed Pool.
+         *
+         * @thread_safety - Pool is not locked, external synchronization required.
+         * @param pType - Type-ID.
+         * @param pFunc - callable with (T&) signature.
+         * @throws - can throw exception.
+        **/
+        template <typename T, typename F>
+        static void forEach( const ecs_TypeID pType, F&& pFunc )
+        {
+            ecs_sptr<ecs_ComponentPool<T>> pool = getPool<T>( pType );
+
+            if ( pool != nullptr )
+                pool->forEach( std::forward<F>(pFunc) );
+        }
+
+        /**
+         * @brief
+         * Calls function for each Component in the typed Pool, using generated Type-ID.
+         *
+         * @thread_safety - Pool is not locked, external synchronization required.
+         * @param pFunc - callable with (T&) signature.
+         * @throws - can throw exception.
+        **/
+        template <typename T, typename F>
+        static void forEach( F&& pFunc )
+        { forEach<T>( ecs_ComponentType<T>::getID(), std::forward<F>(pFunc) ); }
+
         /**
          * @brief
          * Returns Component ID.
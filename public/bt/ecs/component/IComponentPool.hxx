@@ -0,0 +1,191 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_I_COMPONENT_POOL_HXX
+#define ECS_I_COMPONENT_POOL_HXX
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::api
+#ifndef ECS_API_HPP
+#include "../types/ecs_api.hpp"
+#endif // !ECS_API_HPP
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "../types/ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// Include ecs::handle
+#ifndef ECS_HANDLE_HPP
+#include "../types/ecs_handle.hpp"
+#endif // !ECS_HANDLE_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * IComponentPool - type-erased Components Pool interface.
+     *
+     * @version 0.1
+    **/
+    class ECS_API IComponentPool
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_INTERFACE
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * IComponentPool destructor.
+         *
+         * @throws - can throw exception.
+        **/
+        virtual ~IComponentPool()
+        {
+        }
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns Components Type-ID.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        virtual ecs_TypeID getTypeID() const noexcept = 0;
+
+        /**
+         * @brief
+         * Returns size of stored Component (bytes).
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        virtual ecs_size_t getComponentSize() const noexcept = 0;
+
+        /**
+         * @brief
+         * Returns generated Type-ID of stored C++ type (see ecs::TypeIdOf),
+         * used to check Pool type, when Type-ID is set manually.
+         *
+         * @thread_safety - thread-safe (static init).
+         * @throws - no exceptions.
+        **/
+        virtual ecs_TypeID getValueTypeID() const noexcept = 0;
+
+        /**
+         * @brief
+         * Returns stored Components count.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        virtual ecs_size_t Count() const noexcept = 0;
+
+        /**
+         * @brief
+         * Returns 'true' if Handle points to alive Component.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pHandle - Component Handle.
+         * @throws - no exceptions.
+        **/
+        virtual bool isAlive( const ecs_Handle pHandle ) const noexcept = 0;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Removes Component.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pHandle - Component Handle.
+         * @return - 'true' if removed, 'false' if Handle is stale.
+         * @throws - can throw exception.
+        **/
+        virtual bool Remove( const ecs_Handle pHandle ) = 0;
+
+        /**
+         * @brief
+         * Removes all Components.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - can throw exception.
+        **/
+        virtual void Clear() = 0;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::IComponentPool
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_IComponentPool = ecs::IComponentPool;
+#define ECS_I_COMPONENT_POOL_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_I_COMPONENT_POOL_HXX
@@ -69,6 +69,11 @@
 #include "../types/ecs_map.hpp"
 #endif // !ECS_MAP_HPP
 
+// Include ecs::EntityRegistry
+#ifndef ECS_ENTITY_REGISTRY_HPP
+#include "EntityRegistry.hpp"
+#endif // !ECS_ENTITY_REGISTRY_HPP
+
 // ===========================================================
 // FORWARD-DECLARATION
 // ===========================================================
@@ -153,6 +158,12 @@ namespace ecs
         /** Entities Mutex. **/
         ecs_Mutex mEntitiesMutex;
 
+        /** Handle-only Entities. **/
+        ecs_EntityRegistry mRegistry;
+
+        /** Registry Mutex. **/
+        ecs_Mutex mRegistryMutex;
+
         // ===========================================================
         // DELETED
         // ===========================================================
@@ -198,9 +209,10 @@ namespace ecs
          * @brief
          * EntitiesManager constructor.
          *
+         * @param pStorage - storage to allocate Entities Handles from, own storage is created if null.
          * @throws - cant throw exception.
         **/
-        explicit EntitiesManager();
+        explicit EntitiesManager( const ecs_sptr<ecs_ArchetypeStorage>& pStorage );
 
         /**
          * @brief
@@ -225,6 +237,16 @@ namespace ecs
         **/
         static entity_ptr getEntityByType( const ecs_TypeID pType, const bool pRemove );
 
+        /**
+         * @brief
+         * Returns EntitiesManager of World bound to calling thread, or process-wide one.
+         * Used by objects, which must release IDs & Handles in EntitiesManager created them.
+         *
+         * @thread_safety - thread-safe.
+         * @throws - can throw exception.
+        **/
+        static ECS_API ecs_wptr<EntitiesManager> getCurrent();
+
         /**
          * @brief
          * Search Entity.
@@ -283,6 +305,106 @@ namespace ecs
         **/
         static ECS_API void releaseEntityID(const ecs_TypeID pType, const ecs_ObjectID pID) ECS_NOEXCEPT;
 
+        /**
+         * @brief
+         * Returns EntitiesManager ID for reuse.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pInstance - EntitiesManager, which generated ID, can be null.
+         * @param pType - Type-ID.
+         * @param pID - ID to return for reuse.
+         * @throws - can throw exception.
+        **/
+        static ECS_API void releaseEntityID( const ecs_sptr<EntitiesManager>& pInstance, const ecs_TypeID pType, const ecs_ObjectID pID ) ECS_NOEXCEPT;
+
+        /**
+         * @brief
+         * Creates handle-only Entity.
+         *
+         * @thread_safety - thread-lock used.
+         * @return - Entity Handle, or invalid Handle if EntitiesManager not initialized.
+         * @throws - can throw exception.
+        **/
+        static ECS_API ecs_Handle createHandle();
+
+        /**
+         * @brief
+         * Creates handle-only Entity.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pInstance - EntitiesManager, can be null.
+         * @return - Entity Handle, or invalid Handle if pInstance is null.
+         * @throws - can throw exception.
+        **/
+        static ECS_API ecs_Handle createHandle( const ecs_sptr<EntitiesManager>& pInstance );
+
+        /**
+         * @brief
+         * Destroys handle-only Entity.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pEntity - Entity Handle.
+         * @throws - can throw exception, see ecs::ArchetypeStorage::Destroy.
+        **/
+        static ECS_API void destroyHandle( const ecs_Handle pEntity );
+
+        /**
+         * @brief
+         * Destroys handle-only Entity.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pInstance - EntitiesManager, which created Entity, can be null.
+         * @param pEntity - Entity Handle.
+         * @throws - can throw exception, see ecs::ArchetypeStorage::Destroy.
+        **/
+        static ECS_API void destroyHandle( const ecs_sptr<EntitiesManager>& pInstance, const ecs_Handle pEntity );
+
+        /**
+         * @brief
+         * Updates Components mask of handle-only Entity.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pEntity - Entity Handle.
+         * @param pType - Component Type-ID.
+         * @param pAttached - 'true' if attached.
+         * @throws - no exceptions.
+        **/
+        static ECS_API void setComponent( const ecs_Handle pEntity, const ecs_TypeID pType, const bool pAttached ) ECS_NOEXCEPT;
+
+        /**
+         * @brief
+         * Updates Components mask of handle-only Entity.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pInstance - EntitiesManager, which created Entity, can be null.
+         * @param pEntity - Entity Handle.
+         * @param pType - Component Type-ID.
+         * @param pAttached - 'true' if attached.
+         * @throws - no exceptions.
+        **/
+        static ECS_API void setComponent( const ecs_sptr<EntitiesManager>& pInstance, const ecs_Handle pEntity, const ecs_TypeID pType, const bool pAttached ) ECS_NOEXCEPT;
+
+        /**
+         * @brief
+         * Calls function for each handle-only Entity with required Components.
+         *
+         * @thread_safety - thread-lock used, function must not create or destroy Entities.
+         * @param pRequired - required Components.
+         * @param pFunction - f( ecs_Handle ).
+         * @throws - can throw exception.
+        **/
+        template <typename F>
+        static void forEachHandle( const ecs_Signature& pRequired, F pFunction )
+        {
+            auto instance = getInstance();
+
+            if ( instance != nullptr )
+            {
+                ecs_SpinLock lock( &instance->mRegistryMutex );
+                instance->mRegistry.forEach( pRequired, pFunction );
+            }
+        }
+
         /**
          * @brief
          * Initialize EntitiesManager instance.
@@ -310,6 +432,7 @@ namespace ecs
 } /// ecs
 
 using ecs_Entities = ecs::EntitiesManager;
+#define ECS_ENTITIES_MANAGER_DECL
 
 // -----------------------------------------------------------
 
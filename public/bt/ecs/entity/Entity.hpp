@@ -54,6 +54,17 @@
 #include "../types/ecs_vector.hpp"
 #endif // !ECS_VECTOR_HPP
 
+// ===========================================================
+// FORWARD-DECLARATIONS
+// ===========================================================
+
+// Forward-Declare ecs::EntitiesManager
+#ifndef ECS_ENTITIES_MANAGER_DECL
+#define ECS_ENTITIES_MANAGER_DECL
+namespace ecs { class EntitiesManager; }
+using ecs_Entities = ecs::EntitiesManager;
+#endif // !ECS_ENTITIES_MANAGER_DECL
+
 // ===========================================================
 // TYPES
 // ===========================================================
@@ -105,6 +116,9 @@ namespace ecs
         /** Parent IEntity. **/
         ecs_wptr<ecs_IEntity> mParent;
 
+        /** EntitiesManager, which created this Entity (World could be unbound when Entity is destroyed). **/
+        const ecs_wptr<ecs_Entities> mManager;
+
         // ===========================================================
         // CONSTRUCTOR
         // ===========================================================
@@ -170,6 +184,9 @@ namespace ecs
         /** ID **/
         const ecs_ObjectID mID;
 
+        /** Handle in ecs::EntityRegistry. **/
+        const ecs_Handle mHandle;
+
         // ===========================================================
         // DESTRUCTOR
         // ===========================================================
@@ -204,6 +221,15 @@ namespace ecs
         **/
         virtual ecs_TypeID getID() const noexcept final;
 
+        /**
+         * @brief
+         * Returns Entity Handle in ecs::EntityRegistry.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        virtual ecs_Handle getHandle() const noexcept final;
+
         /**
          * @brief
          * Returns Component, or null.
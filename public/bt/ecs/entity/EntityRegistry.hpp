@@ -0,0 +1,366 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_ENTITY_REGISTRY_HPP
+#define ECS_ENTITY_REGISTRY_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include ecs::memory
+#ifndef ECS_MEMORY_HPP
+#include "../types/ecs_memory.hpp"
+#endif // !ECS_MEMORY_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// DEBUG
+#if defined( DEBUG ) || defined( BT_DEBUG )
+
+// Include ecs::assert
+#ifndef ECS_ASSERT_HPP
+#include "../types/ecs_assert.hpp"
+#endif // !ECS_ASSERT_HPP
+
+#endif
+// DEBUG
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EntityRegistry - handle-only Entities.
+     *
+     * Entity is 32-bit ecs::Handle (index + generation), no object is allocated.
+     * Handles are allocated by ecs::ArchetypeStorage, so Entities share one Handles space
+     * with Archetypes storage Entities (created in root Archetype).
+     * Alive Entities & their legacy Components masks are stored in dense arrays,
+     * slots map Handle index to dense position.
+     * Registry is bound to storage, so it is captured & restored with storage snapshots.
+     *
+     * (?) One registry per storage.
+     *
+     * @thread_safety - not thread-safe, same as storage.
+     * @version 0.1
+    **/
+    class ECS_API EntityRegistry final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Slot is not used. **/
+        static constexpr const ecs_uint32_t NO_INDEX = ecs_NumericUtil<ecs_uint32_t>::MAX;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Storage, allocates Handles. **/
+        const ecs_sptr<ecs_ArchetypeStorage> mStorage;
+
+        /** Dense index of each Handle slot, or NO_INDEX. **/
+        ecs_vec<ecs_uint32_t> mSlots;
+
+        /** Alive Entities (dense). **/
+        ecs_vec<ecs_Handle> mEntities;
+
+        /** Components masks (dense, parallel to mEntities). **/
+        ecs_vec<ecs_Signature> mMasks;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Removes dense Entity of Handle slot.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pSlot - Handle slot with dense Entity.
+         * @throws - no exceptions.
+        **/
+        void Remove( const ecs_uint32_t pSlot ) noexcept;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        EntityRegistry(const EntityRegistry&) = delete;
+        EntityRegistry& operator=(const EntityRegistry&) = delete;
+        EntityRegistry(EntityRegistry&&) = delete;
+        EntityRegistry& operator=(EntityRegistry&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * EntityRegistry constructor.
+         * Binds registry to storage (see ecs::ArchetypeStorage::setRegistry).
+         *
+         * @param pStorage - storage to allocate Handles from.
+         * @throws - no exceptions.
+        **/
+        explicit EntityRegistry( const ecs_sptr<ecs_ArchetypeStorage>& pStorage ) noexcept;
+
+        /**
+         * @brief
+         * EntityRegistry destructor.
+         * Entities are not destroyed, they're released with storage.
+         * Registry is unbound from storage.
+         *
+         * @throws - no exceptions.
+        **/
+        ~EntityRegistry() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns alive Entities count.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t Count() const noexcept
+        { return mEntities.size(); }
+
+        /**
+         * @brief
+         * Returns 'true' if Handle refers to alive Entity.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @throws - no exceptions.
+        **/
+        bool isAlive( const ecs_Handle pEntity ) const noexcept
+        {
+            const ecs_uint32_t slot = pEntity.getIndex();
+            return slot < mSlots.size() && mSlots[slot] != NO_INDEX && mEntities[mSlots[slot]] == pEntity && mStorage->isAlive( pEntity );
+        }
+
+        /**
+         * @brief
+         * Returns storage.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        const ecs_sptr<ecs_ArchetypeStorage>& getStorage() const noexcept
+        { return mStorage; }
+
+        /**
+         * @brief
+         * Returns Entities created by this registry.
+         *
+         * (?) Entities destroyed directly in storage are removed on next #Create.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        const ecs_vec<ecs_Handle>& getEntities() const noexcept
+        { return mEntities; }
+
+        /**
+         * @brief
+         * Returns Components mask of Entity.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - alive Entity Handle.
+         * @throws - no exceptions.
+        **/
+        const ecs_Signature& getMask( const ecs_Handle pEntity ) const noexcept
+        {
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+            ecs_assert( isAlive(pEntity) && "EntityRegistry::getMask - Entity is not alive." );
+#endif // DEBUG
+
+            return mMasks[mSlots[pEntity.getIndex()]];
+        }
+
+        /**
+         * @brief
+         * Returns 'true' if Entity has Component type.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @param pType - Component Type-ID.
+         * @throws - no exceptions.
+        **/
+        bool hasComponent( const ecs_Handle pEntity, const ecs_TypeID pType ) const noexcept
+        { return isAlive( pEntity ) && pType < ECS_MAX_COMPONENT_TYPES && mMasks[mSlots[pEntity.getIndex()]].Test( pType ); }
+
+        /**
+         * @brief
+         * Sets or resets Component type in Entity mask.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @param pType - Component Type-ID.
+         * @param pAttached - 'true' if attached.
+         * @return - 'false' if Handle is stale or Type-ID out of mask range.
+         * @throws - no exceptions.
+        **/
+        bool setComponent( const ecs_Handle pEntity, const ecs_TypeID pType, const bool pAttached ) noexcept;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Creates Entity in storage root Archetype.
+         *
+         * @thread_safety - not thread-safe.
+         * @return - Entity Handle.
+         * @throws - std::bad_alloc.
+        **/
+        ecs_Handle Create();
+
+        /**
+         * @brief
+         * Destroys Entity in storage, Handle becomes stale.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - 'false' if Handle is stale.
+         * @throws - can throw exception, see ecs::ArchetypeStorage::Destroy.
+        **/
+        bool Destroy( const ecs_Handle pEntity );
+
+        /**
+         * @brief
+         * Calls function for each Entity with all required Components.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pRequired - required Components.
+         * @param pFunction - f( ecs_Handle ).
+         * @throws - can throw exception.
+        **/
+        template <typename F>
+        void forEach( const ecs_Signature& pRequired, F pFunction ) const
+        {
+            const ecs_size_t entitiesCount = mEntities.size();
+
+            for ( ecs_size_t i = 0; i < entitiesCount; i++ )
+            {
+                if ( mMasks[i].Contains(pRequired) && mStorage->isAlive(mEntities[i]) )
+                    pFunction( mEntities[i] );
+            }
+        }
+
+        /**
+         * @brief
+         * Copies Entities & masks to snapshot, see ecs::ArchetypeStorage::Capture.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pDst - snapshot.
+         * @throws - std::bad_alloc.
+        **/
+        void Capture( ecs_StorageSnapshot& pDst ) const;
+
+        /**
+         * @brief
+         * Replaces Entities & masks with snapshot ones, see ecs::ArchetypeStorage::Restore.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pSrc - snapshot.
+         * @throws - std::bad_alloc.
+        **/
+        void Restore( const ecs_StorageSnapshot& pSrc );
+
+        /**
+         * @brief
+         * Destroys all Entities in storage.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - can throw exception, see ecs::ArchetypeStorage::Destroy.
+        **/
+        void Clear();
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::EntityRegistry
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_EntityRegistry = ecs::EntityRegistry;
+#define ECS_ENTITY_REGISTRY_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_ENTITY_REGISTRY_HPP
@@ -49,6 +49,11 @@
 #include "../types/ecs_memory.hpp"
 #endif // !ECS_MEMORY_HPP
 
+// Include ecs::handle
+#ifndef ECS_HANDLE_HPP
+#include "../types/ecs_handle.hpp"
+#endif // !ECS_HANDLE_HPP
+
 // Include ecs::mutex
 #ifndef ECS_MUTEX_HPP
 #include "../types/ecs_mutex.hpp"
@@ -133,6 +138,15 @@ namespace ecs
         **/
         virtual ecs_TypeID getID() const noexcept = 0;
 
+        /**
+         * @brief
+         * Returns Entity Handle in ecs::EntityRegistry.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        virtual ecs_Handle getHandle() const noexcept = 0;
+
         /**
          * @brief
          * Returns Component, or null.
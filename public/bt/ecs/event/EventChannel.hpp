@@ -0,0 +1,491 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_EVENT_CHANNEL_HPP
+#define ECS_EVENT_CHANNEL_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::api
+#ifndef ECS_API_HPP
+#include "../types/ecs_api.hpp"
+#endif // !ECS_API_HPP
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "../types/ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// Include ecs::memory
+#ifndef ECS_MEMORY_HPP
+#include "../types/ecs_memory.hpp"
+#endif // !ECS_MEMORY_HPP
+
+// Include ecs::mutex
+#ifndef ECS_MUTEX_HPP
+#include "../types/ecs_mutex.hpp"
+#endif // !ECS_MUTEX_HPP
+
+// Include ecs::thread
+#ifndef ECS_THREAD_HPP
+#include "../types/ecs_thread.hpp"
+#endif // !ECS_THREAD_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// Include C++ type_traits
+#include <type_traits>
+
+// Include C++ utility
+#include <utility>
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Channels buffers, cached by each thread per Event type. **/
+#ifndef ECS_EVENT_CHANNEL_LOCAL_CACHE
+#define ECS_EVENT_CHANNEL_LOCAL_CACHE 8
+#endif // !ECS_EVENT_CHANNEL_LOCAL_CACHE
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EventChannelBase - EventChannel IDs, used by threads to cache own buffer.
+     *
+     * @version 0.1
+    **/
+    class ECS_API EventChannelBase
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    protected:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Channel ID, unique in process, never 0. **/
+        const ecs_uint64_t mID;
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * EventChannelBase constructor.
+         *
+         * @throws - no exceptions.
+        **/
+        explicit EventChannelBase() noexcept;
+
+        /**
+         * @brief
+         * EventChannelBase destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~EventChannelBase() noexcept = default;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        EventChannelBase(const EventChannelBase&) = delete;
+        EventChannelBase& operator=(const EventChannelBase&) = delete;
+        EventChannelBase(EventChannelBase&&) = delete;
+        EventChannelBase& operator=(EventChannelBase&&) = delete;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::EventChannelBase
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EventChannel - typed Events, stored by value.
+     *
+     * Writers append Events into own thread buffer (no locks, no allocations
+     * after warm-up), #Swap at frame boundary moves them into read buffer,
+     * readers iterate contiguous array of previous frame Events.
+     * Events of one thread keep sending order.
+     *
+     * Example:
+     * ecs::EventChannel<Damage> damages;
+     * damages.Send( Damage{ target, 10 } ); // any thread
+     * damages.Swap(); // sync point
+     * for ( const Damage& damage : damages ) { ... }
+     *
+     * @thread_safety - #Send from any thread, #Swap & #Clear at sync point only,
+     * reading is not synchronized with #Swap.
+     * @version 0.1
+    **/
+    template <typename T>
+    class ECS_API EventChannel final : public EventChannelBase
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+        static_assert( std::is_trivially_copyable<T>::value, "EventChannel - Event type must be trivially copyable." );
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Thread buffer.
+        **/
+        struct ThreadBuffer final
+        {
+            /** Owner thread. **/
+            ecs_thread::id mThread;
+
+            /** Events, sent since last #Swap. **/
+            ecs_vec<T> mEvents;
+        };
+
+        /**
+         * @brief
+         * Cached channel & buffer of thread.
+        **/
+        struct LocalBuffer final
+        {
+            /** Channel ID, 0 if empty. **/
+            ecs_uint64_t mChannel;
+
+            /** Buffer. **/
+            ThreadBuffer* mBuffer;
+        };
+
+        /**
+         * @brief
+         * Recently used channels & buffers of thread.
+         * Channel IDs are never reused, so entries of destroyed channels never match.
+        **/
+        struct LocalCache final
+        {
+            /** Cached buffers. **/
+            LocalBuffer mBuffers[ECS_EVENT_CHANNEL_LOCAL_CACHE];
+
+            /** Next entry to replace. **/
+            ecs_size_t mNext;
+        };
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Threads buffers. **/
+        ecs_vec<ecs_sptr<ThreadBuffer>> mBuffers;
+
+        /** Buffers Mutex. **/
+        ecs_Mutex mBuffersMutex;
+
+        /** Events of previous frame. **/
+        ecs_vec<T> mEvents;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns thread cache.
+         *
+         * @thread_safety - thread-local.
+         * @throws - no exceptions.
+        **/
+        static LocalCache& getLocalCache() noexcept
+        {
+            static thread_local LocalCache local{ {}, 0 };
+            return local;
+        }
+
+        /**
+         * @brief
+         * Returns buffer of calling thread, registers it on first call.
+         *
+         * @thread_safety - thread-lock used on first call of thread, or if channel left thread cache.
+         * @throws - std::bad_alloc.
+        **/
+        ThreadBuffer& getLocal()
+        {
+            LocalCache& local = getLocalCache();
+
+            for ( const LocalBuffer& cached : local.mBuffers )
+            {
+                if ( cached.mChannel == mID )
+                    return *cached.mBuffer;
+            }
+
+            const ecs_thread::id thread = std::this_thread::get_id();
+            ecs_SpinLock lock( &mBuffersMutex );
+
+            ThreadBuffer* buffer = nullptr;
+
+            for ( const ecs_sptr<ThreadBuffer>& threadBuffer : mBuffers )
+            {
+                if ( threadBuffer->mThread == thread )
+                {
+                    buffer = threadBuffer.get();
+                    break;
+                }
+            }
+
+            if ( buffer == nullptr )
+            {
+                mBuffers.push_back( ecs_Shared<ThreadBuffer>() );
+                buffer = mBuffers.back().get();
+                buffer->mThread = thread;
+            }
+
+            // Oldest entry replaced.
+            local.mBuffers[local.mNext] = LocalBuffer{ mID, buffer };
+            local.mNext = (local.mNext + 1) % ECS_EVENT_CHANNEL_LOCAL_CACHE;
+
+            return *buffer;
+        }
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        EventChannel(const EventChannel&) = delete;
+        EventChannel& operator=(const EventChannel&) = delete;
+        EventChannel(EventChannel&&) = delete;
+        EventChannel& operator=(EventChannel&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * EventChannel constructor.
+         *
+         * @throws - no exceptions.
+        **/
+        explicit EventChannel() noexcept
+            : EventChannelBase(),
+              mBuffers(),
+              mBuffersMutex(),
+              mEvents()
+        {
+        }
+
+        /**
+         * @brief
+         * EventChannel destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~EventChannel() noexcept = default;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns Events of previous frame.
+         *
+         * @thread_safety - read-only between #Swap calls.
+         * @throws - no exceptions.
+        **/
+        const T* getData() const noexcept
+        { return mEvents.data(); }
+
+        /**
+         * @brief
+         * Returns Events count of previous frame.
+         *
+         * @thread_safety - read-only between #Swap calls.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t Count() const noexcept
+        { return mEvents.size(); }
+
+        /**
+         * @brief
+         * Returns 'true' if previous frame has no Events.
+         *
+         * @thread_safety - read-only between #Swap calls.
+         * @throws - no exceptions.
+        **/
+        bool isEmpty() const noexcept
+        { return mEvents.empty(); }
+
+        const T* begin() const noexcept
+        { return mEvents.data(); }
+
+        const T* end() const noexcept
+        { return mEvents.data() + mEvents.size(); }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Appends Event to calling thread buffer, readable after next #Swap.
+         *
+         * @thread_safety - thread-safe, lock-free after first call of thread.
+         * @param pEvent - Event.
+         * @throws - std::bad_alloc.
+        **/
+        void Send( const T& pEvent )
+        { getLocal().mEvents.push_back( pEvent ); }
+
+        /**
+         * @brief
+         * Constructs Event in calling thread buffer, readable after next #Swap.
+         *
+         * @thread_safety - thread-safe, lock-free after first call of thread.
+         * @param pArgs - Event constructor arguments.
+         * @throws - std::bad_alloc.
+        **/
+        template <typename... _Types>
+        void Emplace( _Types&&... pArgs )
+        { getLocal().mEvents.emplace_back( std::forward<_Types>(pArgs)... ); }
+
+        /**
+         * @brief
+         * Makes Events, sent since last call, readable. Previous Events are dropped.
+         * Buffers capacity is kept, single writer buffer is swapped without copy.
+         *
+         * @thread_safety - sync point, no Send or reads at the same time.
+         * @throws - std::bad_alloc.
+        **/
+        void Swap()
+        {
+            ecs_SpinLock lock( &mBuffersMutex );
+
+            mEvents.clear();
+
+            for ( const ecs_sptr<ThreadBuffer>& threadBuffer : mBuffers )
+            {
+                ecs_vec<T>& events = threadBuffer->mEvents;
+
+                if ( events.empty() )
+                    continue;
+
+                if ( mEvents.empty() )
+                    mEvents.swap( events );
+                else
+                    mEvents.insert( mEvents.end(), events.cbegin(), events.cend() );
+
+                events.clear();
+            }
+        }
+
+        /**
+         * @brief
+         * Drops all Events, sent & readable.
+         *
+         * @thread_safety - sync point, no Send or reads at the same time.
+         * @throws - no exceptions.
+        **/
+        void Clear() noexcept
+        {
+            ecs_SpinLock lock( &mBuffersMutex );
+
+            mEvents.clear();
+
+            for ( const ecs_sptr<ThreadBuffer>& threadBuffer : mBuffers )
+                threadBuffer->mEvents.clear();
+        }
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::EventChannel
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_EventChannelBase = ecs::EventChannelBase;
+template <typename T>
+using ecs_EventChannel = ecs::EventChannel<T>;
+#define ECS_EVENT_CHANNEL_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_EVENT_CHANNEL_HPP
@@ -0,0 +1,425 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_EVENT_COUNTERS_HPP
+#define ECS_EVENT_COUNTERS_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "../types/ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// Include ecs::atomic
+#ifndef ECS_ATOMIC_HPP
+#include "../types/ecs_atomic.hpp"
+#endif // !ECS_ATOMIC_HPP
+
+// Include ecs::time
+#ifndef ECS_TIME_HPP
+#include "../types/ecs_time.hpp"
+#endif // !ECS_TIME_HPP
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Latency histogram buckets. Bucket 0 is less than 1 microsecond, bucket N is [2^(N-1), 2^N) microseconds, last bucket holds longer too. **/
+#ifndef ECS_EVENT_LATENCY_BUCKETS
+#define ECS_EVENT_LATENCY_BUCKETS 16
+#endif // !ECS_EVENT_LATENCY_BUCKETS
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EventStats - Events statistics of Event type or Thread-Type.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API EventStats final
+    {
+        /** Queued Events. **/
+        ecs_uint64_t mQueued;
+
+        /** Sent Events, queued or not. **/
+        ecs_uint64_t mDispatched;
+
+        /** Events, not sent: Thread-Type out of range, removed or replaced by coalescing. **/
+        ecs_uint64_t mDropped;
+
+        /** Queued Events, not sent yet. **/
+        ecs_uint64_t mDepth;
+
+        /** Max queued Events, not sent yet (high-water mark). **/
+        ecs_uint64_t mMaxDepth;
+
+        /** Queue-to-send latency histogram, see #ECS_EVENT_LATENCY_BUCKETS. **/
+        ecs_uint64_t mLatency[ECS_EVENT_LATENCY_BUCKETS];
+
+        /** Time spent in Listeners. **/
+        ecs_nanoseconds mListenersTime;
+    }; /// ecs::EventStats
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EventListenerStats - statistics of Event Listener, for one Event type.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API EventListenerStats final
+    {
+        /** Handled Events. **/
+        ecs_uint64_t mCalls;
+
+        /** Time spent. **/
+        ecs_nanoseconds mTime;
+
+        /** Max time of one call. **/
+        ecs_nanoseconds mMaxTime;
+    }; /// ecs::EventListenerStats
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EventCounters - Events counters of Event type or Thread-Type.
+     *
+     * @thread_safety - thread-safe, relaxed atomics.
+     * @version 0.1
+    **/
+    class ECS_API EventCounters final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Queued Events. **/
+        ecs_atomic<ecs_uint64_t> mQueued;
+
+        /** Sent Events. **/
+        ecs_atomic<ecs_uint64_t> mDispatched;
+
+        /** Dropped Events. **/
+        ecs_atomic<ecs_uint64_t> mDropped;
+
+        /** Queued Events, not sent yet. Only Events queued with time are counted, so it stays valid when counting is toggled. **/
+        ecs_atomic<ecs_int64_t> mDepth;
+
+        /** Max depth. **/
+        ecs_atomic<ecs_int64_t> mMaxDepth;
+
+        /** Latency histogram. **/
+        ecs_atomic<ecs_uint64_t> mLatency[ECS_EVENT_LATENCY_BUCKETS];
+
+        /** Time spent in Listeners, nanoseconds. **/
+        ecs_atomic<ecs_uint64_t> mListenersTime;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        EventCounters(const EventCounters&) = delete;
+        EventCounters& operator=(const EventCounters&) = delete;
+        EventCounters(EventCounters&&) = delete;
+        EventCounters& operator=(EventCounters&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * EventCounters constructor.
+         *
+         * @throws - no exceptions.
+        **/
+        explicit EventCounters() noexcept;
+
+        /**
+         * @brief
+         * EventCounters destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~EventCounters() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns statistics.
+         *
+         * @thread_safety - thread-safe, counters are read one by one.
+         * @throws - no exceptions.
+        **/
+        EventStats getStats() const noexcept;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Counts queued Event.
+         *
+         * @thread_safety - thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Queued() noexcept;
+
+        /**
+         * @brief
+         * Counts sent Event.
+         *
+         * @thread_safety - thread-safe.
+         * @param pDequeued - 'true' if Event is removed from queue.
+         * @throws - no exceptions.
+        **/
+        void Dispatched( const bool pDequeued ) noexcept;
+
+        /**
+         * @brief
+         * Counts dropped queued Event.
+         *
+         * @thread_safety - thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Dropped() noexcept;
+
+        /**
+         * @brief
+         * Removes counted Event from depth, without counting it.
+         * Used when counting is disabled, but Event was queued while it was enabled.
+         *
+         * @thread_safety - thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Dequeued() noexcept;
+
+        /**
+         * @brief
+         * Adds queue-to-send latency to histogram.
+         *
+         * @thread_safety - thread-safe.
+         * @param pLatency - latency.
+         * @throws - no exceptions.
+        **/
+        void addLatency( const ecs_nanoseconds pLatency ) noexcept;
+
+        /**
+         * @brief
+         * Adds time spent in Listener.
+         *
+         * @thread_safety - thread-safe.
+         * @param pTime - time.
+         * @throws - no exceptions.
+        **/
+        void addListenerTime( const ecs_nanoseconds pTime ) noexcept;
+
+        /**
+         * @brief
+         * Resets counters. Depth is kept, max depth is set to it.
+         *
+         * @thread_safety - thread-safe, not atomic as a whole.
+         * @throws - no exceptions.
+        **/
+        void Reset() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::EventCounters
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EventListenerCounters - counters of Event Listener, for one Event type.
+     *
+     * @thread_safety - thread-safe, relaxed atomics.
+     * @version 0.1
+    **/
+    class ECS_API EventListenerCounters final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Handled Events. **/
+        ecs_atomic<ecs_uint64_t> mCalls;
+
+        /** Time spent, nanoseconds. **/
+        ecs_atomic<ecs_uint64_t> mTime;
+
+        /** Max time of one call, nanoseconds. **/
+        ecs_atomic<ecs_uint64_t> mMaxTime;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        EventListenerCounters(const EventListenerCounters&) = delete;
+        EventListenerCounters& operator=(const EventListenerCounters&) = delete;
+        EventListenerCounters(EventListenerCounters&&) = delete;
+        EventListenerCounters& operator=(EventListenerCounters&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * EventListenerCounters constructor.
+         *
+         * @throws - no exceptions.
+        **/
+        explicit EventListenerCounters() noexcept;
+
+        /**
+         * @brief
+         * EventListenerCounters destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~EventListenerCounters() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns statistics.
+         *
+         * @thread_safety - thread-safe.
+         * @throws - no exceptions.
+        **/
+        EventListenerStats getStats() const noexcept;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Counts handled Event.
+         *
+         * @thread_safety - thread-safe.
+         * @param pTime - time spent.
+         * @throws - no exceptions.
+        **/
+        void Called( const ecs_nanoseconds pTime ) noexcept;
+
+        /**
+         * @brief
+         * Resets counters.
+         *
+         * @thread_safety - thread-safe, not atomic as a whole.
+         * @throws - no exceptions.
+        **/
+        void Reset() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::EventListenerCounters
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_EventStats = ecs::EventStats;
+using ecs_EventListenerStats = ecs::EventListenerStats;
+using ecs_EventCounters = ecs::EventCounters;
+using ecs_EventListenerCounters = ecs::EventListenerCounters;
+#define ECS_EVENT_COUNTERS_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_EVENT_COUNTERS_HPP
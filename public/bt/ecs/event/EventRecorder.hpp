@@ -0,0 +1,416 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_EVENT_RECORDER_HPP
+#define ECS_EVENT_RECORDER_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "../types/ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// Include ecs::memory
+#ifndef ECS_MEMORY_HPP
+#include "../types/ecs_memory.hpp"
+#endif // !ECS_MEMORY_HPP
+
+// Include ecs::mutex
+#ifndef ECS_MUTEX_HPP
+#include "../types/ecs_mutex.hpp"
+#endif // ECS_MUTEX_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// Include ecs::map
+#ifndef ECS_MAP_HPP
+#include "../types/ecs_map.hpp"
+#endif // !ECS_MAP_HPP
+
+// ===========================================================
+// FORWARD-DECLARATION
+// ===========================================================
+
+// Forward-Declare ecs::IEvent
+#ifndef ECS_I_EVENT_DECL
+#define ECS_I_EVENT_DECL
+namespace ecs { class IEvent; }
+using ecs_IEvent = ecs::IEvent;
+#endif // !ECS_I_EVENT_DECL
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EventCodec - serialization of Event type payload.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API EventCodec final
+    {
+        /** Appends Event payload to output, or null to record Event without payload. **/
+        void (*mWrite)( const ecs_IEvent& pEvent, ecs_vec<ecs_uint8_t>& pOutput );
+
+        /** Creates Event from payload, or null to skip Event on replay. **/
+        ecs_sptr<ecs_IEvent> (*mRead)( const ecs_uint8_t* const pData, const ecs_size_t pSize );
+    }; /// ecs::EventCodec
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EventRecorder - binary log of sent & queued Events, for replay.
+     *
+     * While set to ecs::EventsManager (#ecs::EventsManager::setRecorder),
+     * each Event passed to sendEvent or queueEvent is appended as record:
+     * frame, Type-ID, Thread-Type, send-mode & payload written by codec of its type.
+     * Delayed & periodic Events are recorded as queued, when their timers fire,
+     * so replay doesn't depend on timing.
+     *
+     * Log is "BTEL" & version byte, then records:
+     * frame delta (varint), Type-ID (varint), Thread-Type (byte),
+     * 1 if sent now or 0 if queued (byte), payload size (varint), payload.
+     *
+     * Replay feeds records of each frame back into current ecs::EventsManager,
+     * without waiting, so recorded session can be profiled & benchmarked.
+     *
+     * @thread_safety - #Record & #NextFrame from any thread (thread-lock used),
+     * replay methods from one thread, not while recording.
+     * @version 0.1
+    **/
+    class ECS_API EventRecorder final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /** Event Pointer-type. **/
+        using event_ptr = ecs_sptr<ecs_IEvent>;
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Log format version. **/
+        static constexpr const ecs_uint8_t VERSION = 1;
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Log header size: magic & version. **/
+        static constexpr const ecs_size_t HEADER_SIZE = 5;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Codecs, by Event Type-ID. **/
+        ecs_hash_map<ecs_TypeID, EventCodec> mCodecs;
+
+        /** Log. **/
+        ecs_vec<ecs_uint8_t> mData;
+
+        /** Payload being written. **/
+        ecs_vec<ecs_uint8_t> mPayload;
+
+        /** Current frame. **/
+        ecs_uint64_t mFrame;
+
+        /** Frame of last record. **/
+        ecs_uint64_t mRecordFrame;
+
+        /** Records count. **/
+        ecs_size_t mCount;
+
+        /** Replay position in log. **/
+        ecs_size_t mReadPos;
+
+        /** Frame of next replayed record. **/
+        ecs_uint64_t mReadFrame;
+
+        /** Mutex. **/
+        ecs_Mutex mMutex;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Appends unsigned LEB128 value.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pValue - value.
+         * @throws - std::bad_alloc.
+        **/
+        void writeVarint( ecs_uint64_t pValue );
+
+        /**
+         * @brief
+         * Reads unsigned LEB128 value at replay position.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pOutput - value.
+         * @return - 'false' if log is truncated.
+         * @throws - no exceptions.
+        **/
+        bool readVarint( ecs_uint64_t& pOutput ) noexcept;
+
+        /**
+         * @brief
+         * Writes log header, if log is empty.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - std::bad_alloc.
+        **/
+        void writeHeader();
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        EventRecorder(const EventRecorder&) = delete;
+        EventRecorder& operator=(const EventRecorder&) = delete;
+        EventRecorder(EventRecorder&&) = delete;
+        EventRecorder& operator=(EventRecorder&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * EventRecorder constructor.
+         *
+         * @throws - no exceptions.
+        **/
+        explicit EventRecorder() noexcept;
+
+        /**
+         * @brief
+         * EventRecorder destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~EventRecorder() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Sets codec of Event type. Required to record payload & to replay Events of type.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pType - Event Type-ID.
+         * @param pCodec - codec.
+         * @throws - std::bad_alloc.
+        **/
+        void setCodec( const ecs_TypeID pType, const EventCodec& pCodec );
+
+        /**
+         * @brief
+         * Returns log.
+         *
+         * @thread_safety - not thread-safe, stop recording first.
+         * @throws - no exceptions.
+        **/
+        const ecs_vec<ecs_uint8_t>& getData() const noexcept
+        { return mData; }
+
+        /**
+         * @brief
+         * Returns recorded Events count.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t Count() const noexcept
+        { return mCount; }
+
+        /**
+         * @brief
+         * Returns current frame.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_uint64_t getFrame() const noexcept
+        { return mFrame; }
+
+        /**
+         * @brief
+         * Returns 'true' if replay has records left.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        bool hasRecords() const noexcept
+        { return mReadPos < mData.size(); }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Appends Event record.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pEvent - Event.
+         * @param pThread - Thread-Type.
+         * @param pSent - 'true' if sent now, 'false' if queued.
+         * @throws - std::bad_alloc, codec exceptions.
+        **/
+        void Record( const ecs_IEvent& pEvent, const ecs_uint8_t pThread, const bool pSent );
+
+        /**
+         * @brief
+         * Starts next frame. Call once per frame, on frame boundary.
+         *
+         * @thread_safety - thread-lock used.
+         * @throws - no exceptions.
+        **/
+        void NextFrame() noexcept;
+
+        /**
+         * @brief
+         * Replaces log with recorded one & rewinds replay.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pData - log.
+         * @param pSize - log size.
+         * @return - 'false' if log has no valid header, log is cleared.
+         * @throws - std::bad_alloc.
+        **/
+        bool Load( const ecs_uint8_t* const pData, const ecs_size_t pSize );
+
+        /**
+         * @brief
+         * Rewinds replay to first record.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Rewind() noexcept;
+
+        /**
+         * @brief
+         * Sends or queues Events of next recorded frame, into current ecs::EventsManager.
+         * Events of types without codec read function are skipped.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pThreads - Thread-Types with queued Events output (added once), or null.
+         * @return - 'false' if no records left or log is truncated.
+         * @throws - can throw exception (codecs, Listeners).
+        **/
+        bool ReplayFrame( ecs_vec<ecs_uint8_t>* const pThreads = nullptr );
+
+        /**
+         * @brief
+         * Replays all frames at full speed: each frame Events are sent or queued,
+         * then queued Events are sent by ecs::EventsManager::Update of their Thread-Types.
+         *
+         * @thread_safety - not thread-safe, Events are sent from this thread.
+         * @return - replayed frames count.
+         * @throws - can throw exception (codecs, Listeners).
+        **/
+        ecs_size_t Replay();
+
+        /**
+         * @brief
+         * Clears log & frames.
+         *
+         * @thread_safety - thread-lock used.
+         * @throws - no exceptions.
+        **/
+        void Clear() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::EventRecorder
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_EventCodec = ecs::EventCodec;
+using ecs_EventRecorder = ecs::EventRecorder;
+#define ECS_EVENT_RECORDER_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_EVENT_RECORDER_HPP
@@ -64,16 +64,31 @@
 #include "../types/ecs_map.hpp"
 #endif // !ECS_MAP_HPP
 
-// Include ecs::deque
-#ifndef ECS_DEQUE_HPP
-#include "../types/ecs_queue.hpp"
-#endif // !ECS_DEQUE_HPP
+// Include ecs::EventsQueue
+#ifndef ECS_EVENTS_QUEUE_HPP
+#include "EventsQueue.hpp"
+#endif // !ECS_EVENTS_QUEUE_HPP
 
 // Include ecs::vector
 #ifndef ECS_VECTOR_HPP
 #include "../types/ecs_vector.hpp"
 #endif // !ECS_VECTOR_HPP
 
+// Include ecs::time
+#ifndef ECS_TIME_HPP
+#include "../types/ecs_time.hpp"
+#endif // !ECS_TIME_HPP
+
+// Include ecs::TimerWheel
+#ifndef ECS_TIMER_WHEEL_HPP
+#include "TimerWheel.hpp"
+#endif // !ECS_TIMER_WHEEL_HPP
+
+// Include ecs::EventCounters
+#ifndef ECS_EVENT_COUNTERS_HPP
+#include "EventCounters.hpp"
+#endif // !ECS_EVENT_COUNTERS_HPP
+
 // Include ecs::atomic
 #ifndef ECS_ATOMIC_HPP
 #include "../types/ecs_atomic.hpp"
@@ -97,6 +112,42 @@ namespace ecs { class IEventListener; }
 using ecs_IEventListener = ecs::IEventListener;
 #endif // !ECS_I_EVENT_LISTENER_DECL
 
+// Forward-Declare ecs::EventRecorder
+#ifndef ECS_EVENT_RECORDER_DECL
+#define ECS_EVENT_RECORDER_DECL
+namespace ecs { class EventRecorder; }
+using ecs_EventRecorder = ecs::EventRecorder;
+#endif // !ECS_EVENT_RECORDER_DECL
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Max Thread-Types with queued Events. Thread-Types must be less. **/
+#ifndef ECS_MAX_EVENT_THREADS
+#define ECS_MAX_EVENT_THREADS 16
+#endif // !ECS_MAX_EVENT_THREADS
+
+/** Max Event types with Listeners. Event Type-IDs must be less. **/
+#ifndef ECS_MAX_EVENT_TYPES
+#define ECS_MAX_EVENT_TYPES 1024
+#endif // !ECS_MAX_EVENT_TYPES
+
+/** Priority lanes per Thread-Type, lane 0 is sent first. **/
+#ifndef ECS_EVENT_LANES
+#define ECS_EVENT_LANES 4
+#endif // !ECS_EVENT_LANES
+
+/** Lane of Event types without priority. **/
+#ifndef ECS_EVENT_DEFAULT_LANE
+#define ECS_EVENT_DEFAULT_LANE 1
+#endif // !ECS_EVENT_DEFAULT_LANE
+
+/** Updates in a row, lane can have Events but send none, before it is sent first. **/
+#ifndef ECS_EVENT_STARVATION_UPDATES
+#define ECS_EVENT_STARVATION_UPDATES 8
+#endif // !ECS_EVENT_STARVATION_UPDATES
+
 // ===========================================================
 // TYPES
 // ===========================================================
@@ -106,6 +157,40 @@ namespace ecs
 
     // -----------------------------------------------------------
 
+    /**
+     * @brief
+     * EEventCoalescing - how queued Events of type are coalesced.
+     *
+     * @version 0.1
+    **/
+    BT_ENUM_TYPE ECS_API EEventCoalescing : ecs_uint8_t
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_ENUM
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Each queued Event is sent. **/
+        None = 0,
+        /** Only latest queued Event of type is sent. **/
+        Type = 1,
+        /** Only latest queued Event of type per target (ecs::IEvent::getTargetID) is sent. **/
+        Target = 2
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::EEventCoalescing
+
+    // -----------------------------------------------------------
+
     /**
      * @brief
      * EventsManager - Events Manager.
@@ -136,26 +221,88 @@ namespace ecs
         /** Event Pointer-type. **/
         using event_ptr = ecs_sptr<ecs_IEvent>;
 
-        /** Events queue container. **/
-        using events_queue = ecs_deque<event_ptr>;
-
-        /** Events Queues Storage. **/
-        using events_queues_storage = ecs_AsyncStorage<events_queue>;
-
-        /** Events Typed map. **/
-        using events_queues_map = ecs_map<unsigned char, events_queues_storage>;
-
         /** Event Listener Pointer. **/
         using event_listener = ecs_sptr<ecs_IEventListener>;
 
+        /**
+         * @brief
+         * Subscribed Event Listener.
+        **/
+        struct ListenerEntry final
+        {
+            /** Event Listener. **/
+            event_listener mListener;
+
+            /** Counters, shared by copies of Event Listeners. **/
+            ecs_sptr<ecs_EventListenerCounters> mCounters;
+        };
+
         /** Event Listeners vector. **/
-        using event_listeners_vector = ecs_vec<event_listener>;
+        using event_listeners_vector = ecs_vec<ListenerEntry>;
 
-        /** Events Listeners Storage. **/
-        using event_listeners_storage = ecs_AsyncStorage<event_listeners_vector>;
+        /** Immutable Event Listeners, replaced on each change (copy-on-write). **/
+        using event_listeners_ptr = const event_listeners_vector*;
 
-        /** Events Listeners Typed map. **/
-        using event_listeners_map = ecs_map<ecs_TypeID, event_listeners_storage>;
+        /**
+         * @brief
+         * Reader of published Event Listeners & recorder.
+         * Replaced ones are retired & freed only when no Reader is alive,
+         * so loaded pointers stay valid until Reader is destroyed.
+        **/
+        class Reader final
+        {
+
+            /** Active readers counter. **/
+            ecs_atomic<ecs_size_t>& mReaders;
+
+            Reader(const Reader&) = delete;
+            Reader& operator=(const Reader&) = delete;
+
+        public:
+
+            /**
+             * @brief
+             * Reader constructor.
+             *
+             * @param pReaders - active readers counter.
+             * @throws - no exceptions.
+            **/
+            explicit Reader( ecs_atomic<ecs_size_t>& pReaders ) noexcept
+                : mReaders( pReaders )
+            { mReaders.fetch_add( 1, std::memory_order_seq_cst ); }
+
+            /**
+             * @brief
+             * Reader destructor.
+             *
+             * @throws - no exceptions.
+            **/
+            ~Reader() noexcept
+            { mReaders.fetch_sub( 1, std::memory_order_release ); }
+
+        };
+
+        /**
+         * @brief
+         * Events queues of Thread-Type.
+        **/
+        struct ThreadEvents final
+        {
+            /** Priority lanes, 0 is sent first. **/
+            ecs_EventsQueue mLanes[ECS_EVENT_LANES];
+
+            /** Max Events, sent from each lane per Update, 0 for no limit. **/
+            ecs_atomic<ecs_size_t> mBudgets[ECS_EVENT_LANES];
+
+            /** Updates in a row, each lane had Events but sent none (consumer). **/
+            ecs_size_t mStarvedUpdates[ECS_EVENT_LANES];
+
+            /** Type-IDs of dropped Events, reused by each Update (consumer). **/
+            ecs_vec<ecs_TypeID> mDropped;
+
+            /** Events counters. **/
+            ecs_EventCounters mCounters;
+        };
 
         // ===========================================================
         // FIELDS
@@ -173,18 +320,54 @@ namespace ecs
         /** IEvents IDs Mutex. **/
         ecs_Mutex mIDMutex;
 
-        /** Events queue. **/
-        events_queues_map mEventsByThread;
+        /** Events queues, indexed by Thread-Type. **/
+        ThreadEvents mEventsByThread[ECS_MAX_EVENT_THREADS];
+
+        /** Priority lane of each Event type. **/
+        ecs_atomic<ecs_uint8_t> mEventLanes[ECS_MAX_EVENT_TYPES];
+
+        /** ecs::EEventCoalescing of each Event type. **/
+        ecs_atomic<ecs_uint8_t> mEventCoalescing[ECS_MAX_EVENT_TYPES];
+
+        /** Delayed & periodic Events. **/
+        ecs_TimerWheel mTimers;
 
-        /** Events Mutex. **/
-        ecs_Mutex mEventsMutex;
+        /** Scheduled timers count, to skip #mTimersMutex when 0. **/
+        ecs_atomic<ecs_size_t> mTimersCount;
 
-        /** Event Listeners. **/
-        event_listeners_map mEventListeners;
+        /** Timers Mutex. **/
+        ecs_Mutex mTimersMutex;
 
-        /** Event Listeners Mutex. **/
+        /** Event Listeners, indexed by Event Type-ID. Owned, replaced ones are retired. **/
+        ecs_atomic<event_listeners_ptr> mEventListeners[ECS_MAX_EVENT_TYPES];
+
+        /** Event Listeners & recorder writers Mutex, guards retired ones. **/
         ecs_Mutex mEventListenersMutex;
 
+        /** Replaced Event Listeners, freed when no Reader is alive. **/
+        ecs_vec<event_listeners_ptr> mRetiredListeners;
+
+        /** Replaced recorders, released when no Reader is alive. **/
+        ecs_vec<ecs_sptr<ecs_EventRecorder>> mRetiredRecorders;
+
+        /** Retired flag, to skip #mEventListenersMutex in #Update when nothing is retired. **/
+        ecs_atomic<bool> mRetired;
+
+        /** Alive Readers count. **/
+        ecs_atomic<ecs_size_t> mReaders;
+
+        /** Statistics enabled flag. **/
+        ecs_atomic<bool> mStatsEnabled;
+
+        /** Events counters, indexed by Event Type-ID. **/
+        ecs_EventCounters mEventCounters[ECS_MAX_EVENT_TYPES];
+
+        /** Recorder of sent & queued Events, or null. Guarded by #mEventListenersMutex. **/
+        ecs_sptr<ecs_EventRecorder> mRecorder;
+
+        /** #mRecorder, loaded by Readers. **/
+        ecs_atomic<ecs_EventRecorder*> mRecorderPtr;
+
         // ===========================================================
         // GETTERS & SETTERS
         // ===========================================================
@@ -200,42 +383,68 @@ namespace ecs
 
         /**
          * @brief
-         * Returns Events queue for thread.
+         * Returns Events queues for thread.
          *
-         * @thread_safety - thread-locks used.
+         * @thread_safety - thread-safe, queues are never moved.
          * @param pThread - Thread-Type. 0 for default.
-         * @return - Events queue.
-         * @throws - can throw exception.
+         * @return - Events queues, or null if Thread-Type is not less than #ECS_MAX_EVENT_THREADS.
+         * @throws - no exceptions.
         **/
-        events_queues_storage& getEventsQueue( const unsigned char pThread );
+        ThreadEvents* getEventsQueue( const unsigned char pThread ) noexcept;
 
         /**
          * @brief
-         * Returns Event Listeners container.
+         * Returns snapshot of Event Listeners, not affected by later changes.
          *
-         * @thread_safety - thread-lock used.
+         * @thread_safety - thread-safe (atomic load), Reader must be alive while snapshot is used.
          * @param pType - Event Type-ID.
-         * @throws - can throw exception.
+         * @return - Event Listeners, or null if none or Type-ID is not less than #ECS_MAX_EVENT_TYPES.
+         * @throws - no exceptions.
         **/
-        event_listeners_storage& getEventListeners( const ecs_TypeID pType );
+        event_listeners_ptr getEventListeners( const ecs_TypeID pType ) const noexcept;
 
         /**
          * @brief
-         * Returns next Event in queue, or null.
+         * Publishes Event Listeners, previous ones are retired.
          *
-         * @thread_safety - thread-locks used.
-         * @throws - can throw exception (mutex).
+         * @thread_safety - #mEventListenersMutex must be locked.
+         * @param pType - Event Type-ID.
+         * @param pListeners - new Event Listeners, owned.
+         * @throws - std::bad_alloc, pListeners are not published then.
         **/
-        static ECS_API event_ptr getNextEvent( events_queues_storage& eventsStorage );
+        void setEventListeners( const ecs_TypeID pType, ecs_uptr<event_listeners_vector> pListeners );
 
         /**
          * @brief
-         * Returns next Event Listener, or null.
+         * Returns Events counters of Event type.
          *
-         * @thread_safety - thread-locks used.
-         * @throws - can throw exception (mutex).
+         * @thread_safety - thread-safe, counters are never moved.
+         * @param pType - Event Type-ID.
+         * @return - Events counters, or null if Type-ID is not less than #ECS_MAX_EVENT_TYPES.
+         * @throws - no exceptions.
+        **/
+        ecs_EventCounters* getEventCounters( const ecs_TypeID pType ) noexcept;
+
+        /**
+         * @brief
+         * Copies, modifies & publishes Event Listeners.
+         *
+         * @thread_safety - thread-lock used, readers are not blocked.
+         * @param pType - Event Type-ID.
+         * @param pListener - Event Listener.
+         * @param pSubscribe - 'true' to add, 'false' to remove.
+         * @throws - std::bad_alloc.
+        **/
+        void updateEventListeners( const ecs_TypeID pType, event_listener& pListener, const bool pSubscribe );
+
+        /**
+         * @brief
+         * Frees retired Event Listeners & recorders, if no Reader is alive.
+         *
+         * @thread_safety - #mEventListenersMutex must be locked.
+         * @throws - no exceptions.
         **/
-        static ECS_API event_listener getNextEventListener( ecs_size_t& pIdx, event_listeners_storage& listenersStorage );
+        void Reclaim() noexcept;
 
         // ===========================================================
         // METHODS
@@ -244,8 +453,9 @@ namespace ecs
         /**
          * @brief
          * Handle Event.
+         * Listeners, subscribed or unsubscribed while handling, are applied to next Event.
          *
-         * @thread_safety - thread-locks used.
+         * @thread_safety - lock-free, Listeners snapshot used (see Reader).
          * @param pEvent - Event to send.
          * @param pAsync - 'true' if Async-mode.
          * @param pThread - thread-type, default is 0 to via update-thread.
@@ -256,15 +466,64 @@ namespace ecs
 
         /**
          * @brief
-         * Removes Events from Queue.
+         * Sends Events from lane, requeues repeatable Events.
          *
-         * @thread_safety - thread-locks used.
-         * @param eventsStorage - Events queue storage.
-         * @param pType - Event Type-ID.
-         * @param pID - Event ID. Default is #ECS_INVALID_OBJECT_ID to remove all with Type-ID.
-         * @throws - can throw exception (mutex).
+         * @thread_safety - consumer thread only.
+         * @param pLane - lane.
+         * @param pCount - max Events to send.
+         * @param pThread - Thread-Type.
+         * @param pDeadline - time to stop, if pTimed is 'true'.
+         * @param pTimed - 'true' if pDeadline is used.
+         * @return - sent Events count.
+         * @throws - can throw exception.
+        **/
+        ecs_size_t sendEvents( ecs_EventsQueue& pLane, const ecs_size_t pCount, const ecs_uint8_t pThread, const ecs_time_point pDeadline, const bool pTimed );
+
+        /**
+         * @brief
+         * Queues Event into lane of its type, with coalescing key of its type.
+         *
+         * @thread_safety - thread-safe, lock-free.
+         * @param pEvent - Event.
+         * @param pThread - Thread-Type.
+         * @throws - std::bad_alloc.
+        **/
+        void pushEvent( const event_ptr& pEvent, const ecs_uint8_t pThread );
+
+        /**
+         * @brief
+         * Queues due timers Events into their threads.
+         *
+         * @thread_safety - thread-lock used.
+         * @throws - std::bad_alloc.
+        **/
+        void fireTimers();
+
+        /**
+         * @brief
+         * Schedules Event.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pEvent - Event.
+         * @param pThread - Thread-Type.
+         * @param pDue - due tick.
+         * @param pPeriod - period in ticks, 0 for one-shot.
+         * @return - Timer ID, or #ECS_INVALID_TIMER_ID if Thread-Type is out of range or one-shot Event is due & queued.
+         * @throws - std::bad_alloc.
+        **/
+        ecs_TimerID scheduleEvent( const event_ptr& pEvent, const ecs_uint8_t pThread, const ecs_uint64_t pDue, const ecs_uint64_t pPeriod );
+
+        /**
+         * @brief
+         * Records Event, if recorder is set.
+         *
+         * @thread_safety - thread-safe, recorder uses thread-lock.
+         * @param pEvent - Event.
+         * @param pThread - Thread-Type.
+         * @param pSent - 'true' if sent now, 'false' if queued.
+         * @throws - std::bad_alloc, codec exceptions.
         **/
-        static ECS_API void removeEvents( events_queues_storage& eventsStorage, const ecs_TypeID pType, const ecs_ObjectID pID = ECS_INVALID_OBJECT_ID );
+        void recordEvent( const event_ptr& pEvent, const ecs_uint8_t pThread, const bool pSent );
 
         // ===========================================================
         // DELETED
@@ -353,7 +612,8 @@ namespace ecs
          * @brief
          * Send Event now.
          *
-         * @thread_safety - thread-locks used.
+         * @thread_safety - lock-free, Listeners snapshot used.
+         * (?) Senders share one atomic Readers counter.
          * @param pEvent - Event to send.
          * @param pThread - thread-type, default is 0 to via update-thread.
          * @return 0 to continue, 1 if handled to stop, -1 if error.
@@ -365,7 +625,7 @@ namespace ecs
          * @brief
          * Send delayed Event (Async-mode).
          *
-         * @thread_safety - thread-locks used.
+         * @thread_safety - thread-safe, lock-free.
          * @param pEvent - Event to queue.
          * @param pThread - thread-type, default is 0 to via update-thread.
          * @throws - can throw exception.
@@ -374,9 +634,108 @@ namespace ecs
 
         /**
          * @brief
-         * Removes all Events of the given Type.
+         * Queues Event at time point, with #ECS_TIMER_TICK precision.
          *
-         * @thread_safety - thread-locks used.
+         * Event is queued by first #Update (of any thread) after time point,
+         * & sent by next #Update of pThread.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pEvent - Event to queue.
+         * @param pTime - time point, past time queues Event now.
+         * @param pThread - thread-type, default is 0 to via update-thread.
+         * @return - Timer ID to cancel, or #ECS_INVALID_TIMER_ID if Event is queued now.
+         * @throws - can throw exception.
+        **/
+        static ECS_API ecs_TimerID queueEventAt( event_ptr& pEvent, const ecs_time_point pTime, const ecs_uint8_t pThread = 0 );
+
+        /**
+         * @brief
+         * Queues Event after delay, and then each period if set.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pEvent - Event to queue.
+         * @param pDelay - delay.
+         * @param pThread - thread-type, default is 0 to via update-thread.
+         * @param pPeriod - period of repeating, 0 for one-shot.
+         * @return - Timer ID to cancel, or #ECS_INVALID_TIMER_ID if one-shot Event is queued now.
+         * @throws - can throw exception.
+        **/
+        static ECS_API ecs_TimerID queueEventAfter( event_ptr& pEvent, const ecs_microseconds pDelay, const ecs_uint8_t pThread = 0, const ecs_microseconds pPeriod = ecs_microseconds::zero() );
+
+        /**
+         * @brief
+         * Cancels delayed or periodic Event. Already queued Event is not removed.
+         *
+         * @thread_safety - thread-lock used.
+         * @param pTimer - Timer ID.
+         * @return - 'false' if timer already fired (one-shot) or cancelled.
+         * @throws - no exceptions.
+        **/
+        static ECS_API bool CancelEvent( const ecs_TimerID pTimer ) noexcept;
+
+        /**
+         * @brief
+         * Sets priority lane of Event type, used for Events queued later.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @param pType - Event Type-ID.
+         * @param pLane - lane, less than #ECS_EVENT_LANES, 0 is sent first.
+         * @throws - no exceptions.
+        **/
+        static ECS_API void setEventPriority( const ecs_TypeID pType, const ecs_uint8_t pLane ) noexcept;
+
+        /**
+         * @brief
+         * Returns priority lane of Event type.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @param pType - Event Type-ID.
+         * @throws - no exceptions.
+        **/
+        static ECS_API ecs_uint8_t getEventPriority( const ecs_TypeID pType ) noexcept;
+
+        /**
+         * @brief
+         * Sets coalescing of Event type, used for Events queued later.
+         *
+         * Queued Event of coalescing type replaces pending Event with the same key
+         * (in its place), instead of appending, so only latest one is sent.
+         * Use for per-frame idempotent Events: draw, resize, settings changed, etc.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @param pType - Event Type-ID.
+         * @param pCoalescing - coalescing.
+         * @throws - no exceptions.
+        **/
+        static ECS_API void setEventCoalescing( const ecs_TypeID pType, const EEventCoalescing pCoalescing ) noexcept;
+
+        /**
+         * @brief
+         * Returns coalescing of Event type.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @param pType - Event Type-ID.
+         * @throws - no exceptions.
+        **/
+        static ECS_API EEventCoalescing getEventCoalescing( const ecs_TypeID pType ) noexcept;
+
+        /**
+         * @brief
+         * Sets max Events, sent from lane per #Update.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @param pThread - Thread-Type.
+         * @param pLane - lane.
+         * @param pMaxEvents - max Events, 0 for no limit.
+         * @throws - no exceptions.
+        **/
+        static ECS_API void setLaneBudget( const ecs_uint8_t pThread, const ecs_uint8_t pLane, const ecs_size_t pMaxEvents ) noexcept;
+
+        /**
+         * @brief
+         * Removes all Events of the given Type, queued before this call.
+         *
+         * @thread_safety - thread-safe, lock-free. Applied on next #Update.
          * @param pType - Event Type-ID.
          * @param pThread - Thread-Type, default is 0 to remove from all Threads.
          * @throws - can throw exception (mutex).
@@ -387,7 +746,7 @@ namespace ecs
          * @brief
          * Removes specific Event from queue.
          *
-         * @thread_safety - thread-locks used.
+         * @thread_safety - thread-safe, lock-free. Applied on next #Update.
          * @param pType - Event Type-ID.
          * @param pID - Event ID.
          * @param pThread - Thread-Type.
@@ -397,13 +756,25 @@ namespace ecs
 
         /**
          * @brief
-         * Send all queued Events.
+         * Send queued Events.
          *
-         * @thread_safety - thread-locks used.
+         * Events, queued before this call, are taken as one batch,
+         * each of them is sent at most once. Events, queued while sending,
+         * and repeatable Events are sent on next call.
+         * Events, not sent due to budget, are sent first on next call.
+         *
+         * Lanes are sent in priority order, each up to own budget (#setLaneBudget).
+         * Lane, which sent no Events for #ECS_EVENT_STARVATION_UPDATES calls in a row,
+         * is sent before others.
+         *
+         * @thread_safety - only one thread per Thread-Type.
          * @param pThread - Thread-Type.
+         * @param pMaxEvents - max Events to send, 0 for no limit.
+         * @param pMaxTime - time budget, checked after each Event, 0 for no limit.
+         * @return - Events left in queue.
          * @throws - can throw exception. All errors collected & reported.
         **/
-        static ECS_API void Update( const ecs_uint8_t pThread );
+        static ECS_API ecs_size_t Update( const ecs_uint8_t pThread, const ecs_size_t pMaxEvents = 0, const ecs_microseconds pMaxTime = ecs_microseconds::zero() );
 
         /**
          * @brief
@@ -426,6 +797,91 @@ namespace ecs
         **/
         static ECS_API void releaseEventID(const ecs_TypeID pType, const ecs_ObjectID pID) ECS_NOEXCEPT;
 
+        /**
+         * @brief
+         * Enables or disables Events statistics.
+         *
+         * Disabled by default: enabled statistics read clock on each queued Event
+         * & around each Listener call. Depth counts only Events queued while enabled.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @param pEnabled - 'true' to enable.
+         * @throws - no exceptions.
+        **/
+        static ECS_API void setStatsEnabled( const bool pEnabled ) noexcept;
+
+        /**
+         * @brief
+         * Returns 'true' if Events statistics are enabled.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @throws - no exceptions.
+        **/
+        static ECS_API bool isStatsEnabled() noexcept;
+
+        /**
+         * @brief
+         * Returns statistics of Event type.
+         *
+         * @thread_safety - thread-safe, counters are read one by one.
+         * @param pType - Event Type-ID.
+         * @return - statistics, zero if Type-ID is not less than #ECS_MAX_EVENT_TYPES.
+         * @throws - no exceptions.
+        **/
+        static ECS_API ecs_EventStats getEventStats( const ecs_TypeID pType ) noexcept;
+
+        /**
+         * @brief
+         * Returns statistics of Thread-Type queues.
+         *
+         * @thread_safety - thread-safe, counters are read one by one.
+         * @param pThread - Thread-Type.
+         * @return - statistics, zero if Thread-Type is not less than #ECS_MAX_EVENT_THREADS.
+         * @throws - no exceptions.
+        **/
+        static ECS_API ecs_EventStats getThreadStats( const ecs_uint8_t pThread ) noexcept;
+
+        /**
+         * @brief
+         * Returns statistics of Event Listener, subscribed to Event type.
+         *
+         * @thread_safety - thread-safe, Listeners snapshot used.
+         * @param pType - Event Type-ID.
+         * @param pListener - Event Listener.
+         * @return - statistics, zero if Listener is not subscribed.
+         * @throws - no exceptions.
+        **/
+        static ECS_API ecs_EventListenerStats getListenerStats( const ecs_TypeID pType, const event_listener& pListener ) noexcept;
+
+        /**
+         * @brief
+         * Resets Events statistics. Current depth is kept.
+         *
+         * @thread_safety - thread-safe, not atomic as a whole.
+         * @throws - no exceptions.
+        **/
+        static ECS_API void ResetStats() noexcept;
+
+        /**
+         * @brief
+         * Sets recorder of Events, passed to #sendEvent & #queueEvent, or queued by timers.
+         * Previous recorder is released when no Event is being recorded by it.
+         *
+         * @thread_safety - thread-lock used, recording is lock-free.
+         * @param pRecorder - recorder, or null to stop recording.
+         * @throws - std::bad_alloc.
+        **/
+        static ECS_API void setRecorder( ecs_sptr<ecs_EventRecorder> pRecorder );
+
+        /**
+         * @brief
+         * Returns recorder of Events, or null.
+         *
+         * @thread_safety - thread-lock used.
+         * @throws - no exceptions.
+        **/
+        static ECS_API ecs_sptr<ecs_EventRecorder> getRecorder() noexcept;
+
         /**
          * @brief
          * Initialize EventsManager instance.
@@ -452,6 +908,7 @@ namespace ecs
 
 } /// ecs
 
+using ecs_EEventCoalescing = ecs::EEventCoalescing;
 using ecs_Events = ecs::EventsManager;
 #define ECS_EVENTS_MANAGER_DECL
 
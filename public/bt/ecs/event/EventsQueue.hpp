@@ -0,0 +1,397 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_EVENTS_QUEUE_HPP
+#define ECS_EVENTS_QUEUE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::ids
+#ifndef ECS_IDS_HPP
+#include "../types/ecs_ids.hpp"
+#endif // !ECS_IDS_HPP
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "../types/ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// Include ecs::memory
+#ifndef ECS_MEMORY_HPP
+#include "../types/ecs_memory.hpp"
+#endif // !ECS_MEMORY_HPP
+
+// Include ecs::atomic
+#ifndef ECS_ATOMIC_HPP
+#include "../types/ecs_atomic.hpp"
+#endif // !ECS_ATOMIC_HPP
+
+// Include ecs::deque
+#ifndef ECS_DEQUE_HPP
+#include "../types/ecs_queue.hpp"
+#endif // !ECS_DEQUE_HPP
+
+// Include ecs::map
+#ifndef ECS_MAP_HPP
+#include "../types/ecs_map.hpp"
+#endif // !ECS_MAP_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// Include ecs::time
+#ifndef ECS_TIME_HPP
+#include "../types/ecs_time.hpp"
+#endif // !ECS_TIME_HPP
+
+// ===========================================================
+// FORWARD-DECLARATION
+// ===========================================================
+
+// Forward-Declare ecs::IEvent
+#ifndef ECS_I_EVENT_DECL
+#define ECS_I_EVENT_DECL
+namespace ecs { class IEvent; }
+using ecs_IEvent = ecs::IEvent;
+#endif // !ECS_I_EVENT_DECL
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * EventsQueue - Events of one Thread-Type.
+     *
+     * Multiple-producers single-consumer linked queue (D. Vyukov):
+     * producers link node with one atomic exchange & never wait,
+     * consumer thread drains published nodes into own pending Events.
+     * Removals are queued as marker nodes, so they apply only
+     * to Events queued before them.
+     * Events with coalescing key replace pending Event with the same key,
+     * instead of appending.
+     *
+     * @thread_safety - #Push & #Remove from any thread,
+     * other methods from consumer (update) thread only.
+     * @version 0.1
+    **/
+    class ECS_API EventsQueue final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /** Event Pointer-type. **/
+        using event_ptr = ecs_sptr<ecs_IEvent>;
+
+        /** Coalescing key, 0 if Event is not coalesced. **/
+        using coalescing_key = ecs_uint64_t;
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Queue node. Event, or removal marker if Event is null.
+        **/
+        struct Node final
+        {
+            /** Next node. **/
+            ecs_atomic<Node*> mNext;
+
+            /** Event. **/
+            event_ptr mEvent;
+
+            /** Coalescing key. **/
+            coalescing_key mKey;
+
+            /** Queue time, or zero if not measured. **/
+            ecs_time_point mTime;
+
+            /** Type-ID of Events to remove. **/
+            ecs_TypeID mRemoveType;
+
+            /** ID of Event to remove, or #ECS_INVALID_OBJECT_ID for all of Type. **/
+            ecs_ObjectID mRemoveID;
+        };
+
+        /**
+         * @brief
+         * Drained Event.
+        **/
+        struct Pending final
+        {
+            /** Event. **/
+            event_ptr mEvent;
+
+            /** Coalescing key. **/
+            coalescing_key mKey;
+
+            /** Queue time, or zero if not measured. **/
+            ecs_time_point mTime;
+
+            /** 'true' if counted as queued (was queued with time), kept by requeued repeatable Event. **/
+            bool mCounted;
+        };
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Producers & consumer fields are kept on different cache-lines. **/
+        static constexpr const ecs_size_t CACHE_LINE = 64;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Last pushed node (producers). **/
+        ecs_atomic<Node*> mHead;
+
+        /** Padding. **/
+        char mHeadPadding[CACHE_LINE - sizeof(ecs_atomic<Node*>)];
+
+        /** Last consumed node (consumer), its Event already moved out. **/
+        Node* mTail;
+
+        /** Initial node. **/
+        Node mStub;
+
+        /** Drained Events, not sent yet (consumer). **/
+        ecs_deque<Pending> mPending;
+
+        /** Pending Events with coalescing key (consumer). References to deque elements stay valid on push_back & pop_front. **/
+        ecs_hash_map<coalescing_key, Pending*> mCoalesced;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Links node.
+         *
+         * @thread_safety - lock-free, wait-free.
+         * @param pNode - node.
+         * @throws - no exceptions.
+        **/
+        void Link( Node* const pNode ) noexcept;
+
+        /**
+         * @brief
+         * Returns next published node & releases previous, or null.
+         *
+         * @thread_safety - consumer only.
+         * @throws - no exceptions.
+        **/
+        Node* Pop() noexcept;
+
+        /**
+         * @brief
+         * Removes pending Events.
+         *
+         * @thread_safety - consumer only.
+         * @param pType - Event Type-ID.
+         * @param pID - Event ID, or #ECS_INVALID_OBJECT_ID for all of Type.
+         * @param pDropped - Type-IDs of removed counted Events output, or null.
+         * @throws - std::bad_alloc.
+        **/
+        void removePending( const ecs_TypeID pType, const ecs_ObjectID pID, ecs_vec<ecs_TypeID>* const pDropped );
+
+        /**
+         * @brief
+         * Appends Event to pending, or replaces pending Event with the same key.
+         *
+         * @thread_safety - consumer only.
+         * @param pEvent - Event.
+         * @param pKey - coalescing key.
+         * @param pTime - queue time.
+         * @param pDropped - Type-ID of replaced Event output if new one is counted, or null.
+         * @throws - std::bad_alloc.
+        **/
+        void addPending( event_ptr&& pEvent, const coalescing_key pKey, const ecs_time_point pTime, ecs_vec<ecs_TypeID>* const pDropped );
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        EventsQueue(const EventsQueue&) = delete;
+        EventsQueue& operator=(const EventsQueue&) = delete;
+        EventsQueue(EventsQueue&&) = delete;
+        EventsQueue& operator=(EventsQueue&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * EventsQueue constructor.
+         *
+         * @throws - no exceptions.
+        **/
+        explicit EventsQueue() noexcept;
+
+        /**
+         * @brief
+         * EventsQueue destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~EventsQueue() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Removes & returns next drained Event, or null.
+         * Repeatable Event is moved after all pending, for next frame, without queue time.
+         *
+         * @thread_safety - consumer only.
+         * @param pTime - queue time output, or null.
+         * @throws - std::bad_alloc.
+        **/
+        event_ptr getNext( ecs_time_point* const pTime = nullptr );
+
+        /**
+         * @brief
+         * Returns drained Events count.
+         *
+         * @thread_safety - consumer only.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t Count() const noexcept
+        { return mPending.size(); }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Queues Event.
+         *
+         * @thread_safety - thread-safe, lock-free.
+         * @param pEvent - Event.
+         * @param pKey - coalescing key, 0 to append.
+         * @param pTime - queue time, zero if not measured.
+         * @throws - std::bad_alloc.
+        **/
+        void Push( const event_ptr& pEvent, const coalescing_key pKey = 0, const ecs_time_point pTime = ecs_time_point() );
+
+        /**
+         * @brief
+         * Queues removal of Events, queued before this call.
+         *
+         * @thread_safety - thread-safe, lock-free.
+         * @param pType - Event Type-ID.
+         * @param pID - Event ID. Default is #ECS_INVALID_OBJECT_ID to remove all with Type-ID.
+         * @throws - std::bad_alloc.
+        **/
+        void Remove( const ecs_TypeID pType, const ecs_ObjectID pID = ECS_INVALID_OBJECT_ID );
+
+        /**
+         * @brief
+         * Moves published Events to pending & applies removals.
+         * Events, queued later, wait for next call.
+         *
+         * @thread_safety - consumer only.
+         * @param pDropped - Type-IDs of removed & replaced counted Events output, or null.
+         * @return - pending Events count.
+         * @throws - std::bad_alloc.
+        **/
+        ecs_size_t Drain( ecs_vec<ecs_TypeID>* const pDropped = nullptr );
+
+        /**
+         * @brief
+         * Releases all Events.
+         *
+         * @thread_safety - consumer only.
+         * @throws - no exceptions.
+        **/
+        void Clear() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::EventsQueue
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_EventsQueue = ecs::EventsQueue;
+#define ECS_EVENTS_QUEUE_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_EVENTS_QUEUE_HPP
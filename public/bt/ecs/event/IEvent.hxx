@@ -122,6 +122,17 @@ namespace ecs
         **/
         virtual ecs_ObjectID getID() const ECS_NOEXCEPT = 0;
 
+        /**
+         * @brief
+         * Returns ID of Event target (Entity, Surface, etc.),
+         * used to coalesce queued Events of the same target.
+         *
+         * @thread_safety - no required.
+         * @throws - no exception.
+        **/
+        virtual ecs_ObjectID getTargetID() const ECS_NOEXCEPT
+        { return ECS_INVALID_OBJECT_ID; }
+
         /**
          * @brief
          * Returns 'true' if Event already handled.
@@ -0,0 +1,406 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_TIMER_WHEEL_HPP
+#define ECS_TIMER_WHEEL_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "../types/ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// Include ecs::memory
+#ifndef ECS_MEMORY_HPP
+#include "../types/ecs_memory.hpp"
+#endif // !ECS_MEMORY_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// Include ecs::time
+#ifndef ECS_TIME_HPP
+#include "../types/ecs_time.hpp"
+#endif // !ECS_TIME_HPP
+
+// ===========================================================
+// FORWARD-DECLARATION
+// ===========================================================
+
+// Forward-Declare ecs::IEvent
+#ifndef ECS_I_EVENT_DECL
+#define ECS_I_EVENT_DECL
+namespace ecs { class IEvent; }
+using ecs_IEvent = ecs::IEvent;
+#endif // !ECS_I_EVENT_DECL
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Timer tick, microseconds. Events are fired with this precision. **/
+#ifndef ECS_TIMER_TICK
+#define ECS_TIMER_TICK 1000
+#endif // !ECS_TIMER_TICK
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+/** Timer ID, 0 is invalid. **/
+using ecs_TimerID = ecs_uint64_t;
+
+/** Invalid Timer ID. **/
+static constexpr const ecs_TimerID ECS_INVALID_TIMER_ID = 0;
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * TimerWheel - hierarchical timing wheel of delayed & periodic Events.
+     *
+     * 4 levels of 256 slots, level N slot covers 256^N ticks.
+     * Timer is linked into slot of its due tick, timers of higher levels
+     * are moved to lower level once their slot is reached.
+     * Schedule & Cancel are O(1), Advance costs O(ticks passed + timers fired).
+     *
+     * @thread_safety - not thread-safe.
+     * @version 0.1
+    **/
+    class ECS_API TimerWheel final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /** Event Pointer-type. **/
+        using event_ptr = ecs_sptr<ecs_IEvent>;
+
+        /**
+         * @brief
+         * Fired Event.
+        **/
+        struct Fired final
+        {
+            /** Event. **/
+            event_ptr mEvent;
+
+            /** Thread-Type. **/
+            ecs_uint8_t mThread;
+        };
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Timer.
+        **/
+        struct Node final
+        {
+            /** Event, null if Node is free. **/
+            event_ptr mEvent;
+
+            /** Due tick. **/
+            ecs_uint64_t mDue;
+
+            /** Period in ticks, 0 for one-shot. **/
+            ecs_uint64_t mPeriod;
+
+            /** Previous Node in slot. **/
+            ecs_uint32_t mPrev;
+
+            /** Next Node in slot, or next free Node. **/
+            ecs_uint32_t mNext;
+
+            /** Generation, changed when Node is released. **/
+            ecs_uint32_t mGeneration;
+
+            /** Slot. **/
+            ecs_uint16_t mSlot;
+
+            /** Thread-Type. **/
+            ecs_uint8_t mThread;
+        };
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Levels. **/
+        static constexpr const ecs_uint32_t LEVELS = 4;
+
+        /** Bits of slot index. **/
+        static constexpr const ecs_uint32_t SLOT_BITS = 8;
+
+        /** Slots per level. **/
+        static constexpr const ecs_uint32_t SLOTS = 1 << SLOT_BITS;
+
+        /** Slot index mask. **/
+        static constexpr const ecs_uint64_t SLOT_MASK = SLOTS - 1;
+
+        /** Max ticks until due, covered by levels. **/
+        static constexpr const ecs_uint64_t MAX_DELTA = (static_cast<ecs_uint64_t>( 1 ) << (SLOT_BITS * LEVELS)) - 1;
+
+        /** No Node. **/
+        static constexpr const ecs_uint32_t NO_INDEX = ecs_NumericUtil<ecs_uint32_t>::MAX;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Time of tick 0. **/
+        const ecs_time_point mStart;
+
+        /** Current tick, all timers due before it are fired. **/
+        ecs_uint64_t mNow;
+
+        /** First Node of each slot. **/
+        ecs_uint32_t mSlots[LEVELS * SLOTS];
+
+        /** Nodes. **/
+        ecs_vec<Node> mNodes;
+
+        /** First free Node. **/
+        ecs_uint32_t mFree;
+
+        /** Scheduled timers count. **/
+        ecs_size_t mCount;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Links Node into slot of its due tick.
+         *
+         * @param pIndex - Node index.
+         * @throws - no exceptions.
+        **/
+        void Link( const ecs_uint32_t pIndex ) noexcept;
+
+        /**
+         * @brief
+         * Unlinks Node from its slot.
+         *
+         * @param pIndex - Node index.
+         * @throws - no exceptions.
+        **/
+        void Unlink( const ecs_uint32_t pIndex ) noexcept;
+
+        /**
+         * @brief
+         * Releases Node.
+         *
+         * @param pIndex - Node index.
+         * @throws - no exceptions.
+        **/
+        void Release( const ecs_uint32_t pIndex ) noexcept;
+
+        /**
+         * @brief
+         * Moves timers of slot to lower levels.
+         *
+         * @param pSlot - slot.
+         * @throws - no exceptions.
+        **/
+        void Cascade( const ecs_uint32_t pSlot ) noexcept;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        TimerWheel(const TimerWheel&) = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+        TimerWheel(TimerWheel&&) = delete;
+        TimerWheel& operator=(TimerWheel&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * TimerWheel constructor.
+         *
+         * @throws - no exceptions.
+        **/
+        explicit TimerWheel() noexcept;
+
+        /**
+         * @brief
+         * TimerWheel destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~TimerWheel() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns scheduled timers count.
+         *
+         * @throws - no exceptions.
+        **/
+        ecs_size_t Count() const noexcept
+        { return mCount; }
+
+        /**
+         * @brief
+         * Returns current tick.
+         *
+         * @throws - no exceptions.
+        **/
+        ecs_uint64_t getNow() const noexcept
+        { return mNow; }
+
+        /**
+         * @brief
+         * Returns tick of time point.
+         *
+         * @param pTime - time point.
+         * @param pRoundUp - 'true' to round up, used for due ticks.
+         * @throws - no exceptions.
+        **/
+        ecs_uint64_t getTick( const ecs_time_point pTime, const bool pRoundUp = false ) const noexcept;
+
+        /**
+         * @brief
+         * Returns ticks of duration, rounded up.
+         *
+         * @param pDuration - duration.
+         * @throws - no exceptions.
+        **/
+        static ecs_uint64_t getTicks( const ecs_microseconds pDuration ) noexcept;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Schedules Event.
+         *
+         * @param pEvent - Event.
+         * @param pThread - Thread-Type to queue Event into.
+         * @param pDue - due tick, past ticks fire on next tick.
+         * @param pPeriod - period in ticks, 0 for one-shot.
+         * @return - Timer ID.
+         * @throws - std::bad_alloc.
+        **/
+        ecs_TimerID Schedule( const event_ptr& pEvent, const ecs_uint8_t pThread, const ecs_uint64_t pDue, const ecs_uint64_t pPeriod );
+
+        /**
+         * @brief
+         * Cancels timer.
+         *
+         * @param pTimer - Timer ID.
+         * @return - 'false' if timer already fired (one-shot) or cancelled.
+         * @throws - no exceptions.
+        **/
+        bool Cancel( const ecs_TimerID pTimer ) noexcept;
+
+        /**
+         * @brief
+         * Advances to tick, appends fired Events.
+         * Periodic timers are scheduled again.
+         *
+         * @param pTick - tick.
+         * @param pFired - fired Events.
+         * @throws - std::bad_alloc.
+        **/
+        void Advance( const ecs_uint64_t pTick, ecs_vec<Fired>& pFired );
+
+        /**
+         * @brief
+         * Cancels all timers.
+         *
+         * @throws - no exceptions.
+        **/
+        void Clear() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::TimerWheel
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_TimerWheel = ecs::TimerWheel;
+#define ECS_TIMER_WHEEL_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_TIMER_WHEEL_HPP
@@ -0,0 +1,550 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_HIERARCHY_STORE_HPP
+#define ECS_HIERARCHY_STORE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * HierarchyStore - parent-child relations of Entities in flat arrays.
+     *
+     * Changes are O(1) & mark store dirty, #Update rebuilds arrays in breadth-first order:
+     * nodes are sorted by depth, parent is always before its children,
+     * children of one parent are contiguous. Hierarchical passes (transform propagation,
+     * enable/disable cascade) are a single linear sweep over arrays.
+     *
+     * @thread_safety - not thread-safe, changes must be synchronized (see ecs::CommandQueue).
+     * @version 0.1
+    **/
+    class ECS_API HierarchyStore final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** No node (root parent, or Entity not in hierarchy). **/
+        static constexpr const ecs_uint32_t NO_INDEX = ecs_NumericUtil<ecs_uint32_t>::MAX;
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /**
+         * @brief
+         * Node links, indexed by Entity Handle index.
+        **/
+        struct Link final
+        {
+            /** Entity, invalid if slot not in hierarchy. **/
+            ecs_Handle mEntity;
+
+            /** Parent slot. **/
+            ecs_uint32_t mParent;
+
+            /** First child slot. **/
+            ecs_uint32_t mFirstChild;
+
+            /** Last child slot. **/
+            ecs_uint32_t mLastChild;
+
+            /** Previous sibling slot. **/
+            ecs_uint32_t mPrevSibling;
+
+            /** Next sibling slot. **/
+            ecs_uint32_t mNextSibling;
+
+            /** Node index in sorted arrays. **/
+            ecs_uint32_t mNode;
+        };
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Links, indexed by Entity Handle index. **/
+        ecs_vec<Link> mLinks;
+
+        /** Entities, sorted by depth. **/
+        ecs_vec<ecs_Handle> mEntities;
+
+        /** Parent node of each node, NO_INDEX for roots. **/
+        ecs_vec<ecs_uint32_t> mParents;
+
+        /** Depth of each node, 0 for roots. **/
+        ecs_vec<ecs_uint32_t> mDepths;
+
+        /** First child node of each node. **/
+        ecs_vec<ecs_uint32_t> mFirstChildren;
+
+        /** Children count of each node. **/
+        ecs_vec<ecs_uint32_t> mChildrenCounts;
+
+        /** Per-node scratch for #Propagate, kept between calls. **/
+        ecs_vec<void*> mValues;
+
+        /** Entities in hierarchy. **/
+        ecs_size_t mCount;
+
+        /** 'true' if arrays must be rebuilt. **/
+        bool mDirty;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns Entity links, or null if Entity not in hierarchy.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @throws - no exceptions.
+        **/
+        const Link* getLink( const ecs_Handle pEntity ) const noexcept
+        {
+            const ecs_uint32_t slot = pEntity.getIndex();
+            return pEntity.isValid() && slot < mLinks.size() && mLinks[slot].mEntity == pEntity ? &mLinks[slot] : nullptr;
+        }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Adds Entity as root, if not in hierarchy.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - Entity slot.
+         * @throws - std::bad_alloc.
+        **/
+        ecs_uint32_t Insert( const ecs_Handle pEntity );
+
+        /**
+         * @brief
+         * Unlinks slot from its parent.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pSlot - Entity slot.
+         * @throws - no exceptions.
+        **/
+        void Unlink( const ecs_uint32_t pSlot ) noexcept;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        HierarchyStore(const HierarchyStore&) = delete;
+        HierarchyStore& operator=(const HierarchyStore&) = delete;
+        HierarchyStore(HierarchyStore&&) = delete;
+        HierarchyStore& operator=(HierarchyStore&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * HierarchyStore constructor.
+         *
+         * @throws - no exceptions.
+        **/
+        explicit HierarchyStore() noexcept;
+
+        /**
+         * @brief
+         * HierarchyStore destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~HierarchyStore() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns Entities count in hierarchy.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t Count() const noexcept
+        { return mCount; }
+
+        /**
+         * @brief
+         * Returns 'true' if #Update required.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        bool isDirty() const noexcept
+        { return mDirty; }
+
+        /**
+         * @brief
+         * Returns 'true' if Entity in hierarchy.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @throws - no exceptions.
+        **/
+        bool Contains( const ecs_Handle pEntity ) const noexcept
+        { return getLink( pEntity ) != nullptr; }
+
+        /**
+         * @brief
+         * Returns parent of Entity.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - parent Handle, invalid Handle for roots.
+         * @throws - no exceptions.
+        **/
+        ecs_Handle getParent( const ecs_Handle pEntity ) const noexcept;
+
+        /**
+         * @brief
+         * Returns 'true' if Entity is direct child of parent.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @param pParent - parent Handle.
+         * @throws - no exceptions.
+        **/
+        bool isChildOf( const ecs_Handle pEntity, const ecs_Handle pParent ) const noexcept
+        { return pParent.isValid() && getParent( pEntity ) == pParent; }
+
+        /**
+         * @brief
+         * Returns node index of Entity in sorted arrays.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - node index, or NO_INDEX.
+         * @throws - no exceptions.
+        **/
+        ecs_uint32_t getNode( const ecs_Handle pEntity ) const noexcept
+        {
+            const Link* const link = getLink( pEntity );
+            return link == nullptr ? NO_INDEX : link->mNode;
+        }
+
+        /**
+         * @brief
+         * Returns Entity depth, 0 for roots.
+         * Hierarchy is updated first, if changed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - depth, 0 if Entity not in hierarchy.
+         * @throws - std::bad_alloc (see #Update).
+        **/
+        ecs_uint32_t getDepth( const ecs_Handle pEntity )
+        {
+            Update();
+
+            const ecs_uint32_t node = getNode( pEntity );
+            return node == NO_INDEX ? 0 : mDepths[node];
+        }
+
+        /**
+         * @brief
+         * Returns children count.
+         * Hierarchy is updated first, if changed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @return - children count, 0 if Entity not in hierarchy.
+         * @throws - std::bad_alloc (see #Update).
+        **/
+        ecs_uint32_t getChildrenCount( const ecs_Handle pEntity )
+        {
+            Update();
+
+            const ecs_uint32_t node = getNode( pEntity );
+            return node == NO_INDEX ? 0 : mChildrenCounts[node];
+        }
+
+        /**
+         * @brief
+         * Returns child by its index.
+         * Hierarchy is updated first, if changed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - parent Handle.
+         * @param pIndex - child index.
+         * @return - child Handle, invalid Handle if Entity not in hierarchy or index out of range.
+         * @throws - std::bad_alloc (see #Update).
+        **/
+        ecs_Handle getChild( const ecs_Handle pEntity, const ecs_uint32_t pIndex )
+        {
+            Update();
+
+            const ecs_uint32_t node = getNode( pEntity );
+
+            if ( node == NO_INDEX || pIndex >= mChildrenCounts[node] )
+                return ecs_Handle();
+
+            return mEntities[mFirstChildren[node] + pIndex];
+        }
+
+        /**
+         * @brief
+         * Returns Entities, sorted by depth.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        const ecs_vec<ecs_Handle>& getEntities() const noexcept
+        { return mEntities; }
+
+        /**
+         * @brief
+         * Returns parent node of each node, NO_INDEX for roots.
+         * Parent node index is always less than child one.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        const ecs_vec<ecs_uint32_t>& getParents() const noexcept
+        { return mParents; }
+
+        /**
+         * @brief
+         * Returns depth of each node.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        const ecs_vec<ecs_uint32_t>& getDepths() const noexcept
+        { return mDepths; }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Attaches Entity to parent. Entity is detached from previous parent.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - child Handle.
+         * @param pParent - parent Handle.
+         * @return - 'false' if parent is Entity or its descendant.
+         * @throws - std::bad_alloc.
+        **/
+        bool Attach( const ecs_Handle pEntity, const ecs_Handle pParent );
+
+        /**
+         * @brief
+         * Detaches Entity from parent, Entity becomes root.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @throws - no exceptions.
+        **/
+        void Detach( const ecs_Handle pEntity ) noexcept;
+
+        /**
+         * @brief
+         * Removes Entity from hierarchy, its children become roots.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pEntity - Entity Handle.
+         * @throws - no exceptions.
+        **/
+        void Remove( const ecs_Handle pEntity ) noexcept;
+
+        /**
+         * @brief
+         * Rebuilds sorted arrays, if hierarchy changed.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - std::bad_alloc.
+        **/
+        void Update();
+
+        /**
+         * @brief
+         * Calls function for each node, parents before children.
+         * Sorted arrays are rebuilt first, if hierarchy changed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pFunction - f( node, parent node or NO_INDEX ).
+         * @throws - can throw exception.
+        **/
+        template <typename F>
+        void forEach( F pFunction )
+        {
+            Update();
+
+            const ecs_uint32_t nodesCount = static_cast<ecs_uint32_t>( mEntities.size() );
+
+            for ( ecs_uint32_t node = 0; node < nodesCount; node++ )
+                pFunction( node, mParents[node] );
+        }
+
+        /**
+         * @brief
+         * Propagates Component values from parents to children in one sweep.
+         * Nodes without Component are skipped, their children get null parent.
+         * Sorted arrays are rebuilt first, if hierarchy changed.
+         *
+         * Example (transform): f( Transform& child, const Transform* parent )
+         * child.mWorld = parent ? parent->mWorld * child.mLocal : child.mLocal;
+         *
+         * @thread_safety - not thread-safe.
+         * @param pStorage - Components storage.
+         * @param pFunction - f( T& child, const T* parent or null ).
+         * @throws - can throw exception.
+        **/
+        template <typename T, typename F>
+        void Propagate( ecs_ArchetypeStorage& pStorage, F pFunction )
+        {
+            Update();
+
+            const ecs_uint32_t nodesCount = static_cast<ecs_uint32_t>( mEntities.size() );
+            const ecs_TypeID type = ecs_ComponentType<T>::getID();
+            mValues.resize( nodesCount );
+
+            for ( ecs_uint32_t node = 0; node < nodesCount; node++ )
+            {
+                T* const component = static_cast<T*>( pStorage.getComponent(mEntities[node], type) );
+                mValues[node] = component;
+
+                if ( component == nullptr )
+                    continue;
+
+                const ecs_uint32_t parent = mParents[node];
+                pFunction( *component, parent == NO_INDEX ? nullptr : static_cast<const T*>( mValues[parent] ) );
+            }
+        }
+
+        /**
+         * @brief
+         * Copies relations to snapshot, see ecs::ArchetypeStorage::Capture.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pDst - snapshot.
+         * @throws - std::bad_alloc.
+        **/
+        void Capture( ecs_StorageSnapshot& pDst );
+
+        /**
+         * @brief
+         * Replaces relations with snapshot ones, see ecs::ArchetypeStorage::Restore.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pSrc - snapshot.
+         * @throws - std::bad_alloc.
+        **/
+        void Restore( const ecs_StorageSnapshot& pSrc );
+
+        /**
+         * @brief
+         * Removes all Entities.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Clear() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::HierarchyStore
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_HierarchyStore = ecs::HierarchyStore;
+#define ECS_HIERARCHY_STORE_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_HIERARCHY_STORE_HPP
@@ -0,0 +1,683 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_QUERY_HPP
+#define ECS_QUERY_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include C++ tuple
+#include <tuple>
+
+// Include C++ utility
+#include <utility>
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * Read - Query term, Component is required & passed as const.
+    **/
+    template <typename T>
+    struct Read final
+    {
+        using type = T;
+    };
+
+    /**
+     * @brief
+     * Write - Query term, Component is required & passed as mutable.
+    **/
+    template <typename T>
+    struct Write final
+    {
+        using type = T;
+    };
+
+    /**
+     * @brief
+     * With - Query term, Component (or tag) is required, but not passed.
+     * Checked per Archetype, so filtering costs nothing per Entity.
+    **/
+    template <typename T>
+    struct With final
+    {
+        using type = T;
+    };
+
+    /**
+     * @brief
+     * Without - Query term, Component must not be attached.
+    **/
+    template <typename T>
+    struct Without final
+    {
+        using type = T;
+    };
+
+    /**
+     * @brief
+     * Changed - Query term, Component is required & changed since last Query run.
+    **/
+    template <typename T>
+    struct Changed final
+    {
+        using type = T;
+    };
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * QueryTerm - Query term traits.
+     *
+     * DATA - 'true' if term passes Component to callback.
+     * REQUIRED - 'true' if Component must be attached.
+     * EXCLUDED - 'true' if Component must not be attached.
+     * WRITE - 'true' if Component is mutable, iterated rows are marked changed.
+     * CHANGED - 'true' if Component must be changed since last Query run.
+    **/
+    template <typename _Term>
+    struct QueryTerm;
+
+    template <typename T>
+    struct QueryTerm<Read<T>> final
+    {
+        static_assert( !ecs_ComponentType<T>::isTag(), "Query - tag has no data, use ecs::With." );
+
+        using pointer = const T*;
+
+        static constexpr const bool DATA = true;
+        static constexpr const bool REQUIRED = true;
+        static constexpr const bool EXCLUDED = false;
+        static constexpr const bool WRITE = false;
+        static constexpr const bool CHANGED = false;
+
+        static ecs_TypeID getTypeID()
+        { return ecs_ComponentType<T>::getID(); }
+    };
+
+    template <typename T>
+    struct QueryTerm<Write<T>> final
+    {
+        static_assert( !ecs_ComponentType<T>::isTag(), "Query - tag has no data, use ecs::With." );
+
+        using pointer = T*;
+
+        static constexpr const bool DATA = true;
+        static constexpr const bool REQUIRED = true;
+        static constexpr const bool EXCLUDED = false;
+        static constexpr const bool WRITE = true;
+        static constexpr const bool CHANGED = false;
+
+        static ecs_TypeID getTypeID()
+        { return ecs_ComponentType<T>::getID(); }
+    };
+
+    template <typename T>
+    struct QueryTerm<With<T>> final
+    {
+        using pointer = void*;
+
+        static constexpr const bool DATA = false;
+        static constexpr const bool REQUIRED = true;
+        static constexpr const bool EXCLUDED = false;
+        static constexpr const bool WRITE = false;
+        static constexpr const bool CHANGED = false;
+
+        static ecs_TypeID getTypeID()
+        { return ecs_ComponentType<T>::getID(); }
+    };
+
+    template <typename T>
+    struct QueryTerm<Without<T>> final
+    {
+        using pointer = void*;
+
+        static constexpr const bool DATA = false;
+        static constexpr const bool REQUIRED = false;
+        static constexpr const bool EXCLUDED = true;
+        static constexpr const bool WRITE = false;
+        static constexpr const bool CHANGED = false;
+
+        static ecs_TypeID getTypeID()
+        { return ecs_ComponentType<T>::getID(); }
+    };
+
+    template <typename T>
+    struct QueryTerm<Changed<T>> final
+    {
+        static_assert( !ecs_ComponentType<T>::isTag(), "Query - tag has no data, use ecs::With." );
+
+        using pointer = void*;
+
+        static constexpr const bool DATA = false;
+        static constexpr const bool REQUIRED = true;
+        static constexpr const bool EXCLUDED = false;
+        static constexpr const bool WRITE = false;
+        static constexpr const bool CHANGED = true;
+
+        static ecs_TypeID getTypeID()
+        { return ecs_ComponentType<T>::getID(); }
+    };
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * QueryDataIndices - indices of data terms (passed to callbacks).
+    **/
+    template <ecs_size_t I, typename _Seq, typename... _Terms>
+    struct QueryDataIndices;
+
+    template <ecs_size_t I, ecs_size_t... _Idx>
+    struct QueryDataIndices<I, std::index_sequence<_Idx...>>
+    {
+        using type = std::index_sequence<_Idx...>;
+    };
+
+    template <ecs_size_t I, ecs_size_t... _Idx, typename _Term, typename... _Terms>
+    struct QueryDataIndices<I, std::index_sequence<_Idx...>, _Term, _Terms...>
+    {
+        using type = typename std::conditional<QueryTerm<_Term>::DATA,
+                                               typename QueryDataIndices<I + 1, std::index_sequence<_Idx..., I>, _Terms...>::type,
+                                               typename QueryDataIndices<I + 1, std::index_sequence<_Idx...>, _Terms...>::type>::type;
+    };
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * Query - cached view over Archetypes with given Component set.
+     *
+     * Matching Archetypes & their column indices are cached, new Archetypes
+     * are matched incrementally before iteration. Iteration walks Chunks,
+     * without allocations, locks or hash lookups.
+     *
+     * Example:
+     * ecs::Query<ecs::Read<Velocity>, ecs::Write<Position>, ecs::With<IsEnemy>, ecs::Without<Frozen>> query( storage );
+     * query.forEachChunk( []( const ecs_Handle* pEntities, ecs_size_t pCount, const Velocity* pVel, Position* pPos ) { ... } );
+     *
+     * (?) Structural changes (create, destroy, attach, detach) not allowed during iteration.
+     * (?) Write<T> marks iterated Chunks (or rows, with Changed<T> terms) as changed.
+     * (?) Changed<T> reports Components changed since previous iteration of this Query.
+     *
+     * @thread_safety - not thread-safe.
+     * @version 0.1
+    **/
+    template <typename... _Terms>
+    class ECS_API Query final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        static constexpr const ecs_size_t TERMS = sizeof...( _Terms );
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        using data_indices = typename QueryDataIndices<0, std::index_sequence<>, _Terms...>::type;
+
+        template <ecs_size_t I>
+        using term_t = QueryTerm<typename std::tuple_element<I, std::tuple<_Terms...>>::type>;
+
+        /**
+         * @brief
+         * Matched Archetype.
+        **/
+        struct Match final
+        {
+            /** Archetype. **/
+            ecs_Archetype* mArchetype;
+
+            /** Column index for each term. **/
+            ecs_size_t mColumns[TERMS > 0 ? TERMS : 1];
+        };
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Archetypes storage. **/
+        ecs_ArchetypeStorage& mStorage;
+
+        /** Required Components. **/
+        ecs_Signature mRequired;
+
+        /** Excluded Components. **/
+        ecs_Signature mExcluded;
+
+        /** Matched Archetypes. **/
+        ecs_vec<Match> mMatches;
+
+        /** Archetypes checked so far. **/
+        ecs_size_t mChecked;
+
+        /** Storage tick of last iteration, for Changed<T> terms. **/
+        ecs_uint32_t mLastTick;
+
+        /** 'true' for Write<T> terms. **/
+        bool mWrites[TERMS > 0 ? TERMS : 1];
+
+        /** 'true' for Changed<T> terms. **/
+        bool mChanged[TERMS > 0 ? TERMS : 1];
+
+        /** 'true' if Query has Changed<T> terms. **/
+        bool mFiltered;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Calls callback for Chunk.
+        **/
+        template <typename F, ecs_size_t... _Idx>
+        static void invokeChunk( F& pFunc, const Match& pMatch, const ecs_ArchetypeChunk& pChunk, std::index_sequence<_Idx...> )
+        {
+            pFunc( static_cast<const ecs_Handle*>(pMatch.mArchetype->getEntities(pChunk)),
+                   static_cast<ecs_size_t>(pChunk.mCount),
+                   static_cast<typename term_t<_Idx>::pointer>(pMatch.mArchetype->getColumn(pChunk, pMatch.mColumns[_Idx]))... );
+        }
+
+        /**
+         * @brief
+         * Returns 'true' if all Changed<T> columns of Chunk changed since tick.
+        **/
+        bool isChunkChanged( const Match& pMatch, const ecs_size_t pChunk, const ecs_uint32_t pSince ) const noexcept
+        {
+            for ( ecs_size_t i = 0; i < TERMS; i++ )
+            {
+                if ( mChanged[i] && !pMatch.mArchetype->isChanged(pChunk, pMatch.mColumns[i], pSince) )
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief
+         * Returns 'true' if all Changed<T> Components of row changed since tick.
+        **/
+        bool isRowChanged( const Match& pMatch, const ecs_ArchetypeRow& pRow, const ecs_uint32_t pSince ) const noexcept
+        {
+            for ( ecs_size_t i = 0; i < TERMS; i++ )
+            {
+                if ( mChanged[i] && !pMatch.mArchetype->isChanged(pRow, pMatch.mColumns[i], pSince) )
+                    return false;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief
+         * Marks Write<T> columns of Chunk changed.
+        **/
+        void markChunk( const Match& pMatch, const ecs_size_t pChunk ) noexcept
+        {
+            for ( ecs_size_t i = 0; i < TERMS; i++ )
+            {
+                if ( mWrites[i] )
+                    pMatch.mArchetype->MarkChanged( pChunk, pMatch.mColumns[i] );
+            }
+        }
+
+        /**
+         * @brief
+         * Calls callback for each row of columns.
+         * With Changed<T> terms only changed rows are passed & marked.
+        **/
+        template <typename F, typename... _Columns>
+        void invokeColumns( F& pFunc, const Match& pMatch, const ecs_size_t pChunk, const ecs_uint32_t pCount, const ecs_uint32_t pSince, _Columns... pColumns )
+        {
+            if ( !mFiltered )
+            {
+                markChunk( pMatch, pChunk );
+
+                for ( ecs_uint32_t row = 0; row < pCount; row++ )
+                    pFunc( pColumns[row]... );
+
+                return;
+            }
+
+            for ( ecs_uint32_t row = 0; row < pCount; row++ )
+            {
+                const ecs_ArchetypeRow location{ static_cast<ecs_uint32_t>(pChunk), row };
+
+                if ( !isRowChanged(pMatch, location, pSince) )
+                    continue;
+
+                for ( ecs_size_t i = 0; i < TERMS; i++ )
+                {
+                    if ( mWrites[i] )
+                        pMatch.mArchetype->MarkChanged( location, pMatch.mColumns[i] );
+                }
+
+                pFunc( pColumns[row]... );
+            }
+        }
+
+        /**
+         * @brief
+         * Calls callback for each row of Chunk.
+        **/
+        template <typename F, ecs_size_t... _Idx>
+        void invokeRows( F& pFunc, const Match& pMatch, const ecs_size_t pChunk, const ecs_uint32_t pSince, std::index_sequence<_Idx...> )
+        {
+            const ecs_ArchetypeChunk& chunk = pMatch.mArchetype->getChunk( pChunk );
+
+            invokeColumns( pFunc, pMatch, pChunk, chunk.mCount, pSince,
+                           static_cast<typename term_t<_Idx>::pointer>(pMatch.mArchetype->getColumn(chunk, pMatch.mColumns[_Idx]))... );
+        }
+
+        /**
+         * @brief
+         * Returns tick to compare changes with & starts new iteration.
+        **/
+        ecs_uint32_t beginIteration() noexcept
+        {
+            Update();
+
+            if ( !mFiltered )
+                return 0;
+
+            // Changes after this call have greater tick, so reported next time.
+            const ecs_uint32_t since = mLastTick;
+            mLastTick = mStorage.AdvanceTick();
+
+            return since;
+        }
+
+        /**
+         * @brief
+         * Matches Archetype against terms & caches column indices.
+        **/
+        void match( ecs_Archetype* const pArchetype )
+        {
+            const ecs_Signature& signature = pArchetype->getSignature();
+
+            if ( !signature.Contains(mRequired) || signature.Intersects(mExcluded) )
+                return;
+
+            const ecs_TypeID types[TERMS > 0 ? TERMS : 1] = { QueryTerm<_Terms>::getTypeID()... };
+            const bool columns[TERMS > 0 ? TERMS : 1] = { (QueryTerm<_Terms>::DATA || QueryTerm<_Terms>::CHANGED)... };
+
+            Match match;
+            match.mArchetype = pArchetype;
+
+            // With<T> & Without<T> terms are checked by Signature only, tags have no columns.
+            for ( ecs_size_t i = 0; i < TERMS; i++ )
+                match.mColumns[i] = columns[i] ? static_cast<ecs_size_t>( pArchetype->getColumnIndex(types[i]) ) : 0;
+
+            mMatches.push_back( match );
+        }
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        Query(const Query&) = delete;
+        Query& operator=(const Query&) = delete;
+        Query(Query&&) = delete;
+        Query& operator=(Query&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * Query constructor.
+         *
+         * @param pStorage - Archetypes storage, must outlive Query.
+         * @throws - can throw exception.
+        **/
+        explicit Query( ecs_ArchetypeStorage& pStorage )
+            : mStorage( pStorage ),
+              mRequired(),
+              mExcluded(),
+              mMatches(),
+              mChecked( 0 ),
+              mLastTick( 0 ),
+              mWrites{ QueryTerm<_Terms>::WRITE... },
+              mChanged{ QueryTerm<_Terms>::CHANGED... },
+              mFiltered( false )
+        {
+            const ecs_TypeID types[TERMS > 0 ? TERMS : 1] = { QueryTerm<_Terms>::getTypeID()... };
+            const bool required[TERMS > 0 ? TERMS : 1] = { QueryTerm<_Terms>::REQUIRED... };
+            const bool excluded[TERMS > 0 ? TERMS : 1] = { QueryTerm<_Terms>::EXCLUDED... };
+
+            for ( ecs_size_t i = 0; i < TERMS; i++ )
+            {
+                mFiltered = mFiltered || mChanged[i];
+
+#if defined( DEBUG ) || defined( BT_DEBUG ) // DEBUG
+                ecs_assert( types[i] < ECS_MAX_COMPONENT_TYPES && "Query - Type-ID out of range, increase ECS_MAX_COMPONENT_TYPES." );
+#endif // DEBUG
+
+                if ( required[i] )
+                    mRequired.Set( types[i] );
+                else if ( excluded[i] )
+                    mExcluded.Set( types[i] );
+            }
+
+            Update();
+        }
+
+        /**
+         * @brief
+         * Query destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~Query() noexcept = default;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns matched Archetypes count.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t getArchetypesCount() const noexcept
+        { return mMatches.size(); }
+
+        /**
+         * @brief
+         * Returns storage tick of last iteration, 0 if Query has no Changed<T> terms.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_uint32_t getLastTick() const noexcept
+        { return mLastTick; }
+
+        /**
+         * @brief
+         * Returns matched Entities count.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - can throw exception.
+        **/
+        ecs_size_t Count()
+        {
+            Update();
+
+            ecs_size_t result = 0;
+
+            for ( const Match& match : mMatches )
+                result += match.mArchetype->Count();
+
+            return result;
+        }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Matches Archetypes, created since last call.
+         * Allocates only if new Archetype matched.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - can throw exception.
+        **/
+        void Update()
+        {
+            const ecs_size_t archetypesCount = mStorage.getArchetypesCount();
+
+            for ( ; mChecked < archetypesCount; mChecked++ )
+                match( mStorage.getArchetype(mChecked) );
+        }
+
+        /**
+         * @brief
+         * Calls function for each matched Chunk.
+         * With Changed<T> terms only changed Chunks are passed, rows can be checked by
+         * ecs::Archetype::isChanged, Write<T> columns are marked changed per Chunk.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pFunc - callable with (const ecs_Handle* pEntities, ecs_size_t pCount, columns...)
+         * signature, where column is 'const T*' for Read<T> & 'T*' for Write<T>.
+         * @throws - can throw exception.
+        **/
+        template <typename F>
+        void forEachChunk( F&& pFunc )
+        {
+            const ecs_uint32_t since = beginIteration();
+
+            for ( const Match& match : mMatches )
+            {
+                const ecs_size_t chunksCount = match.mArchetype->getChunksCount();
+
+                for ( ecs_size_t chunk = 0; chunk < chunksCount; chunk++ )
+                {
+                    if ( mFiltered && !isChunkChanged(match, chunk, since) )
+                        continue;
+
+                    markChunk( match, chunk );
+                    invokeChunk( pFunc, match, match.mArchetype->getChunk(chunk), data_indices() );
+                }
+            }
+        }
+
+        /**
+         * @brief
+         * Calls function for each matched Entity.
+         * With Changed<T> terms only changed Entities are passed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pFunc - callable with (components...) signature,
+         * where component is 'const T&' for Read<T> & 'T&' for Write<T>.
+         * @throws - can throw exception.
+        **/
+        template <typename F>
+        void forEach( F&& pFunc )
+        {
+            const ecs_uint32_t since = beginIteration();
+
+            for ( const Match& match : mMatches )
+            {
+                const ecs_size_t chunksCount = match.mArchetype->getChunksCount();
+
+                for ( ecs_size_t chunk = 0; chunk < chunksCount; chunk++ )
+                {
+                    if ( mFiltered && !isChunkChanged(match, chunk, since) )
+                        continue;
+
+                    invokeRows( pFunc, match, chunk, since, data_indices() );
+                }
+            }
+        }
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::Query
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+template <typename... _Terms>
+using ecs_Query = ecs::Query<_Terms...>;
+
+#define ECS_QUERY_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_QUERY_HPP
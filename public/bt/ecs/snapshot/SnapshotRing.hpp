@@ -0,0 +1,261 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_SNAPSHOT_RING_HPP
+#define ECS_SNAPSHOT_RING_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::ArchetypeStorage
+#ifndef ECS_ARCHETYPE_STORAGE_HPP
+#include "../archetype/ArchetypeStorage.hpp"
+#endif // !ECS_ARCHETYPE_STORAGE_HPP
+
+// Include ecs::StorageSnapshot
+#ifndef ECS_STORAGE_SNAPSHOT_HPP
+#include "StorageSnapshot.hpp"
+#endif // !ECS_STORAGE_SNAPSHOT_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * SnapshotRing - last N snapshots of ecs::ArchetypeStorage, for rollback.
+     *
+     * Each snapshot copies only Chunks changed since previous one,
+     * unchanged Chunks pages are shared. Components must be trivially copyable.
+     *
+     * @thread_safety - not thread-safe.
+     * @version 0.1
+    **/
+    class ECS_API SnapshotRing final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Storage. **/
+        ecs_ArchetypeStorage& mStorage;
+
+        /** Snapshots. **/
+        ecs_vec<ecs_StorageSnapshot> mSnapshots;
+
+        /** Snapshot being captured, swapped with overwritten one. **/
+        ecs_StorageSnapshot mScratch;
+
+        /** Index of oldest snapshot. **/
+        ecs_size_t mFirst;
+
+        /** Snapshots count. **/
+        ecs_size_t mCount;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns snapshot index, or capacity if frame not found.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pFrame - frame.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t getIndexOf( const ecs_uint64_t pFrame ) const noexcept;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        SnapshotRing(const SnapshotRing&) = delete;
+        SnapshotRing& operator=(const SnapshotRing&) = delete;
+        SnapshotRing(SnapshotRing&&) = delete;
+        SnapshotRing& operator=(SnapshotRing&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * SnapshotRing constructor.
+         *
+         * @param pStorage - storage, must outlive ring.
+         * @param pCapacity - max snapshots count.
+         * @throws - std::bad_alloc.
+        **/
+        explicit SnapshotRing( ecs_ArchetypeStorage& pStorage, const ecs_size_t pCapacity );
+
+        /**
+         * @brief
+         * SnapshotRing destructor.
+         *
+         * @throws - no exceptions.
+        **/
+        ~SnapshotRing() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns max snapshots count.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t getCapacity() const noexcept
+        { return mSnapshots.size(); }
+
+        /**
+         * @brief
+         * Returns snapshots count.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t Count() const noexcept
+        { return mCount; }
+
+        /**
+         * @brief
+         * Returns 'true' if frame snapshot is stored.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pFrame - frame.
+         * @throws - no exceptions.
+        **/
+        bool hasFrame( const ecs_uint64_t pFrame ) const noexcept
+        { return getIndexOf( pFrame ) < mSnapshots.size(); }
+
+        /**
+         * @brief
+         * Returns oldest stored frame.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_uint64_t getOldestFrame() const noexcept
+        { return mCount > 0 ? mSnapshots[mFirst].mFrame : 0; }
+
+        /**
+         * @brief
+         * Returns newest stored frame.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        ecs_uint64_t getNewestFrame() const noexcept
+        { return mCount > 0 ? mSnapshots[( mFirst + mCount - 1 ) % mSnapshots.size()].mFrame : 0; }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Captures storage state, oldest snapshot is overwritten if ring is full.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pFrame - frame, must be greater than newest stored frame.
+         * @return - 'false' if some Entity has not trivially copyable Component.
+         * @throws - std::bad_alloc.
+        **/
+        bool Capture( const ecs_uint64_t pFrame );
+
+        /**
+         * @brief
+         * Restores storage state of frame, newer snapshots are discarded.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pFrame - frame.
+         * @return - 'false' if frame snapshot not stored.
+         * @throws - std::bad_alloc.
+        **/
+        bool Restore( const ecs_uint64_t pFrame );
+
+        /**
+         * @brief
+         * Discards all snapshots.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - no exceptions.
+        **/
+        void Clear() noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::SnapshotRing
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_SnapshotRing = ecs::SnapshotRing;
+#define ECS_SNAPSHOT_RING_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_SNAPSHOT_RING_HPP
@@ -0,0 +1,241 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_STORAGE_SNAPSHOT_HPP
+#define ECS_STORAGE_SNAPSHOT_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::Archetype
+#ifndef ECS_ARCHETYPE_HPP
+#include "../archetype/Archetype.hpp"
+#endif // !ECS_ARCHETYPE_HPP
+
+// Include ecs::memory
+#ifndef ECS_MEMORY_HPP
+#include "../types/ecs_memory.hpp"
+#endif // !ECS_MEMORY_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * SnapshotPage - copy of Chunk memory.
+     *
+     * Pages are shared between snapshots while Chunk is not changed (copy-on-write).
+     *
+     * @version 0.1
+    **/
+    struct ECS_API SnapshotPage final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_STRUCT
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Chunk memory. **/
+        unsigned char mData[ECS_ARCHETYPE_CHUNK_SIZE];
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::SnapshotPage
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * SnapshotChunk - Chunk state.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API SnapshotChunk final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_STRUCT
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Chunk memory copy. **/
+        ecs_sptr<SnapshotPage> mPage;
+
+        /** Rows count. **/
+        ecs_uint32_t mCount;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::SnapshotChunk
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * SnapshotLocation - Entity location.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API SnapshotLocation final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_STRUCT
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Archetype index, or ecs::StorageSnapshot::NO_ARCHETYPE if slot released. **/
+        ecs_uint32_t mArchetype;
+
+        /** Row in Archetype. **/
+        ecs_ArchetypeRow mRow;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::SnapshotLocation
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * StorageSnapshot - ecs::ArchetypeStorage state, filled by ArchetypeStorage::Capture.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API StorageSnapshot final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_STRUCT
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Slot is released. **/
+        static constexpr const ecs_uint32_t NO_ARCHETYPE = ecs_NumericUtil<ecs_uint32_t>::MAX;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Frame (user tick). **/
+        ecs_uint64_t mFrame;
+
+        /** Storage change tick when captured. **/
+        ecs_uint32_t mTick;
+
+        /** Chunks, per Archetype. **/
+        ecs_vec<ecs_vec<SnapshotChunk>> mChunks;
+
+        /** Entities locations, indexed by Handle index. **/
+        ecs_vec<SnapshotLocation> mLocations;
+
+        /** Entities generations, indexed by Handle index. **/
+        ecs_vec<ecs_uint8_t> mGenerations;
+
+        /** Released slots. **/
+        ecs_vec<ecs_uint32_t> mFreeSlots;
+
+        /** Alive Entities count. **/
+        ecs_size_t mCount;
+
+        /** Hierarchy Entities, parents before children (see ecs::HierarchyStore::getEntities). **/
+        ecs_vec<ecs_Handle> mHierarchy;
+
+        /** Parent of each hierarchy Entity, invalid Handle for roots. **/
+        ecs_vec<ecs_Handle> mHierarchyParents;
+
+        /** Entities of ecs::EntityRegistry, bound to storage. **/
+        ecs_vec<ecs_Handle> mRegistry;
+
+        /** Components masks of registry Entities. **/
+        ecs_vec<ecs_Signature> mRegistryMasks;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::StorageSnapshot
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_SnapshotPage = ecs::SnapshotPage;
+using ecs_SnapshotChunk = ecs::SnapshotChunk;
+using ecs_SnapshotLocation = ecs::SnapshotLocation;
+using ecs_StorageSnapshot = ecs::StorageSnapshot;
+#define ECS_STORAGE_SNAPSHOT_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_STORAGE_SNAPSHOT_HPP
@@ -49,6 +49,11 @@
 #include "../types/ecs_numeric.hpp"
 #endif // !ECS_NUMERIC_HPP
 
+// Include ecs::Signature
+#ifndef ECS_SIGNATURE_HPP
+#include "../archetype/Signature.hpp"
+#endif // !ECS_SIGNATURE_HPP
+
 // ===========================================================
 // TYPES
 // ===========================================================
@@ -134,6 +139,34 @@ namespace ecs
         **/
         virtual bool isStarted() const noexcept = 0;
 
+        /**
+         * @brief
+         * Returns Component types, read by #Update.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        virtual const ecs_Signature& getReads() const noexcept = 0;
+
+        /**
+         * @brief
+         * Returns Component types, written by #Update.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        virtual const ecs_Signature& getWrites() const noexcept = 0;
+
+        /**
+         * @brief
+         * Returns 'true' if System access not declared,
+         * so it can't run concurrently with other Systems.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        virtual bool isExclusive() const noexcept = 0;
+
         // ===========================================================
         // METHODS
         // ===========================================================
@@ -167,6 +200,19 @@ namespace ecs
         **/
         virtual void Stop() = 0;
 
+        /**
+         * @brief
+         * Update System (frame).
+         *
+         * (?) Can be called from worker thread, concurrently with Systems,
+         * which access doesn't conflict with this System.
+         *
+         * @thread_safety - depends on declared access.
+         * @param pElapsed - time since last frame (seconds).
+         * @throws - can throw exception.
+        **/
+        virtual void Update( const ecs_real_t pElapsed ) = 0;
+
         // -----------------------------------------------------------
 
     }; /// ecs::ISystem
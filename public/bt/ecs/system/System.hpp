@@ -124,6 +124,15 @@ namespace ecs
         /** State. **/
         ecs_atomic<unsigned char> mCurrentState;
 
+        /** Component types, read by #onUpdate. **/
+        ecs_Signature mReads;
+
+        /** Component types, written by #onUpdate. **/
+        ecs_Signature mWrites;
+
+        /** 'true' until access declared. **/
+        bool mExclusive;
+
         // ===========================================================
         // CONSTRUCTOR
         // ===========================================================
@@ -222,6 +231,58 @@ namespace ecs
         **/
         static ECS_API void UnsubscribeSystem( System* const pInstance, const ecs_vec<ecs_TypeID>& pEvents );
 
+        /**
+         * @brief
+         * Declares Component type, read by #onUpdate.
+         * Schedule is rebuilt on next ecs::SystemsManager::Update.
+         *
+         * @thread_safety - not thread-safe, not during Systems update.
+         * @param pType - Component Type-ID.
+         * @throws - no exceptions.
+        **/
+        void Reads( const ecs_TypeID pType ) noexcept;
+
+        /**
+         * @brief
+         * Declares Component type, read & written by #onUpdate.
+         * Schedule is rebuilt on next ecs::SystemsManager::Update.
+         *
+         * @thread_safety - not thread-safe, not during Systems update.
+         * @param pType - Component Type-ID.
+         * @throws - no exceptions.
+        **/
+        void Writes( const ecs_TypeID pType ) noexcept;
+
+        template <typename T>
+        void Reads()
+        { Reads( ecs_ComponentType<T>::getID() ); }
+
+        template <typename T>
+        void Writes()
+        { Writes( ecs_ComponentType<T>::getID() ); }
+
+        /**
+         * @brief
+         * Sets exclusive mode.
+         * Call with 'false' for Systems, which don't access Components.
+         * Schedule is rebuilt on next ecs::SystemsManager::Update.
+         *
+         * @thread_safety - not thread-safe, not during Systems update.
+         * @param pExclusive - 'true' to run alone.
+         * @throws - no exceptions.
+        **/
+        void setExclusive( const bool pExclusive ) noexcept;
+
+        /**
+         * @brief
+         * Called on frame update, if System started & not paused.
+         *
+         * @thread_safety - depends on declared access.
+         * @param pElapsed - time since last frame (seconds).
+         * @throws - can throw exception.
+        **/
+        virtual void onUpdate( const ecs_real_t pElapsed );
+
         /**
          * @brief
          * Called when System starting.
@@ -334,6 +395,33 @@ namespace ecs
         **/
         virtual bool isStarted() const noexcept final;
 
+        /**
+         * @brief
+         * Returns Component types, read by #Update.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        virtual const ecs_Signature& getReads() const noexcept final;
+
+        /**
+         * @brief
+         * Returns Component types, written by #Update.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        virtual const ecs_Signature& getWrites() const noexcept final;
+
+        /**
+         * @brief
+         * Returns 'true' if System can't run concurrently with other Systems.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        virtual bool isExclusive() const noexcept final;
+
         // ===========================================================
         // ecs::ISystem
         // ===========================================================
@@ -367,6 +455,17 @@ namespace ecs
         **/
         virtual void Stop() final;
 
+        /**
+         * @brief
+         * Update System (frame).
+         * Calls #onUpdate, if System started & not paused.
+         *
+         * @thread_safety - depends on declared access.
+         * @param pElapsed - time since last frame (seconds).
+         * @throws - can throw exception.
+        **/
+        virtual void Update( const ecs_real_t pElapsed ) final;
+
         // ===========================================================
         // ecs::IEventListener
         // ===========================================================
@@ -64,6 +64,11 @@
 #include "../types/ecs_map.hpp"
 #endif // !ECS_MAP_HPP
 
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
 // ===========================================================
 // FORWARD-DECLARATION
 // ===========================================================
@@ -75,6 +80,13 @@ namespace ecs { class ISystem; }
 using ecs_ISystem = ecs::ISystem;
 #endif // !ECS_I_SYSTEM_DECL
 
+// Forward-Declare ecs::SystemsScheduler
+#ifndef ECS_SYSTEMS_SCHEDULER_DECL
+#define ECS_SYSTEMS_SCHEDULER_DECL
+namespace ecs { class SystemsScheduler; }
+using ecs_SystemsScheduler = ecs::SystemsScheduler;
+#endif // !ECS_SYSTEMS_SCHEDULER_DECL
+
 // ===========================================================
 // TYPES
 // ===========================================================
@@ -130,12 +142,21 @@ namespace ecs
         /** Systems. **/
         systems_map mSystems;
 
+        /** Systems Type-IDs in registration order, schedule is built in this order. **/
+        ecs_vec<ecs_TypeID> mOrder;
+
         /** Systems Mutex. **/
         ecs_Mutex mSystemsMutex;
 
         /** Mutex. **/
         ecs_Mutex mIDMutex;
 
+        /** Scheduler. **/
+        ecs_sptr<ecs_SystemsScheduler> mScheduler;
+
+        /** 'true' if Systems changed since schedule built. **/
+        bool mScheduleDirty;
+
         // ===========================================================
         // GETTERS & SETTERS
         // ===========================================================
@@ -172,9 +193,10 @@ namespace ecs
          * @brief
          * SystemsManager constructor.
          *
+         * @param pWorkers - scheduler worker threads count.
          * @throws - can throw exception.
         **/
-        explicit SystemsManager();
+        explicit SystemsManager( const ecs_size_t pWorkers = 0 );
 
         /**
          * @brief
@@ -243,14 +265,36 @@ namespace ecs
         **/
         static ECS_API void unregisterSystem( const ecs_TypeID pType );
 
+        /**
+         * @brief
+         * Marks schedule dirty, so it is rebuilt on next #Update.
+         * Called when System changes Components access.
+         *
+         * @thread_safety - thread-lock used.
+         * @throws - no exceptions.
+        **/
+        static ECS_API void invalidateSchedule() ECS_NOEXCEPT;
+
+        /**
+         * @brief
+         * Updates Systems on scheduler workers, then applies deferred commands.
+         * Schedule rebuilt in registration order, if Systems registered, removed or changed access.
+         *
+         * @thread_safety - main thread only.
+         * @param pElapsed - time since last frame (seconds).
+         * @throws - can throw exception.
+        **/
+        static ECS_API void Update( const ecs_real_t pElapsed );
+
         /**
          * @brief
          * Initialize SystemsManager instance.
          *
          * @thread_safety - main thread only.
+         * @param pWorkers - scheduler worker threads count, 0 for (hardware threads - 1).
          * @throws - can throw exception.
         **/
-        static ECS_API void Initialize();
+        static ECS_API void Initialize( const ecs_size_t pWorkers = 0 );
 
         /**
          * @brief
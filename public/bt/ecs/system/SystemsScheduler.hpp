@@ -0,0 +1,351 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_SYSTEMS_SCHEDULER_HPP
+#define ECS_SYSTEMS_SCHEDULER_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::ISystem
+#ifndef ECS_I_SYSTEM_HXX
+#include "ISystem.hxx"
+#endif // !ECS_I_SYSTEM_HXX
+
+// Include ecs::memory
+#ifndef ECS_MEMORY_HPP
+#include "../types/ecs_memory.hpp"
+#endif // !ECS_MEMORY_HPP
+
+// Include ecs::vector
+#ifndef ECS_VECTOR_HPP
+#include "../types/ecs_vector.hpp"
+#endif // !ECS_VECTOR_HPP
+
+// Include ecs::atomic
+#ifndef ECS_ATOMIC_HPP
+#include "../types/ecs_atomic.hpp"
+#endif // !ECS_ATOMIC_HPP
+
+// Include ecs::thread
+#ifndef ECS_THREAD_HPP
+#include "../types/ecs_thread.hpp"
+#endif // !ECS_THREAD_HPP
+
+// Include C++ exception
+#include <exception>
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Workers count, used when 0 requested: hardware threads - 1. **/
+#ifndef ECS_SCHEDULER_AUTO_WORKERS
+#define ECS_SCHEDULER_AUTO_WORKERS 0
+#endif // !ECS_SCHEDULER_AUTO_WORKERS
+
+/** Workers count, Systems run only on calling thread. **/
+#ifndef ECS_SCHEDULER_NO_WORKERS
+#define ECS_SCHEDULER_NO_WORKERS static_cast<ecs_size_t>( -1 )
+#endif // !ECS_SCHEDULER_NO_WORKERS
+
+// ===========================================================
+// FORWARD-DECLARATION
+// ===========================================================
+
+// Forward-Declare ecs::World
+#ifndef ECS_WORLD_DECL
+#define ECS_WORLD_DECL
+namespace ecs { class World; }
+using ecs_World = ecs::World;
+#endif // !ECS_WORLD_DECL
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * SystemsScheduler - runs Systems updates on worker threads.
+     *
+     * Systems are grouped into levels, based on declared Components access:
+     * System is placed after all previous Systems, which access conflicts with it
+     * (write-write or read-write on same Component type, or exclusive System).
+     * Systems of one level run concurrently, levels are separated by barriers.
+     * Calling thread participates in work.
+     *
+     * @thread_safety - #Build & #Run must be called from one thread.
+     * @version 0.1
+    **/
+    class ECS_API SystemsScheduler final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // TYPES
+        // ===========================================================
+
+        /** System pointer. **/
+        using system_ptr = ecs_sptr<ecs_ISystem>;
+
+        /**
+         * @brief
+         * Level - range of Systems, which can run concurrently.
+        **/
+        struct Level final
+        {
+            /** First System index. **/
+            ecs_uint32_t mFirst;
+
+            /** Systems count. **/
+            ecs_uint32_t mCount;
+        };
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Job cursor: [level : 32][job index : 32]. **/
+        static constexpr const ecs_size_t CURSOR_LEVEL_SHIFT = 32;
+        static constexpr const std::uint64_t CURSOR_JOB_MASK = 0xFFFFFFFFull;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Systems, sorted by level. **/
+        ecs_vec<system_ptr> mSystems;
+
+        /** Levels. **/
+        ecs_vec<Level> mLevels;
+
+        /** Workers. **/
+        ecs_vec<ecs_thread> mWorkers;
+
+        /** Workers Mutex. **/
+        ecs_StdMutex mMutex;
+
+        /** Workers wake-up. **/
+        ecs_ConditionVariable mWorkCondition;
+
+        /** Level completion. **/
+        ecs_ConditionVariable mDoneCondition;
+
+        /** Dispatches counter, workers wake-up when changed. **/
+        std::uint64_t mDispatch;
+
+        /** Workers, which didn't acknowledge current dispatch yet. **/
+        ecs_uint32_t mPending;
+
+        /** 'true' to stop workers. **/
+        bool mStop;
+
+        /** Current level & next job. **/
+        ecs_atomic<std::uint64_t> mCursor;
+
+        /** Finished jobs of current level. **/
+        ecs_atomic<ecs_uint32_t> mDone;
+
+        /** Elapsed time of current frame. **/
+        ecs_real_t mElapsed;
+
+        /** First exception, thrown by System. **/
+        std::exception_ptr mError;
+
+        /** Exception Mutex. **/
+        ecs_StdMutex mErrorMutex;
+
+        /** World bound to thread that runs Systems, bound to workers too. **/
+        ecs_World* mWorld;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns 'true' if Systems can't run concurrently.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        static bool isConflict( const ecs_ISystem& pA, const ecs_ISystem& pB ) noexcept;
+
+        /**
+         * @brief
+         * Worker thread main.
+         *
+         * @thread_safety - worker thread.
+         * @throws - no exceptions.
+        **/
+        void workerLoop() noexcept;
+
+        /**
+         * @brief
+         * Claims & runs jobs of current level, until none left.
+         *
+         * @thread_safety - lock-free (atomic cursor).
+         * @throws - no exceptions, System exceptions are stored.
+        **/
+        void runJobs() noexcept;
+
+        /**
+         * @brief
+         * Runs level on workers & waits until all its Systems finished.
+         *
+         * @thread_safety - owner thread.
+         * @param pLevel - level index.
+         * @throws - no exceptions.
+        **/
+        void runLevel( const ecs_uint32_t pLevel ) noexcept;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        SystemsScheduler(const SystemsScheduler&) = delete;
+        SystemsScheduler& operator=(const SystemsScheduler&) = delete;
+        SystemsScheduler(SystemsScheduler&&) = delete;
+        SystemsScheduler& operator=(SystemsScheduler&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * SystemsScheduler constructor.
+         *
+         * @param pWorkers - worker threads count, ECS_SCHEDULER_AUTO_WORKERS for (hardware threads - 1).
+         * @throws - can throw exception.
+        **/
+        explicit SystemsScheduler( const ecs_size_t pWorkers = ECS_SCHEDULER_AUTO_WORKERS );
+
+        /**
+         * @brief
+         * SystemsScheduler destructor.
+         * Stops & joins workers.
+         *
+         * @throws - no exceptions.
+        **/
+        ~SystemsScheduler() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns worker threads count.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t getWorkersCount() const noexcept
+        { return mWorkers.size(); }
+
+        /**
+         * @brief
+         * Returns levels count (barriers + 1).
+         *
+         * @thread_safety - owner thread.
+         * @throws - no exceptions.
+        **/
+        ecs_size_t getLevelsCount() const noexcept
+        { return mLevels.size(); }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Builds levels from Systems.
+         * Order of conflicting Systems is preserved.
+         *
+         * @thread_safety - owner thread.
+         * @param pSystems - Systems, in execution order.
+         * @throws - can throw exception.
+        **/
+        void Build( const ecs_vec<system_ptr>& pSystems );
+
+        /**
+         * @brief
+         * Updates all Systems, returns when all finished.
+         *
+         * @thread_safety - owner thread.
+         * @param pElapsed - time since last frame (seconds).
+         * @throws - rethrows first exception, thrown by System.
+        **/
+        void Run( const ecs_real_t pElapsed );
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::SystemsScheduler
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_SystemsScheduler = ecs::SystemsScheduler;
+#define ECS_SYSTEMS_SCHEDULER_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_SYSTEMS_SCHEDULER_HPP
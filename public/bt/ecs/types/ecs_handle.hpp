@@ -0,0 +1,194 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_HANDLE_HPP
+#define ECS_HANDLE_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::api
+#ifndef ECS_API_HPP
+#include "ecs_api.hpp"
+#endif // !ECS_API_HPP
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * Handle - 32-bit index & generation pair.
+     * Generation is incremented when slot is released,
+     * so stale Handles can be detected without any lookup.
+     *
+     * @version 0.1
+    **/
+    struct ECS_API Handle final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_STRUCT
+
+        // ===========================================================
+        // CONSTANTS
+        // ===========================================================
+
+        /** Index bits count. **/
+        static constexpr const ecs_uint32_t INDEX_BITS = 24;
+
+        /** Generation bits count. **/
+        static constexpr const ecs_uint32_t GENERATION_BITS = 8;
+
+        /** Index mask. **/
+        static constexpr const ecs_uint32_t INDEX_MASK = ( 1u << INDEX_BITS ) - 1u;
+
+        /** Generation mask. **/
+        static constexpr const ecs_uint32_t GENERATION_MASK = ( 1u << GENERATION_BITS ) - 1u;
+
+        /** Invalid (null) value. **/
+        static constexpr const ecs_uint32_t INVALID = ecs_NumericUtil<ecs_uint32_t>::MAX;
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Packed value. **/
+        ecs_uint32_t mValue;
+
+        // ===========================================================
+        // CONSTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * Handle constructor.
+         *
+         * @param pValue - packed value.
+         * @throws - no exceptions.
+        **/
+        constexpr explicit Handle( const ecs_uint32_t pValue = INVALID ) noexcept
+            : mValue( pValue )
+        {
+        }
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns slot index.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        constexpr ecs_uint32_t getIndex() const noexcept
+        { return mValue & INDEX_MASK; }
+
+        /**
+         * @brief
+         * Returns slot generation.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        constexpr ecs_uint32_t getGeneration() const noexcept
+        { return ( mValue >> INDEX_BITS ) & GENERATION_MASK; }
+
+        /**
+         * @brief
+         * Returns 'false' if this is a null-Handle.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        constexpr bool isValid() const noexcept
+        { return mValue != INVALID; }
+
+        // ===========================================================
+        // METHODS & OPERATORS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Packs index & generation.
+         *
+         * @thread_safety - not required.
+         * @param pIndex - slot index.
+         * @param pGeneration - slot generation.
+         * @throws - no exceptions.
+        **/
+        static constexpr Handle Make( const ecs_uint32_t pIndex, const ecs_uint32_t pGeneration ) noexcept
+        { return Handle( ( pIndex & INDEX_MASK ) | ( ( pGeneration & GENERATION_MASK ) << INDEX_BITS ) ); }
+
+        constexpr bool operator==( const Handle& pOther ) const noexcept
+        { return mValue == pOther.mValue; }
+
+        constexpr bool operator!=( const Handle& pOther ) const noexcept
+        { return mValue != pOther.mValue; }
+
+        constexpr bool operator<( const Handle& pOther ) const noexcept
+        { return mValue < pOther.mValue; }
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::Handle
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_Handle = ecs::Handle;
+#define ECS_HANDLE_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_HANDLE_HPP
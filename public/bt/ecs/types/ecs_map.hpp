@@ -60,6 +60,9 @@
 template <typename K, typename V>
 using ecs_map = bt_map<K, V>;
 
+template <typename K, typename V>
+using ecs_hash_map = bt_hash_map<K, V>;
+
 template <typename K, typename V>
 using ecs_AsyncMap = bt_AsyncMap<K, V>;
 
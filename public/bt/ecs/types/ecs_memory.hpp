@@ -58,6 +58,9 @@ using ecs_sptr = bt_sptr<T>;
 template <typename T>
 using ecs_wptr = bt_wptr<T>;
 
+template <typename T>
+using ecs_uptr = bt_uptr<T>;
+
 using ecs_Memory = bt_Memory;
 
 #define ecs_Shared bt_Shared
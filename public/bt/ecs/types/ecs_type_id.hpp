@@ -0,0 +1,217 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_TYPE_ID_HPP
+#define ECS_TYPE_ID_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::api
+#ifndef ECS_API_HPP
+#include "ecs_api.hpp"
+#endif // !ECS_API_HPP
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// ===========================================================
+// CONFIGS
+// ===========================================================
+
+/** Event Type-IDs reserved for manual enums (bt_EEventTypes), generated IDs start after. **/
+#ifndef ECS_RESERVED_EVENT_TYPES
+#define ECS_RESERVED_EVENT_TYPES 100
+#endif // !ECS_RESERVED_EVENT_TYPES
+
+/** Component Type-IDs reserved for manual registration (ecs::ComponentType::Register), generated IDs start after. **/
+#ifndef ECS_RESERVED_COMPONENT_TYPES
+#define ECS_RESERVED_COMPONENT_TYPES 64
+#endif // !ECS_RESERVED_COMPONENT_TYPES
+
+/** Max Type-ID families. **/
+#ifndef ECS_MAX_TYPE_FAMILIES
+#define ECS_MAX_TYPE_FAMILIES 8
+#endif // !ECS_MAX_TYPE_FAMILIES
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * ComponentFamily - Type-IDs family for Components.
+    **/
+    struct ECS_API ComponentFamily final
+    {
+        static constexpr const ecs_uint8_t INDEX = 0;
+        static constexpr const ecs_TypeID FIRST = ECS_RESERVED_COMPONENT_TYPES;
+    };
+
+    /**
+     * @brief
+     * EventFamily - Type-IDs family for Events.
+    **/
+    struct ECS_API EventFamily final
+    {
+        static constexpr const ecs_uint8_t INDEX = 1;
+        static constexpr const ecs_TypeID FIRST = ECS_RESERVED_EVENT_TYPES;
+    };
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * TypeIdCounter - dense Type-IDs generator, one counter per family.
+     *
+     * @thread_safety - thread-safe (atomic).
+     * @version 0.1
+    **/
+    class ECS_API TypeIdCounter final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        TypeIdCounter() = delete;
+        TypeIdCounter(const TypeIdCounter&) = delete;
+        TypeIdCounter& operator=(const TypeIdCounter&) = delete;
+        TypeIdCounter(TypeIdCounter&&) = delete;
+        TypeIdCounter& operator=(TypeIdCounter&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns count of Type-IDs generated for family.
+         * Flat per-type tables can be sized by (FIRST + Count).
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @param pFamily - family index.
+         * @throws - no exceptions.
+        **/
+        static ecs_TypeID Count( const ecs_uint8_t pFamily ) noexcept;
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Generates next Type-ID.
+         *
+         * @thread_safety - thread-safe (atomic).
+         * @param pFamily - family index.
+         * @param pFirst - first Type-ID of family.
+         * @throws - no exceptions.
+        **/
+        static ecs_TypeID Next( const ecs_uint8_t pFamily, const ecs_TypeID pFirst ) noexcept;
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::TypeIdCounter
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * Returns dense Type-ID of T inside family, without RTTI.
+     * Type-ID is generated once, on first call.
+     *
+     * (?) Values depend on first-use order, so they must not be persisted.
+     *
+     * @thread_safety - thread-safe (static init).
+     * @throws - no exceptions.
+    **/
+    template <typename T, typename _Family = ComponentFamily>
+    ecs_TypeID TypeIdOf() noexcept
+    {
+        static const ecs_TypeID typeID = TypeIdCounter::Next( _Family::INDEX, _Family::FIRST );
+        return typeID;
+    }
+
+    /**
+     * @brief
+     * Returns dense Event Type-ID of T.
+     *
+     * @thread_safety - thread-safe (static init).
+     * @throws - no exceptions.
+    **/
+    template <typename T>
+    ecs_TypeID EventTypeIdOf() noexcept
+    { return TypeIdOf<T, EventFamily>(); }
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_ComponentFamily = ecs::ComponentFamily;
+using ecs_EventFamily = ecs::EventFamily;
+using ecs_TypeIdCounter = ecs::TypeIdCounter;
+#define ECS_TYPE_ID_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_TYPE_ID_HPP
@@ -50,8 +50,8 @@
 template <typename T>
 using ecs_VectorUtil = bt_VectorUtil<T>;
 
-template <typename T>
-using ecs_vec = bt_vector<T>;
+template <typename T, typename A = std::allocator<T>>
+using ecs_vec = bt_vector<T, A>;
 
 template <typename T>
 using ecs_AsyncVector = bt::core::AsyncVector<T>;
@@ -0,0 +1,420 @@
+/**
+* Copyright © 2020 Denis Z. (code4un@yandex.ru) All rights reserved.
+* Authors: Denis Z. (code4un@yandex.ru)
+* All rights reserved.
+* Language: C++
+* License: see LICENSE.txt
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+* 1. Redistributions of source code must retain the above copyright notice,
+* this list of conditions and the following disclaimer.
+* 2. Redistributions in binary form must display the names 'Denis Zyamaev' and
+* in the credits of the application, if such credits exist.
+* The authors of this work must be notified via email (code4un@yandex.ru) in
+* this case of redistribution.
+* 3. Neither the name of copyright holders nor the names of its contributors
+* may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS ``AS
+* IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+* PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS OR CONTRIBUTORS
+* BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+**/
+
+#ifndef ECS_WORLD_HPP
+#define ECS_WORLD_HPP
+
+// -----------------------------------------------------------
+
+// ===========================================================
+// INCLUDES
+// ===========================================================
+
+// Include ecs::memory
+#ifndef ECS_MEMORY_HPP
+#include "../types/ecs_memory.hpp"
+#endif // !ECS_MEMORY_HPP
+
+// Include ecs::numeric
+#ifndef ECS_NUMERIC_HPP
+#include "../types/ecs_numeric.hpp"
+#endif // !ECS_NUMERIC_HPP
+
+// Include ecs::SystemsScheduler
+#ifndef ECS_SYSTEMS_SCHEDULER_HPP
+#include "../system/SystemsScheduler.hpp"
+#endif // !ECS_SYSTEMS_SCHEDULER_HPP
+
+// Include ecs::ComponentType
+#ifndef ECS_COMPONENT_TYPE_HPP
+#include "../component/ComponentType.hpp"
+#endif // !ECS_COMPONENT_TYPE_HPP
+
+// Include C++ utility
+#include <utility>
+
+// Include C++ stdexcept
+#include <stdexcept>
+
+// ===========================================================
+// FORWARD-DECLARATION
+// ===========================================================
+
+// Forward-Declare ecs::ComponentsManager
+#ifndef ECS_COMPONENTS_MANAGER_DECL
+#define ECS_COMPONENTS_MANAGER_DECL
+namespace ecs { class ComponentsManager; }
+using ecs_Components = ecs::ComponentsManager;
+#endif // !ECS_COMPONENTS_MANAGER_DECL
+
+// Forward-Declare ecs::EntitiesManager
+#ifndef ECS_ENTITIES_MANAGER_DECL
+#define ECS_ENTITIES_MANAGER_DECL
+namespace ecs { class EntitiesManager; }
+using ecs_Entities = ecs::EntitiesManager;
+#endif // !ECS_ENTITIES_MANAGER_DECL
+
+// Forward-Declare ecs::SystemsManager
+#ifndef ECS_SYSTEMS_MANAGER_DECL
+#define ECS_SYSTEMS_MANAGER_DECL
+namespace ecs { class SystemsManager; }
+using ecs_Systems = ecs::SystemsManager;
+#endif // !ECS_SYSTEMS_MANAGER_DECL
+
+// Forward-Declare ecs::EventsManager
+#ifndef ECS_EVENTS_MANAGER_DECL
+#define ECS_EVENTS_MANAGER_DECL
+namespace ecs { class EventsManager; }
+using ecs_Events = ecs::EventsManager;
+#endif // !ECS_EVENTS_MANAGER_DECL
+
+// ===========================================================
+// TYPES
+// ===========================================================
+
+namespace ecs
+{
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * World - independent set of ECS managers.
+     *
+     * Managers static API uses World bound to calling thread (see ecs::WorldScope),
+     * or process-wide instances (Initialize/Terminate) if no World bound.
+     * Worlds don't share data or locks, so they can be updated in parallel
+     * on different threads.
+     *
+     * Singleton Components (one instance per World) are stored in flat array
+     * indexed by Component Type-ID, so access is one load.
+     *
+     * @thread_safety - World must be updated by one thread at a time.
+     * @version 0.1
+    **/
+    class ECS_API World final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** Components. **/
+        ecs_sptr<ecs_Components> mComponents;
+
+        /** Entities. **/
+        ecs_sptr<ecs_Entities> mEntities;
+
+        /** Events. **/
+        ecs_sptr<ecs_Events> mEvents;
+
+        /** Systems. **/
+        ecs_sptr<ecs_Systems> mSystems;
+
+        /** Singleton Components, indexed by Type-ID. **/
+        ecs_sptr<void> mSingletons[ECS_MAX_COMPONENT_TYPES];
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        World(const World&) = delete;
+        World& operator=(const World&) = delete;
+        World(World&&) = delete;
+        World& operator=(World&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * World constructor.
+         *
+         * @param pWorkers - Systems Scheduler worker threads count,
+         * by default Systems run on updating thread, so Worlds scale with threads updating them.
+         * @throws - can throw exception.
+        **/
+        explicit World( const ecs_size_t pWorkers = ECS_SCHEDULER_NO_WORKERS );
+
+        /**
+         * @brief
+         * World destructor. Managers are released while World is bound.
+         *
+         * @throws - no exceptions.
+        **/
+        ~World() noexcept;
+
+        // ===========================================================
+        // GETTERS & SETTERS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Returns World bound to calling thread, or null.
+         *
+         * @thread_safety - thread-local.
+         * @throws - no exceptions.
+        **/
+        static World* getCurrent() noexcept;
+
+        /**
+         * @brief
+         * Binds World to calling thread.
+         *
+         * @thread_safety - thread-local.
+         * @param pWorld - World, or null to use process-wide managers.
+         * @return - previously bound World.
+         * @throws - no exceptions.
+        **/
+        static World* setCurrent( World* const pWorld ) noexcept;
+
+        /**
+         * @brief
+         * Returns Components Manager.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        const ecs_sptr<ecs_Components>& getComponents() const noexcept
+        { return mComponents; }
+
+        /**
+         * @brief
+         * Returns Entities Manager.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        const ecs_sptr<ecs_Entities>& getEntities() const noexcept
+        { return mEntities; }
+
+        /**
+         * @brief
+         * Returns Events Manager.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        const ecs_sptr<ecs_Events>& getEvents() const noexcept
+        { return mEvents; }
+
+        /**
+         * @brief
+         * Returns Systems Manager.
+         *
+         * @thread_safety - not required.
+         * @throws - no exceptions.
+        **/
+        const ecs_sptr<ecs_Systems>& getSystems() const noexcept
+        { return mSystems; }
+
+        /**
+         * @brief
+         * Returns singleton Component.
+         *
+         * @thread_safety - read-only, not synchronized with #setSingleton & #removeSingleton.
+         * @return - singleton, or null if not set.
+         * @throws - std::out_of_range, if Component Type-IDs exhausted (see ecs::ComponentType::getID).
+        **/
+        template <typename T>
+        T* getSingleton() const
+        {
+            const ecs_TypeID type = ecs_ComponentType<T>::getID();
+            return type < ECS_MAX_COMPONENT_TYPES ? static_cast<T*>( mSingletons[type].get() ) : nullptr;
+        }
+
+        /**
+         * @brief
+         * Sets singleton Component, previous one is destroyed.
+         *
+         * @thread_safety - not thread-safe.
+         * @param pArgs - Component constructor arguments.
+         * @return - singleton.
+         * @throws - can throw exception, std::out_of_range if Type-ID isn't less than ECS_MAX_COMPONENT_TYPES.
+        **/
+        template <typename T, typename... _Types>
+        T& setSingleton( _Types&&... pArgs )
+        {
+            const ecs_TypeID type = ecs_ComponentType<T>::getID();
+
+            if ( type >= ECS_MAX_COMPONENT_TYPES )
+                throw std::out_of_range( "World::setSingleton - Type-ID out of range, increase ECS_MAX_COMPONENT_TYPES." );
+
+            ecs_sptr<T> singleton = ecs_Shared<T>( std::forward<_Types>(pArgs)... );
+            mSingletons[type] = singleton;
+
+            return *singleton;
+        }
+
+        /**
+         * @brief
+         * Destroys singleton Component.
+         *
+         * @thread_safety - not thread-safe.
+         * @throws - std::out_of_range, if Component Type-IDs exhausted (see ecs::ComponentType::getID).
+        **/
+        template <typename T>
+        void removeSingleton()
+        {
+            const ecs_TypeID type = ecs_ComponentType<T>::getID();
+
+            if ( type < ECS_MAX_COMPONENT_TYPES )
+                mSingletons[type].reset();
+        }
+
+        // ===========================================================
+        // METHODS
+        // ===========================================================
+
+        /**
+         * @brief
+         * Binds World to calling thread & updates Systems.
+         *
+         * @thread_safety - one thread per World.
+         * @param pElapsed - elapsed time.
+         * @throws - can throw exception.
+        **/
+        void Update( const ecs_real_t pElapsed );
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::World
+
+    // -----------------------------------------------------------
+
+    /**
+     * @brief
+     * WorldScope - binds World to calling thread until scope exit.
+     *
+     * @thread_safety - thread-local.
+     * @version 0.1
+    **/
+    class ECS_API WorldScope final
+    {
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // META
+        // ===========================================================
+
+        ECS_CLASS
+
+        // -----------------------------------------------------------
+
+    private:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // FIELDS
+        // ===========================================================
+
+        /** World bound before scope. **/
+        World* const mPrevious;
+
+        // ===========================================================
+        // DELETED
+        // ===========================================================
+
+        WorldScope(const WorldScope&) = delete;
+        WorldScope& operator=(const WorldScope&) = delete;
+        WorldScope(WorldScope&&) = delete;
+        WorldScope& operator=(WorldScope&&) = delete;
+
+        // -----------------------------------------------------------
+
+    public:
+
+        // -----------------------------------------------------------
+
+        // ===========================================================
+        // CONSTRUCTOR & DESTRUCTOR
+        // ===========================================================
+
+        /**
+         * @brief
+         * WorldScope constructor.
+         *
+         * @param pWorld - World, or null to use process-wide managers.
+         * @throws - no exceptions.
+        **/
+        explicit WorldScope( World* const pWorld ) noexcept
+            : mPrevious( World::setCurrent(pWorld) )
+        {
+        }
+
+        /**
+         * @brief
+         * WorldScope destructor, restores previous World.
+         *
+         * @throws - no exceptions.
+        **/
+        ~WorldScope() noexcept
+        { World::setCurrent( mPrevious ); }
+
+        // -----------------------------------------------------------
+
+    }; /// ecs::WorldScope
+
+    // -----------------------------------------------------------
+
+} /// ecs
+
+using ecs_World = ecs::World;
+using ecs_WorldScope = ecs::WorldScope;
+#define ECS_WORLD_DECL
+
+// -----------------------------------------------------------
+
+#endif // !ECS_WORLD_HPP